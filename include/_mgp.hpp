@@ -854,6 +854,33 @@ inline void result_record_insert(mgp_result_record *record, const char *field_na
   MgInvokeVoid(mgp_result_record_insert, record, field_name, val);
 }
 
+inline mgp_result_batch *result_new_batch(mgp_result *res, size_t size) {
+  return MgInvoke<mgp_result_batch *>(mgp_result_new_batch, res, size);
+}
+
+inline size_t result_batch_size(mgp_result_batch *batch) { return MgInvoke<size_t>(mgp_result_batch_size, batch); }
+
+inline void result_batch_set_int_column(mgp_result_batch *batch, const char *field_name, const int64_t *values) {
+  MgInvokeVoid(mgp_result_batch_set_int_column, batch, field_name, values);
+}
+
+inline void result_batch_set_double_column(mgp_result_batch *batch, const char *field_name, const double *values) {
+  MgInvokeVoid(mgp_result_batch_set_double_column, batch, field_name, values);
+}
+
+inline void result_batch_set_bool_column(mgp_result_batch *batch, const char *field_name, const int *values) {
+  MgInvokeVoid(mgp_result_batch_set_bool_column, batch, field_name, values);
+}
+
+inline void result_batch_set_vertex_column(mgp_result_batch *batch, const char *field_name, mgp_graph *graph,
+                                           const int64_t *vertex_ids) {
+  MgInvokeVoid(mgp_result_batch_set_vertex_column, batch, field_name, graph, vertex_ids);
+}
+
+inline void result_batch_insert(mgp_result_batch *batch, size_t index, const char *field_name, mgp_value *val) {
+  MgInvokeVoid(mgp_result_batch_insert, batch, index, field_name, val);
+}
+
 // Function
 
 inline mgp_func *module_add_function(mgp_module *module, const char *name, mgp_func_cb cb) {
@@ -642,6 +642,59 @@ enum mgp_error mgp_result_reserve(struct mgp_result *res, size_t n);
 /// mgp_error::MGP_ERROR_LOGIC_ERROR `val` does not satisfy the type of the field name `field_name`.
 enum mgp_error mgp_result_record_insert(struct mgp_result_record *record, const char *field_name,
                                         struct mgp_value *val);
+
+/// Represents a batch of result records which are filled column by column.
+/// Procedures yielding many records should prefer batches over mgp_result_new_record, because each column is
+/// validated and stored once instead of once for every record.
+struct mgp_result_batch;
+
+/// Create a new batch of `size` records for results. All fields of the new records are null.
+/// Records of batches are yielded after the records created with mgp_result_new_record, in the order the batches were
+/// created.
+/// The previously obtained mgp_result_batch pointer is no longer valid, and you must not use it.
+/// Return mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE if unable to allocate a mgp_result_batch.
+enum mgp_error mgp_result_new_batch(struct mgp_result *res, size_t size, struct mgp_result_batch **result);
+
+/// Get the number of records in the given batch.
+enum mgp_error mgp_result_batch_size(struct mgp_result_batch *batch, size_t *result);
+
+/// Set the field `field_name` of all records in the batch. `values` must point to mgp_result_batch_size integers.
+/// Return mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE if unable to allocate memory for the column.
+/// Return mgp_error::MGP_ERROR_OUT_OF_RANGE if there is no field named `field_name`.
+/// Return mgp_error::MGP_ERROR_LOGIC_ERROR if integers don't satisfy the type of the field named `field_name`.
+enum mgp_error mgp_result_batch_set_int_column(struct mgp_result_batch *batch, const char *field_name,
+                                               const int64_t *values);
+
+/// Set the field `field_name` of all records in the batch. `values` must point to mgp_result_batch_size doubles.
+/// Return mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE if unable to allocate memory for the column.
+/// Return mgp_error::MGP_ERROR_OUT_OF_RANGE if there is no field named `field_name`.
+/// Return mgp_error::MGP_ERROR_LOGIC_ERROR if doubles don't satisfy the type of the field named `field_name`.
+enum mgp_error mgp_result_batch_set_double_column(struct mgp_result_batch *batch, const char *field_name,
+                                                  const double *values);
+
+/// Set the field `field_name` of all records in the batch. `values` must point to mgp_result_batch_size integers,
+/// where non-zero values are stored as true.
+/// Return mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE if unable to allocate memory for the column.
+/// Return mgp_error::MGP_ERROR_OUT_OF_RANGE if there is no field named `field_name`.
+/// Return mgp_error::MGP_ERROR_LOGIC_ERROR if booleans don't satisfy the type of the field named `field_name`.
+enum mgp_error mgp_result_batch_set_bool_column(struct mgp_result_batch *batch, const char *field_name,
+                                                const int *values);
+
+/// Set the field `field_name` of all records in the batch to the vertices of `graph` with the given IDs.
+/// `vertex_ids` must point to mgp_result_batch_size IDs, as returned by mgp_vertex_get_id.
+/// Return mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE if unable to allocate memory for the column.
+/// Return mgp_error::MGP_ERROR_OUT_OF_RANGE if there is no field named `field_name` or `graph` has no vertex with one
+/// of the IDs.
+/// Return mgp_error::MGP_ERROR_LOGIC_ERROR if vertices don't satisfy the type of the field named `field_name`.
+enum mgp_error mgp_result_batch_set_vertex_column(struct mgp_result_batch *batch, const char *field_name,
+                                                  struct mgp_graph *graph, const int64_t *vertex_ids);
+
+/// Assign a value to a field of the record at `index` in the given batch.
+/// Return mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE if unable to allocate memory to copy the mgp_value.
+/// Return mgp_error::MGP_ERROR_OUT_OF_RANGE if `index` is out of range or there is no field named `field_name`.
+/// Return mgp_error::MGP_ERROR_LOGIC_ERROR if `val` does not satisfy the type of the field named `field_name`.
+enum mgp_error mgp_result_batch_insert(struct mgp_result_batch *batch, size_t index, const char *field_name,
+                                       struct mgp_value *val);
 ///@}
 
 /// @name Graph Constructs
@@ -1060,6 +1060,79 @@ class Record:
         self.fields = kwargs
 
 
+class VertexIds:
+    """Column of vertex IDs which are returned as vertices."""
+
+    __slots__ = ("ids",)
+
+    def __init__(self, ids):
+        """Initialize with a sequence of integers or an integer buffer, e.g. `GraphArrays.vertex_ids`."""
+        self.ids = ids
+
+
+class Columns:
+    """Represents multiple records of resulting field values stored column by column.
+
+    Returning a single `Columns` is equivalent to returning a list of `Record`
+    objects, but columns which support the buffer protocol (`array.array`,
+    `memoryview`, NumPy arrays of integers, floats or booleans) are read
+    without creating a Python object for each value. All columns must have
+    the same length. Wrap a column in `VertexIds` to return vertices.
+
+    Example:
+    ```
+    @mgp.read_proc
+    def procedure(context: mgp.ProcCtx) -> mgp.Record(node=mgp.Vertex, rank=float):
+        arrays = context.graph.export_arrays()
+        ranks = compute_ranks(arrays)
+        return mgp.Columns(node=mgp.VertexIds(arrays.vertex_ids), rank=ranks)
+    ```
+    """
+
+    __slots__ = ("columns",)
+
+    def __init__(self, **kwargs):
+        """Initialize with name=column fields in kwargs."""
+        self.columns = kwargs
+
+
+class GraphArrays:
+    """Graph exported as flat arrays by `Graph.export_arrays`.
+
+    All arrays are `memoryview` objects, so they can be wrapped without
+    copying, e.g. with `numpy.asarray(arrays.sources)` or
+    `pyarrow.py_buffer(arrays.sources)`.
+
+    Attributes:
+        vertex_ids: int64 IDs of all vertices.
+        edge_ids: int64 IDs of all edges.
+        sources: int64 index of the source of each edge in `vertex_ids`.
+        targets: int64 index of the target of each edge in `vertex_ids`, -1
+            if the target isn't a part of the graph.
+        vertex_properties: Maps each exported property name to float64
+            values aligned with `vertex_ids`.
+        edge_properties: Maps each exported property name to float64 values
+            aligned with `edge_ids`.
+
+    Properties with a value which isn't an integer, a float or a boolean are
+    exported as NaN.
+    """
+
+    __slots__ = ("vertex_ids", "edge_ids", "sources", "targets", "vertex_properties", "edge_properties")
+
+    def __init__(self, arrays: dict):
+        self.vertex_ids = memoryview(arrays["vertex_ids"]).cast("q").toreadonly()
+        self.edge_ids = memoryview(arrays["edge_ids"]).cast("q").toreadonly()
+        self.sources = memoryview(arrays["sources"]).cast("q").toreadonly()
+        self.targets = memoryview(arrays["targets"]).cast("q").toreadonly()
+        self.vertex_properties = {
+            name: memoryview(values).cast("d").toreadonly() for name, values in arrays["vertex_properties"].items()
+        }
+        self.edge_properties = {
+            name: memoryview(values).cast("d").toreadonly() for name, values in arrays["edge_properties"].items()
+        }
+
+
 class Vertices:
     """Iterable over vertices in a graph."""
 
@@ -1354,6 +1427,36 @@ class Graph:
             raise InvalidContextError()
         self._graph.delete_edge(edge._edge)
 
+    def export_arrays(
+        self, vertex_properties: typing.Iterable[str] = (), edge_properties: typing.Iterable[str] = ()
+    ) -> GraphArrays:
+        """
+        Export the graph as flat arrays for vectorized processing.
+
+        The graph is traversed once in C++, without creating a Python object
+        for each vertex and edge.
+
+        Args:
+            vertex_properties: Names of numeric vertex properties to export.
+            edge_properties: Names of numeric edge properties to export.
+
+        Returns:
+            `GraphArrays` of the graph.
+
+        Raises:
+            InvalidContextError: If `graph` is invalid.
+            UnableToAllocateError: If unable to allocate the arrays.
+
+        Examples:
+            ```
+            arrays = context.graph.export_arrays(edge_properties=["weight"])
+            sources = numpy.asarray(arrays.sources)
+            ```
+        """
+        if not self.is_valid():
+            raise InvalidContextError()
+        return GraphArrays(self._graph.export_arrays(tuple(vertex_properties), tuple(edge_properties)))
+
 
 class AbortError(Exception):
     """Signals that the procedure was asked to abort its execution."""
@@ -1,4 +1,4 @@
-// Copyright 2024 Memgraph Ltd.
+// Copyright 2025 Memgraph Ltd.
 //
 // Use of this software is governed by the Business Source License
 // included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include <span>
+#include <string_view>
 #include <type_traits>
 
 #include "communication/bolt/v1/codes.hpp"
@@ -104,9 +106,9 @@ class BaseEncoder {
     }
   }
 
-  void WriteString(const std::string &value) {
+  void WriteString(std::string_view value) {
     WriteTypeSize(value.size(), MarkerString);
-    WriteRAW(value.c_str(), value.size());
+    WriteRAW(value.data(), value.size());
   }
 
   void WriteList(const std::vector<Value> &value) {
@@ -122,94 +124,152 @@ class BaseEncoder {
     }
   }
 
-  void WriteVertex(const Vertex &vertex) {
+  /**
+   * Writes a vertex from its parts, so that the caller doesn't have to build a
+   * Vertex first.
+   *
+   * @param write_labels called once, has to write `labels_size` strings
+   * @param write_properties called once, has to write `properties_size`
+   *        name-value pairs
+   */
+  template <typename TWriteLabels, typename TWriteProperties>
+  void WriteVertex(Id id, size_t labels_size, TWriteLabels &&write_labels, size_t properties_size,
+                   TWriteProperties &&write_properties, std::string_view element_id) {
     int struct_n = 3 + 1 * int(major_v_ > 4);  // element_id introduced from v5
     WriteRAW(utils::UnderlyingCast(Marker::TinyStruct) + struct_n);
     WriteRAW(utils::UnderlyingCast(Signature::Node));
-    WriteInt(vertex.id.AsInt());
+    WriteInt(id.AsInt());
 
     // write labels
-    const auto &labels = vertex.labels;
-    WriteTypeSize(labels.size(), MarkerList);
-    for (const auto &label : labels) WriteString(label);
+    WriteTypeSize(labels_size, MarkerList);
+    write_labels();
 
     // write properties
-    const auto &props = vertex.properties;
-    WriteTypeSize(props.size(), MarkerMap);
-    for (const auto &prop : props) {
-      WriteString(prop.first);
-      WriteValue(prop.second);
-    }
+    WriteTypeSize(properties_size, MarkerMap);
+    write_properties();
 
     if (major_v_ > 4) {
       // element_id introduced in v5.0
-      WriteString(vertex.element_id);
+      WriteString(element_id);
     }
   }
 
-  void WriteEdge(const Edge &edge, bool unbound = false) {
-    int struct_n = (unbound ? 3 + 1 * int(major_v_ > 4) : 5 + 3 * int(major_v_ > 4));  // element_id introduced from v5
+  void WriteVertex(const Vertex &vertex) {
+    WriteVertex(
+        vertex.id, vertex.labels.size(),
+        [&] {
+          for (const auto &label : vertex.labels) WriteString(label);
+        },
+        vertex.properties.size(), [&] { WriteProperties(vertex.properties); }, vertex.element_id);
+  }
+
+  /**
+   * Writes a relationship from its parts, so that the caller doesn't have to
+   * build an Edge first.
+   *
+   * @param write_properties called once, has to write `properties_size`
+   *        name-value pairs
+   */
+  template <typename TWriteProperties>
+  void WriteEdge(Id id, Id from, Id to, std::string_view type, size_t properties_size,
+                 TWriteProperties &&write_properties, std::string_view element_id, std::string_view from_element_id,
+                 std::string_view to_element_id) {
+    int struct_n = 5 + 3 * int(major_v_ > 4);  // element_id introduced from v5
     WriteRAW(utils::UnderlyingCast(Marker::TinyStruct) + struct_n);
-    WriteRAW(utils::UnderlyingCast(unbound ? Signature::UnboundRelationship : Signature::Relationship));
+    WriteRAW(utils::UnderlyingCast(Signature::Relationship));
 
-    WriteInt(edge.id.AsInt());
-    if (!unbound) {
-      WriteInt(edge.from.AsInt());
-      WriteInt(edge.to.AsInt());
-    }
+    WriteInt(id.AsInt());
+    WriteInt(from.AsInt());
+    WriteInt(to.AsInt());
 
-    WriteString(edge.type);
+    WriteString(type);
 
-    const auto &props = edge.properties;
-    WriteTypeSize(props.size(), MarkerMap);
-    for (const auto &prop : props) {
-      WriteString(prop.first);
-      WriteValue(prop.second);
-    }
+    WriteTypeSize(properties_size, MarkerMap);
+    write_properties();
 
     if (major_v_ > 4) {
       // element_id introduced in v5.0
-      WriteString(edge.element_id);
-      if (!unbound) {
-        // from_element_id introduced in v5.0
-        WriteString(edge.from_element_id);
-        // to_element_id introduced in v5.0
-        WriteString(edge.to_element_id);
-      }
+      WriteString(element_id);
+      // from_element_id introduced in v5.0
+      WriteString(from_element_id);
+      // to_element_id introduced in v5.0
+      WriteString(to_element_id);
     }
   }
 
-  void WriteEdge(const UnboundedEdge &edge) {
+  /**
+   * Writes an unbound relationship from its parts, so that the caller doesn't
+   * have to build an UnboundedEdge first.
+   *
+   * @param write_properties called once, has to write `properties_size`
+   *        name-value pairs
+   */
+  template <typename TWriteProperties>
+  void WriteUnboundedEdge(Id id, std::string_view type, size_t properties_size, TWriteProperties &&write_properties,
+                          std::string_view element_id) {
     const int struct_n = 3 + 1 * int(major_v_ > 4);  // element_id introduced from v5
     WriteRAW(utils::UnderlyingCast(Marker::TinyStruct) + struct_n);
     WriteRAW(utils::UnderlyingCast(Signature::UnboundRelationship));
 
-    WriteInt(edge.id.AsInt());
+    WriteInt(id.AsInt());
 
-    WriteString(edge.type);
+    WriteString(type);
 
-    const auto &props = edge.properties;
-    WriteTypeSize(props.size(), MarkerMap);
-    for (const auto &prop : props) {
-      WriteString(prop.first);
-      WriteValue(prop.second);
-    }
+    WriteTypeSize(properties_size, MarkerMap);
+    write_properties();
 
     if (major_v_ > 4) {
       // element_id introduced in v5.0
-      WriteString(edge.element_id);
+      WriteString(element_id);
     }
   }
 
-  void WritePath(const Path &path) {
+  void WriteEdge(const Edge &edge, bool unbound = false) {
+    auto const write_properties = [&] { WriteProperties(edge.properties); };
+    if (unbound) {
+      WriteUnboundedEdge(edge.id, edge.type, edge.properties.size(), write_properties, edge.element_id);
+    } else {
+      WriteEdge(edge.id, edge.from, edge.to, edge.type, edge.properties.size(), write_properties, edge.element_id,
+                edge.from_element_id, edge.to_element_id);
+    }
+  }
+
+  void WriteEdge(const UnboundedEdge &edge) {
+    WriteUnboundedEdge(
+        edge.id, edge.type, edge.properties.size(), [&] { WriteProperties(edge.properties); }, edge.element_id);
+  }
+
+  /**
+   * Writes a path from its parts, so that the caller doesn't have to build a
+   * Path first.
+   *
+   * @param write_vertices called once, has to write `vertices_size` vertices
+   * @param write_edges called once, has to write `edges_size` unbound edges
+   */
+  template <typename TWriteVertices, typename TWriteEdges>
+  void WritePath(size_t vertices_size, TWriteVertices &&write_vertices, size_t edges_size, TWriteEdges &&write_edges,
+                 std::span<const int64_t> indices) {
     WriteRAW(utils::UnderlyingCast(Marker::TinyStruct) + 3);
     WriteRAW(utils::UnderlyingCast(Signature::Path));
-    WriteTypeSize(path.vertices.size(), MarkerList);
-    for (const auto &v : path.vertices) WriteVertex(v);
-    WriteTypeSize(path.edges.size(), MarkerList);
-    for (const auto &e : path.edges) WriteEdge(e);
-    WriteTypeSize(path.indices.size(), MarkerList);
-    for (const auto &i : path.indices) WriteInt(i);
+    WriteTypeSize(vertices_size, MarkerList);
+    write_vertices();
+    WriteTypeSize(edges_size, MarkerList);
+    write_edges();
+    WriteTypeSize(indices.size(), MarkerList);
+    for (const auto &i : indices) WriteInt(i);
+  }
+
+  void WritePath(const Path &path) {
+    WritePath(
+        path.vertices.size(),
+        [&] {
+          for (const auto &v : path.vertices) WriteVertex(v);
+        },
+        path.edges.size(),
+        [&] {
+          for (const auto &e : path.edges) WriteEdge(e);
+        },
+        path.indices);
   }
 
   void WriteDate(const utils::Date &date) {
@@ -244,7 +304,7 @@ class BaseEncoder {
     WriteInt(duration.SubSecondsAsNanoseconds());
   }
 
-  void WritePoint2d(const Point2d &point_2d) {
+  void WritePoint2d(const storage::Point2d &point_2d) {
     WriteRAW(utils::UnderlyingCast(Marker::TinyStruct3));
     WriteRAW(utils::UnderlyingCast(Signature::Point2d));
     WriteInt(storage::CrsToSrid(point_2d.crs()).value_of());
@@ -252,7 +312,7 @@ class BaseEncoder {
     WriteDouble(point_2d.y());
   }
 
-  void WritePoint3d(const Point3d &point_3d) {
+  void WritePoint3d(const storage::Point3d &point_3d) {
     WriteRAW(utils::UnderlyingCast(Marker::TinyStruct4));
     WriteRAW(utils::UnderlyingCast(Signature::Point3d));
     WriteInt(storage::CrsToSrid(point_3d.crs()).value_of());
@@ -363,6 +423,13 @@ class BaseEncoder {
   int major_v_;  //!< Major version of the underlying Bolt protocol (TODO: Think about reimplementing the versioning)
 
  private:
+  void WriteProperties(const map_t &properties) {
+    for (const auto &prop : properties) {
+      WriteString(prop.first);
+      WriteValue(prop.second);
+    }
+  }
+
   template <class T>
   void WritePrimitiveValue(T value) {
     value = utils::HostToBigEndian(value);
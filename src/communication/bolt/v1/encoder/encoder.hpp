@@ -14,6 +14,8 @@
 #include "communication/bolt/v1/codes.hpp"
 #include "communication/bolt/v1/encoder/base_encoder.hpp"
 
+#include <utility>
+
 namespace memgraph::communication::bolt {
 
 /**
@@ -57,6 +59,16 @@ class Encoder : private BaseEncoder<Buffer> {
 
   void MessageRecordAppendValue(const Value &value) { WriteValue(value); }
 
+  /**
+   * Appends a value to the current Record message by handing the underlying
+   * BaseEncoder to `write_value`. Lets the caller serialize its own types
+   * without converting them to Value first.
+   */
+  template <typename TWriteValue>
+  decltype(auto) MessageRecordAppend(TWriteValue &&write_value) {
+    return std::forward<TWriteValue>(write_value)(static_cast<BaseEncoder<Buffer> &>(*this));
+  }
+
   bool MessageRecordFinalize() {
     // Try to flush all remaining data in the buffer, but tell it that we will
     // send more data (the end of message chunk).
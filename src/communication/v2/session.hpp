@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <concepts>
 #include <cstddef>
 #include <cstdint>
@@ -47,6 +48,7 @@
 #include "communication/exceptions.hpp"
 #include "communication/fmt.hpp"
 #include "utils/event_counter.hpp"
+#include "utils/event_histogram.hpp"
 #include "utils/logging.hpp"
 #include "utils/on_scope_exit.hpp"
 #include "utils/priority_thread_pool.hpp"
@@ -59,6 +61,8 @@ extern const Event ActiveSessions;
 extern const Event ActiveTCPSessions;
 extern const Event ActiveSSLSessions;
 extern const Event ActiveWebSocketSessions;
+
+extern const Event BoltQueueingDelay_us;
 }  // namespace memgraph::metrics
 
 namespace memgraph::communication::v2 {
@@ -392,13 +396,23 @@ class Session final : public std::enable_shared_from_this<Session<TSession, TSes
 
   void DoWork() {
     session_context_->AddTask(
-        [shared_this = shared_from_this()](const auto thread_priority) {
+        [shared_this = shared_from_this(), queued_at = std::chrono::steady_clock::now()](const auto thread_priority) {
+          const auto queueing_delay = std::chrono::steady_clock::now() - queued_at;
+          metrics::Measure(metrics::BoltQueueingDelay_us,
+                           std::chrono::duration_cast<std::chrono::microseconds>(queueing_delay).count());
+          // Database over its worker quota; the task is rescheduled once one of its workers frees up
+          const auto quota = shared_this->session_.GetWorkerQuota();
+          if (quota && !quota->TryAcquire([shared_this] { shared_this->DoWork(); })) return;
+          const utils::OnScopeExit release_quota{[&quota] {
+            if (quota) quota->Release();
+          }};
           try {
             while (true) {
               if (shared_this->session_.Execute()) {
                 // Check if we can just steal this task (loop through)
-                if (thread_priority > shared_this->session_.ApproximateQueryPriority()) {
-                  // Task priority lower; reschedule
+                if (thread_priority > shared_this->session_.ApproximateQueryPriority() ||
+                    quota != shared_this->session_.GetWorkerQuota()) {
+                  // Task priority lower or the next query needs another quota; reschedule
                   shared_this->DoWork();
                   return;
                 }
@@ -10,7 +10,12 @@
 // licenses/APL.txt.
 
 #include "dbms/database.hpp"
+
+#include <limits>
+
 #include "dbms/inmemory/storage_helper.hpp"
+#include "flags/bolt.hpp"
+#include "flags/memory_limit.hpp"
 #include "storage/v2/disk/storage.hpp"
 #include "storage/v2/storage_mode.hpp"
 
@@ -23,7 +28,14 @@ Database::Database(storage::Config config,
     : trigger_store_(config.durability.storage_directory / "triggers"),
       streams_{config.durability.storage_directory / "streams"},
       time_to_live_{config.durability.storage_directory / "ttl"},
-      plan_cache_{FLAGS_query_plan_cache_max_size} {
+      worker_quota_{std::make_shared<utils::WorkerQuota>(FLAGS_bolt_num_workers_per_database)},
+      plan_cache_{FLAGS_query_plan_cache_max_size, FLAGS_query_plan_cache_max_bytes == 0
+                                                      ? std::numeric_limits<std::size_t>::max()
+                                                      : FLAGS_query_plan_cache_max_bytes} {
+  if (const auto memory_limit = flags::GetMemoryLimitPerDatabase(); memory_limit > 0) {
+    query_memory_tracker_.SetMaximumHardLimit(memory_limit);
+    query_memory_tracker_.SetHardLimit(memory_limit);
+  }
   if (config.salient.storage_mode == memgraph::storage::StorageMode::ON_DISK_TRANSACTIONAL || config.force_on_disk ||
       utils::DirExists(config.disk.main_storage_directory)) {
     config.salient.storage_mode = memgraph::storage::StorageMode::ON_DISK_TRANSACTIONAL;
@@ -19,6 +19,8 @@
 #include "query/trigger.hpp"
 #include "storage/v2/storage.hpp"
 #include "utils/gatekeeper.hpp"
+#include "utils/memory_tracker.hpp"
+#include "utils/worker_quota.hpp"
 
 namespace memgraph::dbms {
 
@@ -155,6 +157,13 @@ class Database {
    */
   void AddTask(std::function<void()> new_task) { after_commit_trigger_pool_.AddTask(std::move(new_task)); }
 
+  /**
+   * @brief Returns the transactions waiting for a batched run of the after commit triggers
+   *
+   * @return query::AfterCommitTriggerBatch*
+   */
+  query::AfterCommitTriggerBatch *after_commit_trigger_batch() { return &after_commit_trigger_batch_; }
+
   /**
    * @brief Returns the PlanCache vector raw pointer
    *
@@ -164,6 +173,22 @@ class Database {
 
   query::ttl::TTL &ttl() { return time_to_live_; }
 
+  /**
+   * @brief Returns the limit on Bolt workers concurrently executing this database's queries
+   *
+   * @return std::shared_ptr<utils::WorkerQuota>
+   */
+  std::shared_ptr<utils::WorkerQuota> worker_quota() const { return worker_quota_; }
+
+  /**
+   * @brief Returns the tracker shared by all queries of this database, if the database has a memory limit
+   *
+   * @return utils::MemoryTracker* nullptr when the database's queries are not limited
+   */
+  utils::MemoryTracker *query_memory_tracker() {
+    return query_memory_tracker_.HardLimit() ? &query_memory_tracker_ : nullptr;
+  }
+
   /**
    * @brief Useful when trying to gracefully destroy Database.
    *
@@ -179,11 +204,14 @@ class Database {
   }
 
  private:
-  std::unique_ptr<storage::Storage> storage_;       //!< Underlying storage
-  query::TriggerStore trigger_store_;               //!< Triggers associated with the storage
-  utils::ThreadPool after_commit_trigger_pool_{1};  //!< Thread pool for executing after commit triggers
-  query::stream::Streams streams_;                  //!< Streams associated with the storage
-  query::ttl::TTL time_to_live_;                    //!< TTL associated with the storage
+  std::unique_ptr<storage::Storage> storage_;                  //!< Underlying storage
+  query::TriggerStore trigger_store_;                          //!< Triggers associated with the storage
+  query::AfterCommitTriggerBatch after_commit_trigger_batch_;  //!< Transactions waiting for after commit triggers
+  utils::ThreadPool after_commit_trigger_pool_{1};             //!< Thread pool for executing after commit triggers
+  query::stream::Streams streams_;                             //!< Streams associated with the storage
+  query::ttl::TTL time_to_live_;                               //!< TTL associated with the storage
+  std::shared_ptr<utils::WorkerQuota> worker_quota_;           //!< Bolt workers available to the database
+  utils::MemoryTracker query_memory_tracker_;                  //!< Memory used by all queries of the database
 
   // TODO: Move to a better place
   query::PlanCacheLRU plan_cache_;  //!< Plan cache associated with the storage
@@ -25,10 +25,16 @@
 #include "utils/observer.hpp"
 
 #include <spdlog/spdlog.h>
+#include <atomic>
 #include <cstdint>
+#include <exception>
 #include <optional>
+#include <range/v3/algorithm/any_of.hpp>
 #include <range/v3/view/filter.hpp>
 #include <range/v3/view/transform.hpp>
+#include <thread>
+#include <unordered_set>
+#include <vector>
 
 #include "storage/v2/durability/paths.hpp"
 
@@ -156,6 +162,8 @@ auto CreateBackupDirectories(std::filesystem::path const &current_snapshot_dir,
 }
 
 constexpr uint32_t kDeltasBatchProgressSize = 100000;
+// Number of deltas of a streamed transaction which are read before they are applied
+constexpr uint64_t kStreamedDeltasChunk = 1000;
 
 std::pair<uint64_t, WalDeltaData> ReadDelta(storage::durability::BaseDecoder *decoder, const uint64_t version) {
   try {
@@ -204,6 +212,27 @@ void LogWrongMain(const std::optional<utils::UUID> &current_main_uuid, const uti
 }
 }  // namespace
 
+// Deltas of a single transaction read from the stream. Deltas are applied to the transaction's accessor separately
+// from committing it, so that transactions which don't touch the same objects can be applied concurrently.
+struct InMemoryReplicationHandlers::ReplicaTransaction {
+  // Deltas read but not applied yet; deltas already durable on the replica are skipped while reading
+  std::vector<std::pair<uint64_t, storage::durability::WalDeltaData>> deltas;
+  uint64_t deltas_read{0};  // Includes skipped deltas
+  uint64_t deltas_applied{0};
+  uint64_t durable_timestamp{0};
+  uint64_t max_timestamp{0};
+  // Vertices and edges read or modified by the transaction
+  std::vector<storage::Gid> vertices;
+  std::vector<storage::Gid> edges;
+  // Metadata deltas need unique access and edge property deltas from older versions don't name the edge's vertex, so
+  // transactions containing them are never applied concurrently with other transactions
+  bool sequential{false};
+  // Streamed transactions are applied on their own while they are read, so their vertices and edges aren't tracked
+  bool streamed{false};
+  bool transaction_end_applied{false};
+  std::optional<std::pair<uint64_t, storage::InMemoryStorage::ReplicationAccessor>> commit_timestamp_and_accessor;
+};
+
 void InMemoryReplicationHandlers::Register(dbms::DbmsHandler *dbms_handler, replication::RoleReplicaData &data) {
   auto &server = *data.server;
   server.rpc_server_.Register<storage::replication::HeartbeatRpc>(
@@ -745,13 +774,56 @@ std::pair<bool, uint32_t> InMemoryReplicationHandlers::LoadWal(storage::InMemory
     }
     wal_decoder.SetPosition(wal_info.offset_deltas);
 
+    // Consecutive transactions which don't touch the same vertices or edges are gathered into a group whose deltas
+    // are applied on multiple threads. The group is then committed in the original order, so readers on the replica
+    // observe the same sequence of commits as on main. A transaction that conflicts with the group closes it.
+    auto const thread_count = storage->config_.durability.recovery_thread_count;
+    std::vector<ReplicaTransaction> group;
+    std::unordered_set<storage::Gid> group_vertices;
+    std::unordered_set<storage::Gid> group_edges;
+    uint64_t group_deltas = 0;
+    auto const apply_group = [&] {
+      ApplyAndCommitTransactions(storage, &group, thread_count);
+      group.clear();
+      group_vertices.clear();
+      group_edges.clear();
+      group_deltas = 0;
+    };
+    auto const conflicts_with_group = [&](ReplicaTransaction const &txn) {
+      return r::any_of(txn.vertices, [&](auto const gid) { return group_vertices.contains(gid); }) ||
+             r::any_of(txn.edges, [&](auto const gid) { return group_edges.contains(gid); });
+    };
+
     uint32_t local_batch_counter = start_batch_counter;
     for (size_t local_delta_idx = 0; local_delta_idx < wal_info.num_deltas;) {
-      auto const [current_delta_idx, current_batch_counter] =
-          ReadAndApplyDeltasSingleTxn(storage, &wal_decoder, *version, res_builder, local_batch_counter);
-      local_delta_idx += current_delta_idx;
-      local_batch_counter = current_batch_counter;
+      ReplicaTransaction txn;
+      // Transactions too large to read ahead are applied while the rest of them is being read
+      if (!ReadTransaction(storage, &wal_decoder, *version, res_builder, &local_batch_counter, &txn,
+                           kDeltasBatchProgressSize)) {
+        apply_group();
+        StreamTransaction(storage, &wal_decoder, *version, res_builder, &local_batch_counter, &txn, false);
+        CommitTransaction(storage, &txn);
+        local_delta_idx += txn.deltas_read;
+        continue;
+      }
+      local_delta_idx += txn.deltas_read;
+
+      if (thread_count < 2 || txn.sequential) {
+        apply_group();
+        ApplyTransaction(storage, &txn);
+        CommitTransaction(storage, &txn);
+        continue;
+      }
+      if (conflicts_with_group(txn)) apply_group();
+
+      group_vertices.insert(txn.vertices.begin(), txn.vertices.end());
+      group_edges.insert(txn.edges.begin(), txn.edges.end());
+      group_deltas += txn.deltas.size();
+      group.push_back(std::move(txn));
+      // Bounds the memory held by deltas read ahead
+      if (group_deltas >= kDeltasBatchProgressSize) apply_group();
     }
+    apply_group();
 
     spdlog::trace("Replication from WAL file {} successful!", *maybe_wal_path);
     return {true, local_batch_counter};
@@ -764,17 +836,102 @@ std::pair<bool, uint32_t> InMemoryReplicationHandlers::LoadWal(storage::InMemory
   }
 }
 
-// The number of applied deltas also includes skipped deltas.
-std::pair<uint64_t, uint32_t> InMemoryReplicationHandlers::ReadAndApplyDeltasSingleTxn(
-    storage::InMemoryStorage *storage, storage::durability::BaseDecoder *decoder, const uint64_t version,
-    slk::Builder *res_builder, uint32_t const start_batch_counter) {
+bool InMemoryReplicationHandlers::ReadTransaction(storage::InMemoryStorage *storage,
+                                                  storage::durability::BaseDecoder *decoder, const uint64_t version,
+                                                  slk::Builder *res_builder, uint32_t *batch_counter,
+                                                  ReplicaTransaction *txn, uint64_t const max_deltas) {
+  // NOLINTNEXTLINE (google-build-using-namespace)
+  using namespace memgraph::storage::durability;
+  if (txn->deltas_read == 0) {
+    txn->durable_timestamp = txn->max_timestamp = storage->repl_storage_state_.last_durable_timestamp_.load();
+    spdlog::trace("Current durable commit timestamp: {}", txn->durable_timestamp);
+  }
+
+  uint64_t prev_printed_timestamp = 0;
+
+  bool transaction_complete = false;
+  for (; !transaction_complete && txn->deltas.size() < max_deltas; ++txn->deltas_read, ++*batch_counter) {
+    if (*batch_counter == kDeltasBatchProgressSize) {
+      spdlog::trace("Sending in progress msg");
+      rpc::SendInProgressMsg(res_builder);
+      *batch_counter = 0;
+    }
+
+    auto [delta_timestamp, delta] = ReadDelta(decoder, version);
+    if (delta_timestamp != prev_printed_timestamp) {
+      spdlog::trace("Timestamp: {}", delta_timestamp);
+      prev_printed_timestamp = delta_timestamp;
+    }
+
+    txn->max_timestamp = std::max(txn->max_timestamp, delta_timestamp);
+
+    transaction_complete = IsWalDeltaDataTransactionEnd(delta, version);
+
+    if (delta_timestamp <= txn->durable_timestamp) {
+      spdlog::trace("Skipping delta with timestamp: {}", delta_timestamp);
+      continue;
+    }
+
+    if (txn->streamed) {
+      txn->deltas.emplace_back(delta_timestamp, std::move(delta));
+      continue;
+    }
+    std::visit(utils::Overloaded{
+                   [&](WalVertexCreate const &data) { txn->vertices.push_back(data.gid); },
+                   [&](WalVertexDelete const &data) { txn->vertices.push_back(data.gid); },
+                   [&](WalVertexAddLabel const &data) { txn->vertices.push_back(data.gid); },
+                   [&](WalVertexRemoveLabel const &data) { txn->vertices.push_back(data.gid); },
+                   [&](WalVertexSetProperty const &data) { txn->vertices.push_back(data.gid); },
+                   [&](WalEdgeCreate const &data) {
+                     txn->edges.push_back(data.gid);
+                     txn->vertices.push_back(data.from_vertex);
+                     txn->vertices.push_back(data.to_vertex);
+                   },
+                   [&](WalEdgeDelete const &data) {
+                     txn->edges.push_back(data.gid);
+                     txn->vertices.push_back(data.from_vertex);
+                     txn->vertices.push_back(data.to_vertex);
+                   },
+                   [&](WalEdgeSetProperty const &data) {
+                     txn->edges.push_back(data.gid);
+                     if (data.from_gid) {
+                       txn->vertices.push_back(*data.from_gid);
+                     } else {
+                       txn->sequential = true;
+                     }
+                   },
+                   [](WalTransactionEnd const &) {},
+                   [&](auto const &) { txn->sequential = true; },
+               },
+               delta.data_);
+    txn->deltas.emplace_back(delta_timestamp, std::move(delta));
+  }
+  return transaction_complete;
+}
+
+void InMemoryReplicationHandlers::StreamTransaction(storage::InMemoryStorage *storage,
+                                                    storage::durability::BaseDecoder *decoder, const uint64_t version,
+                                                    slk::Builder *res_builder, uint32_t *batch_counter,
+                                                    ReplicaTransaction *txn, bool read_complete) {
+  txn->streamed = true;
+  txn->vertices = {};
+  txn->edges = {};
+  while (true) {
+    ApplyTransaction(storage, txn);
+    if (read_complete) return;
+    read_complete = ReadTransaction(storage, decoder, version, res_builder, batch_counter, txn, kStreamedDeltasChunk);
+  }
+}
+
+void InMemoryReplicationHandlers::ApplyTransaction(storage::InMemoryStorage *storage, ReplicaTransaction *txn) {
+  if (txn->deltas.empty()) return;
   auto edge_acc = storage->edges_.access();
   auto vertex_acc = storage->vertices_.access();
 
   constexpr auto kSharedAccess = storage::Storage::Accessor::Type::WRITE;
   constexpr auto kUniqueAccess = storage::Storage::Accessor::Type::UNIQUE;
 
-  std::optional<std::pair<uint64_t, storage::InMemoryStorage::ReplicationAccessor>> commit_timestamp_and_accessor;
+  auto &commit_timestamp_and_accessor = txn->commit_timestamp_and_accessor;
   auto const get_replication_accessor = [storage, &commit_timestamp_and_accessor](
                                             uint64_t commit_timestamp,
                                             storage::Storage::Accessor::Type acc_type =
@@ -806,37 +963,8 @@ std::pair<uint64_t, uint32_t> InMemoryReplicationHandlers::ReadAndApplyDeltasSin
     return &commit_timestamp_and_accessor->second;
   };
 
-  uint64_t current_delta_idx = 0;  // tracks over how many deltas we iterated, includes also skipped deltas.
-  uint64_t applied_deltas = 0;     // Non-skipped deltas
-  uint32_t current_batch_counter = start_batch_counter;
-  auto max_delta_timestamp = storage->repl_storage_state_.last_durable_timestamp_.load();
-
-  auto current_durable_commit_timestamp = max_delta_timestamp;
-  spdlog::trace("Current durable commit timestamp: {}", current_durable_commit_timestamp);
-
-  uint64_t prev_printed_timestamp = 0;
-
-  for (bool transaction_complete = false; !transaction_complete; ++current_delta_idx, ++current_batch_counter) {
-    if (current_batch_counter == kDeltasBatchProgressSize) {
-      spdlog::trace("Sending in progress msg");
-      rpc::SendInProgressMsg(res_builder);
-      current_batch_counter = 0;
-    }
-
-    const auto [delta_timestamp, delta] = ReadDelta(decoder, version);
-    if (delta_timestamp != prev_printed_timestamp) {
-      spdlog::trace("Timestamp: {}", delta_timestamp);
-      prev_printed_timestamp = delta_timestamp;
-    }
-
-    max_delta_timestamp = std::max(max_delta_timestamp, delta_timestamp);
-
-    transaction_complete = IsWalDeltaDataTransactionEnd(delta, version);
-
-    if (delta_timestamp <= current_durable_commit_timestamp) {
-      spdlog::trace("Skipping delta with timestamp: {}", delta_timestamp);
-      continue;
-    }
+  for (auto const &[delta_timestamp, delta] : txn->deltas) {
+    auto const current_delta_idx = txn->deltas_applied++;
 
     // NOLINTNEXTLINE (google-build-using-namespace)
     auto to_propertyid = [&](std::string_view prop_name) { return storage->NameToProperty(prop_name); };
@@ -1049,10 +1177,7 @@ std::pair<uint64_t, uint32_t> InMemoryReplicationHandlers::ReadAndApplyDeltasSin
           spdlog::trace("   Delta {}. Transaction end", current_delta_idx);
           if (!commit_timestamp_and_accessor || commit_timestamp_and_accessor->first != delta_timestamp)
             throw utils::BasicException("Invalid commit data!");
-          auto ret = commit_timestamp_and_accessor->second.Commit(
-              {.desired_commit_timestamp = commit_timestamp_and_accessor->first, .is_main = false});
-          if (ret.HasError()) throw utils::BasicException("Committing failed on receiving transaction end delta.");
-          commit_timestamp_and_accessor = std::nullopt;
+          txn->transaction_end_applied = true;
         },
         [&](WalLabelIndexCreate const &data) {
           spdlog::trace("   Delta {}. Create label index on :{}", current_delta_idx, data.label);
@@ -1331,14 +1456,70 @@ std::pair<uint64_t, uint32_t> InMemoryReplicationHandlers::ReadAndApplyDeltasSin
     };
 
     std::visit(delta_apply, delta.data_);
-    applied_deltas++;
   }
 
-  if (commit_timestamp_and_accessor) throw utils::BasicException("Did not finish the transaction!");
+  spdlog::debug("Applied {} deltas", txn->deltas.size());
+  txn->deltas.clear();
+}
+
+void InMemoryReplicationHandlers::CommitTransaction(storage::InMemoryStorage *storage, ReplicaTransaction *txn) {
+  if (auto &commit_timestamp_and_accessor = txn->commit_timestamp_and_accessor) {
+    if (!txn->transaction_end_applied) throw utils::BasicException("Did not finish the transaction!");
+    auto ret = commit_timestamp_and_accessor->second.Commit(
+        {.desired_commit_timestamp = commit_timestamp_and_accessor->first, .is_main = false});
+    if (ret.HasError()) throw utils::BasicException("Committing failed on receiving transaction end delta.");
+    commit_timestamp_and_accessor = std::nullopt;
+  }
+
+  storage->repl_storage_state_.last_durable_timestamp_ = txn->max_timestamp;
+}
+
+void InMemoryReplicationHandlers::ApplyAndCommitTransactions(storage::InMemoryStorage *storage,
+                                                             std::vector<ReplicaTransaction> *transactions,
+                                                             uint64_t const thread_count) {
+  if (transactions->empty()) return;
+
+  // Transactions are taken in order, so every transaction before the first failed one gets applied and committed
+  std::vector<std::exception_ptr> errors(transactions->size());
+  {
+    std::atomic<uint64_t> next_transaction{0};
+    std::atomic_bool failed{false};
+    auto const apply = [&] {
+      while (!failed.load(std::memory_order_acquire)) {
+        auto const idx = next_transaction++;
+        if (idx >= transactions->size()) return;
+        try {
+          ApplyTransaction(storage, &(*transactions)[idx]);
+        } catch (...) {
+          errors[idx] = std::current_exception();
+          failed.store(true, std::memory_order_release);
+        }
+      }
+    };
 
-  storage->repl_storage_state_.last_durable_timestamp_ = max_delta_timestamp;
+    auto const worker_count = std::min<uint64_t>(thread_count, transactions->size());
+    std::vector<std::jthread> threads;
+    threads.reserve(worker_count - 1);
+    for (uint64_t i = 1; i < worker_count; ++i) {
+      threads.emplace_back(apply);
+    }
+    apply();
+  }
+
+  for (size_t i = 0; i < transactions->size(); ++i) {
+    if (errors[i]) std::rethrow_exception(errors[i]);
+    CommitTransaction(storage, &(*transactions)[i]);
+  }
+}
 
-  spdlog::debug("Applied {} deltas", applied_deltas);
-  return {current_delta_idx, current_batch_counter};
+// The number of applied deltas also includes skipped deltas.
+std::pair<uint64_t, uint32_t> InMemoryReplicationHandlers::ReadAndApplyDeltasSingleTxn(
+    storage::InMemoryStorage *storage, storage::durability::BaseDecoder *decoder, const uint64_t version,
+    slk::Builder *res_builder, uint32_t const start_batch_counter) {
+  uint32_t current_batch_counter = start_batch_counter;
+  ReplicaTransaction txn;
+  StreamTransaction(storage, decoder, version, res_builder, &current_batch_counter, &txn, false);
+  CommitTransaction(storage, &txn);
+  return {txn.deltas_read, current_batch_counter};
 }
 }  // namespace memgraph::dbms
@@ -14,6 +14,8 @@
 #include "replication/state.hpp"
 #include "storage/v2/replication/serialization.hpp"
 
+#include <vector>
+
 namespace memgraph::storage {
 class InMemoryStorage;
 }  // namespace memgraph::storage
@@ -46,6 +48,8 @@ class InMemoryReplicationHandlers {
   static void SwapMainUUIDHandler(dbms::DbmsHandler *dbms_handler, replication::RoleReplicaData &role_replica_data,
                                   slk::Reader *req_reader, slk::Builder *res_builder);
 
+  struct ReplicaTransaction;
+
   static std::pair<bool, uint32_t> LoadWal(storage::InMemoryStorage *storage, storage::replication::Decoder *decoder,
                                            slk::Builder *res_builder, uint32_t start_batch_counter = 0);
 
@@ -53,6 +57,26 @@ class InMemoryReplicationHandlers {
                                                                    storage::durability::BaseDecoder *decoder,
                                                                    uint64_t version, slk::Builder *,
                                                                    uint32_t start_batch_counter = 0);
+
+  // Reads deltas of the transaction until its end or until `max_deltas` deltas are waiting to be applied. Returns
+  // whether the end of the transaction was read.
+  static bool ReadTransaction(storage::InMemoryStorage *storage, storage::durability::BaseDecoder *decoder,
+                              uint64_t version, slk::Builder *res_builder, uint32_t *batch_counter,
+                              ReplicaTransaction *txn, uint64_t max_deltas);
+
+  // Applies the deltas read so far, then reads and applies the rest of the transaction in small chunks
+  static void StreamTransaction(storage::InMemoryStorage *storage, storage::durability::BaseDecoder *decoder,
+                                uint64_t version, slk::Builder *res_builder, uint32_t *batch_counter,
+                                ReplicaTransaction *txn, bool read_complete);
+
+  // Applies the deltas of the transaction without committing it
+  static void ApplyTransaction(storage::InMemoryStorage *storage, ReplicaTransaction *txn);
+
+  static void CommitTransaction(storage::InMemoryStorage *storage, ReplicaTransaction *txn);
+
+  // Applies non-conflicting transactions on up to `thread_count` threads and commits them in order
+  static void ApplyAndCommitTransactions(storage::InMemoryStorage *storage,
+                                         std::vector<ReplicaTransaction> *transactions, uint64_t thread_count);
 };
 
 }  // namespace memgraph::dbms
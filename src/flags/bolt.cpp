@@ -28,6 +28,11 @@ DEFINE_VALIDATED_int32(bolt_num_workers, std::max(std::thread::hardware_concurre
                        "Number of workers used by the Bolt server. By default, this will be the "
                        "number of processing units available on the machine.",
                        FLAG_IN_RANGE(1, INT32_MAX));
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint32(bolt_num_workers_per_database, 0,
+              "Maximum number of Bolt workers that can execute Cypher queries of a single database at the same time. "
+              "Sessions over the limit wait for one of their database's workers instead of taking workers from other "
+              "databases. Set to 0 to not limit it.");
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables, misc-unused-parameters)
 DEFINE_VALIDATED_int32(bolt_session_inactivity_timeout, 1800,
                        "Time in seconds after which inactive Bolt sessions will be closed.", {
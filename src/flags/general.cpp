@@ -82,6 +82,11 @@ DEFINE_bool(storage_wal_enabled, false,
 DEFINE_VALIDATED_uint64(storage_snapshot_retention_count, 3, "The number of snapshots that should always be kept.",
                         FLAG_IN_RANGE(1, 1000000));
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(storage_snapshot_incremental_layers, 0,
+                        "The number of incremental snapshots, containing only the data changed since the previous "
+                        "snapshot, written between two full snapshots. 0 means every snapshot is a full one.",
+                        FLAG_IN_RANGE(0, 1000));
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_VALIDATED_uint64(storage_wal_file_size_kib, memgraph::storage::Config::Durability().wal_file_size_kibibytes,
                         "Minimum file size of each WAL file.",
                         FLAG_IN_RANGE(1, static_cast<unsigned long>(1000) * 1024));
@@ -167,6 +172,11 @@ DEFINE_uint32(
     stream_transaction_retry_interval, 500,
     "Retry interval in milliseconds when a stream transformation fails to commit because of conflicting transactions");
 // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(stream_batch_queries, false,
+            "Set to true to execute consecutive queries with the same text returned by a stream transformation as a "
+            "single UNWIND over their parameters. The batched queries don't see each other's changes, except through "
+            "MERGE.");
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_string(kafka_bootstrap_servers, "",
               "List of default Kafka brokers as a comma separated list of broker host or host:port.");
 
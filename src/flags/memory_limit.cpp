@@ -1,4 +1,4 @@
-// Copyright 2023 Memgraph Ltd.
+// Copyright 2025 Memgraph Ltd.
 //
 // Use of this software is governed by the Business Source License
 // included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -21,6 +21,12 @@ DEFINE_uint64(
     "Total memory limit in MiB. Set to 0 to use the default values which are 100\% of the phyisical memory if the swap "
     "is enabled and 90\% of the physical memory otherwise.");
 
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(memory_limit_per_database, 0,
+              "Memory limit in MiB shared by all queries running on a single database at the same time, on top of "
+              "the limits of the queries themselves. When set, every query's allocations are tracked, not only "
+              "those of queries with their own limit. Set to 0 to not limit it.");
+
 int64_t memgraph::flags::GetMemoryLimit() {
   if (FLAGS_memory_limit == 0) {
     auto maybe_total_memory = memgraph::utils::sysinfo::TotalMemory();
@@ -39,3 +45,8 @@ int64_t memgraph::flags::GetMemoryLimit() {
   // We parse the memory as MiB every time
   return FLAGS_memory_limit * 1024 * 1024;
 }
+
+int64_t memgraph::flags::GetMemoryLimitPerDatabase() {
+  // We parse the memory as MiB every time
+  return static_cast<int64_t>(FLAGS_memory_limit_per_database * 1024 * 1024);
+}
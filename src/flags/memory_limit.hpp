@@ -1,4 +1,4 @@
-// Copyright 2023 Memgraph Ltd.
+// Copyright 2025 Memgraph Ltd.
 //
 // Use of this software is governed by the Business Source License
 // included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -14,4 +14,6 @@
 
 namespace memgraph::flags {
 int64_t GetMemoryLimit();
+// Memory limit in bytes shared by the queries of a database, 0 if not limited
+int64_t GetMemoryLimitPerDatabase();
 }  // namespace memgraph::flags
@@ -1,4 +1,4 @@
-// Copyright 2024 Memgraph Ltd.
+// Copyright 2025 Memgraph Ltd.
 //
 // Use of this software is governed by the Business Source License
 // included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -12,3 +12,12 @@
 
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 // DEFINE_bool(cartesian_product_enabled, true, "Enable cartesian product expansion.");  Moved to run_time_configurable
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(query_log_slow_threshold_ms, 0,
+              "Queries whose execution takes at least this many milliseconds are written to the slow query log "
+              "in the data directory, together with their plan. 0 disables the latency threshold.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(query_log_slow_memory_threshold_mb, 0,
+              "Queries that allocate at least this many MiB are written to the slow query log. Only queries run "
+              "with a memory limit track their allocations. 0 disables the memory threshold.");
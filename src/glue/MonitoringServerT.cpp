@@ -10,4 +10,5 @@
 // licenses/APL.txt.
 #include "glue/MonitoringServerT.hpp"
 
-template class memgraph::communication::http::Server<memgraph::http::MetricsRequestHandler, memgraph::storage::Storage>;
+template class memgraph::communication::http::Server<memgraph::http::MetricsRequestHandler,
+                                                     memgraph::dbms::DbmsHandler>;
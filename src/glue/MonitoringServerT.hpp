@@ -11,14 +11,14 @@
 #pragma once
 
 #include "communication/http/server.hpp"
+#include "dbms/dbms_handler.hpp"
 #include "http_handlers/metrics.hpp"
-#include "storage/v2/storage.hpp"
 
 extern template class memgraph::communication::http::Server<memgraph::http::MetricsRequestHandler,
-                                                            memgraph::storage::Storage>;
+                                                            memgraph::dbms::DbmsHandler>;
 
 namespace memgraph::glue {
 
 using MonitoringServerT =
-    memgraph::communication::http::Server<memgraph::http::MetricsRequestHandler, memgraph::storage::Storage>;
+    memgraph::communication::http::Server<memgraph::http::MetricsRequestHandler, memgraph::dbms::DbmsHandler>;
 }  // namespace memgraph::glue
@@ -20,6 +20,7 @@
 #include "frontend/ast/ast.hpp"
 #include "glue/SessionHL.hpp"
 #include "glue/auth_checker.hpp"
+#include "glue/bolt_value_encoder.hpp"
 #include "glue/communication.hpp"
 #include "glue/run_id.hpp"
 #include "license/license.hpp"
@@ -59,8 +60,8 @@ auto ToQueryExtras(const memgraph::glue::bolt_value_t &extra) -> memgraph::query
   return memgraph::query::QueryExtras{std::move(metadata_pv), tx_timeout, is_read};
 }
 
-/// Wrapper around TEncoder which converts TypedValue to Value
-/// before forwarding the calls to original TEncoder.
+/// Wrapper around TEncoder which encodes TypedValue straight into the
+/// original TEncoder, without converting it to Value first.
 template <typename TEncoder>
 class TypedValueResultStream {
  public:
@@ -71,9 +72,11 @@ class TypedValueResultStream {
     // Splitting the MessageRecord allows us to skip vector insertion and just directly encode the value
     encoder_->MessageRecordHeader(values.size());
     for (const auto &v : values) {
-      auto maybe_value = memgraph::glue::ToBoltValue(v, storage_, memgraph::storage::View::NEW);
-      if (maybe_value.HasError()) {
-        switch (maybe_value.GetError()) {
+      auto maybe_written = encoder_->MessageRecordAppend([&](auto &base_encoder) {
+        return memgraph::glue::BoltValueEncoder{base_encoder, storage_, memgraph::storage::View::NEW}.Write(v);
+      });
+      if (maybe_written.HasError()) {
+        switch (maybe_written.GetError()) {
           case memgraph::storage::Error::DELETED_OBJECT:
             throw memgraph::communication::bolt::ClientError("Returning a deleted object as a result.");
           case memgraph::storage::Error::NONEXISTENT_OBJECT:
@@ -84,7 +87,6 @@ class TypedValueResultStream {
             throw memgraph::communication::bolt::ClientError("Unexpected storage error when streaming results.");
         }
       }
-      encoder_->MessageRecordAppendValue(maybe_value.GetValue());
     }
     if (!encoder_->MessageRecordFinalize()) {
       throw memgraph::communication::bolt::ClientError("Failed to send result to client!");
@@ -92,7 +94,7 @@ class TypedValueResultStream {
   }
 
  private:
-  // NOTE: Needed only for ToBoltValue conversions
+  // NOTE: Needed only for vertex, edge, path, graph and enum encoding
   memgraph::storage::Storage *storage_;
   TEncoder *encoder_;
 };
@@ -195,6 +197,12 @@ utils::Priority SessionHL::ApproximateQueryPriority() const {
                                                                 : utils::Priority::HIGH;
 }
 
+std::shared_ptr<utils::WorkerQuota> SessionHL::GetWorkerQuota() const {
+  if (ApproximateQueryPriority() == utils::Priority::HIGH) return {};
+  if (!interpreter_.current_db_.db_acc_) return {};
+  return interpreter_.current_db_.db_acc_->get()->worker_quota();
+}
+
 void SessionHL::TryDefaultDB() {
 #ifdef MG_ENTERPRISE
   const auto default_db = GetDefaultDB();
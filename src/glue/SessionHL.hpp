@@ -17,6 +17,7 @@
 #include "communication/v2/session.hpp"
 #include "glue/SessionContext.hpp"
 #include "query/interpreter.hpp"
+#include "utils/worker_quota.hpp"
 
 namespace memgraph::glue {
 
@@ -106,6 +107,9 @@ class SessionHL final : public memgraph::communication::bolt::Session<memgraph::
 
   utils::Priority ApproximateQueryPriority() const;
 
+  // Quota of the database the next query runs on; none for high priority queries so they aren't stuck behind it
+  std::shared_ptr<utils::WorkerQuota> GetWorkerQuota() const;
+
   inline bool Execute() { return Execute_(*this); }
 
  private:
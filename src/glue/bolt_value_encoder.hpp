@@ -0,0 +1,407 @@
+// Copyright 2026 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+/// @file Serialization of query results straight into a Bolt encoder.
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "communication/bolt/v1/codes.hpp"
+#include "communication/bolt/v1/exceptions.hpp"
+#include "communication/bolt/v1/mg_types.hpp"
+#include "communication/bolt/v1/value.hpp"
+#include "query/graph.hpp"
+#include "query/path.hpp"
+#include "query/typed_value.hpp"
+#include "storage/v2/edge_accessor.hpp"
+#include "storage/v2/property_value.hpp"
+#include "storage/v2/result.hpp"
+#include "storage/v2/storage.hpp"
+#include "storage/v2/temporal.hpp"
+#include "storage/v2/vertex_accessor.hpp"
+#include "storage/v2/view.hpp"
+#include "utils/temporal.hpp"
+
+namespace memgraph::glue {
+
+/// Writes query::TypedValue into a communication::bolt::BaseEncoder without converting it to a
+/// communication::bolt::Value first. The encoded bytes are the same as those of
+/// `encoder.WriteValue(*ToBoltValue(value, db, view))`, but label, edge type and property names are written straight
+/// from the name id mapper, and query values are written from the TypedValue itself, so they are not copied into a
+/// Value first. Vertex and edge properties are still copied once, into the map returned by the storage accessor's
+/// Properties(), and written from there.
+///
+/// Vertices and edges are read completely before any of their bytes are written, which is why their properties are
+/// copied rather than streamed from the property store. An error (e.g. a deleted object) can still leave the
+/// enclosing list, map or path partially written, same as with the Value based encoding, and the caller is expected
+/// to discard the message.
+///
+/// @tparam TEncoder communication::bolt::BaseEncoder
+template <typename TEncoder>
+class BoltValueEncoder {
+ public:
+  BoltValueEncoder(TEncoder &encoder, const storage::Storage *db, storage::View view)
+      : encoder_{encoder}, db_{db}, view_{view} {}
+
+  /// @throw communication::bolt::ValueException
+  /// @throw std::bad_alloc
+  storage::Result<void> Write(const query::TypedValue &value) {
+    switch (value.type()) {
+      // No database needed
+      case query::TypedValue::Type::Null:
+        encoder_.WriteNull();
+        return {};
+      case query::TypedValue::Type::Bool:
+        encoder_.WriteBool(value.ValueBool());
+        return {};
+      case query::TypedValue::Type::Int:
+        encoder_.WriteInt(value.ValueInt());
+        return {};
+      case query::TypedValue::Type::Double:
+        encoder_.WriteDouble(value.ValueDouble());
+        return {};
+      case query::TypedValue::Type::String:
+        encoder_.WriteString(std::string_view(value.ValueString()));
+        return {};
+      case query::TypedValue::Type::Date:
+        encoder_.WriteDate(value.ValueDate());
+        return {};
+      case query::TypedValue::Type::LocalTime:
+        encoder_.WriteLocalTime(value.ValueLocalTime());
+        return {};
+      case query::TypedValue::Type::LocalDateTime:
+        encoder_.WriteLocalDateTime(value.ValueLocalDateTime());
+        return {};
+      case query::TypedValue::Type::Duration:
+        encoder_.WriteDuration(value.ValueDuration());
+        return {};
+      case query::TypedValue::Type::ZonedDateTime:
+        encoder_.WriteZonedDateTime(value.ValueZonedDateTime());
+        return {};
+      case query::TypedValue::Type::Point2d:
+        encoder_.WritePoint2d(value.ValuePoint2d());
+        return {};
+      case query::TypedValue::Type::Point3d:
+        encoder_.WritePoint3d(value.ValuePoint3d());
+        return {};
+
+      // Database potentially not required
+      case query::TypedValue::Type::Map: {
+        const auto &map = value.ValueMap();
+        encoder_.WriteTypeSize(map.size(), communication::bolt::MarkerMap);
+        for (const auto &[key, item] : map) {
+          encoder_.WriteString(std::string_view(key));
+          if (auto res = Write(item); res.HasError()) return res;
+        }
+        return {};
+      }
+
+      // Database is required
+      case query::TypedValue::Type::List: {
+        CheckDb();
+        const auto &list = value.ValueList();
+        encoder_.WriteTypeSize(list.size(), communication::bolt::MarkerList);
+        for (const auto &item : list) {
+          if (auto res = Write(item); res.HasError()) return res;
+        }
+        return {};
+      }
+      case query::TypedValue::Type::Vertex: {
+        CheckDb();
+        auto maybe_vertex = ReadVertex(value.ValueVertex().impl_);
+        if (maybe_vertex.HasError()) return maybe_vertex.GetError();
+        WriteVertex(*maybe_vertex);
+        return {};
+      }
+      case query::TypedValue::Type::Edge: {
+        CheckDb();
+        auto maybe_edge = ReadEdge(value.ValueEdge().impl_);
+        if (maybe_edge.HasError()) return maybe_edge.GetError();
+        WriteEdge(*maybe_edge);
+        return {};
+      }
+      case query::TypedValue::Type::Path:
+        CheckDb();
+        return WritePath(value.ValuePath());
+      case query::TypedValue::Type::Graph:
+        CheckDb();
+        return WriteGraph(value.ValueGraph());
+      case query::TypedValue::Type::Enum:
+        CheckDb();
+        WriteEnum(value.ValueEnum());
+        return {};
+
+      // Unsupported conversions
+      case query::TypedValue::Type::Function:
+        throw communication::bolt::ValueException("Unsupported conversion from TypedValue::Function to Value");
+    }
+    return {};
+  }
+
+ private:
+  // Everything needed to write a vertex or an edge, read before anything is written
+  struct VertexParts {
+    communication::bolt::Id id;
+    utils::small_vector<storage::LabelId> labels;
+    std::map<storage::PropertyId, storage::PropertyValue> properties;
+  };
+
+  struct EdgeParts {
+    communication::bolt::Id id;
+    communication::bolt::Id from;
+    communication::bolt::Id to;
+    storage::EdgeTypeId type;
+    std::map<storage::PropertyId, storage::PropertyValue> properties;
+  };
+
+  void CheckDb() const {
+    if (db_ == nullptr) [[unlikely]]
+      throw communication::bolt::ValueException("Database needed for TypeValue conversion.");
+  }
+
+  storage::Result<VertexParts> ReadVertex(const storage::VertexAccessor &vertex) const {
+    auto maybe_labels = vertex.Labels(view_);
+    if (maybe_labels.HasError()) return maybe_labels.GetError();
+    auto maybe_properties = vertex.Properties(view_);
+    if (maybe_properties.HasError()) return maybe_properties.GetError();
+    return VertexParts{communication::bolt::Id::FromUint(vertex.Gid().AsUint()), *std::move(maybe_labels),
+                       *std::move(maybe_properties)};
+  }
+
+  storage::Result<EdgeParts> ReadEdge(const storage::EdgeAccessor &edge) const {
+    auto maybe_properties = edge.Properties(view_);
+    if (maybe_properties.HasError()) return maybe_properties.GetError();
+    return EdgeParts{communication::bolt::Id::FromUint(edge.Gid().AsUint()),
+                     communication::bolt::Id::FromUint(edge.FromVertex().Gid().AsUint()),
+                     communication::bolt::Id::FromUint(edge.ToVertex().Gid().AsUint()), edge.EdgeType(),
+                     *std::move(maybe_properties)};
+  }
+
+  void WriteVertex(const VertexParts &vertex) {
+    // Introduced in Bolt v5 (for now just send the ID)
+    const auto element_id = std::to_string(vertex.id.AsInt());
+    encoder_.WriteVertex(
+        vertex.id, vertex.labels.size(),
+        [&] {
+          for (const auto label : vertex.labels) encoder_.WriteString(db_->LabelToName(label));
+        },
+        vertex.properties.size(), [&] { WriteProperties(vertex.properties); }, element_id);
+  }
+
+  void WriteEdge(const EdgeParts &edge) {
+    // Introduced in Bolt v5 (for now just send the ID)
+    const auto element_id = std::to_string(edge.id.AsInt());
+    const auto from_element_id = std::to_string(edge.from.AsInt());
+    const auto to_element_id = std::to_string(edge.to.AsInt());
+    encoder_.WriteEdge(
+        edge.id, edge.from, edge.to, db_->EdgeTypeToName(edge.type), edge.properties.size(),
+        [&] { WriteProperties(edge.properties); }, element_id, from_element_id, to_element_id);
+  }
+
+  void WriteUnboundedEdge(const EdgeParts &edge) {
+    const auto element_id = std::to_string(edge.id.AsInt());
+    encoder_.WriteUnboundedEdge(
+        edge.id, db_->EdgeTypeToName(edge.type), edge.properties.size(), [&] { WriteProperties(edge.properties); },
+        element_id);
+  }
+
+  /// Same layout as communication::bolt::Path: unique vertices, unique edges and the indices walking through them.
+  storage::Result<void> WritePath(const query::Path &path) {
+    const auto &vertices = path.vertices();
+    const auto &edges = path.edges();
+
+    std::vector<VertexParts> unique_vertices;
+    std::vector<EdgeParts> unique_edges;
+    std::vector<int64_t> indices;
+    unique_vertices.reserve(vertices.size());
+    unique_edges.reserve(edges.size());
+    indices.reserve(2 * edges.size());
+
+    // Looks for the element with the given id in the collection and puts its index into `indices`. Returns false if
+    // the element isn't there yet, in which case it has to be added at the returned index. A multiplier is added to
+    // switch between positive and negative indices (that define edge direction).
+    auto const add_index = [&indices](const auto &collection, communication::bolt::Id id, int64_t multiplier,
+                                      int64_t offset) {
+      auto const found = std::ranges::find_if(collection, [id](const auto &e) { return e.id == id; });
+      indices.emplace_back(multiplier * (std::distance(collection.begin(), found) + offset));
+      return found != collection.end();
+    };
+
+    auto maybe_first = ReadVertex(vertices[0].impl_);
+    if (maybe_first.HasError()) return maybe_first.GetError();
+    unique_vertices.emplace_back(*std::move(maybe_first));
+    for (size_t i = 0; i < edges.size(); ++i) {
+      const auto &e = edges[i].impl_;
+      const auto &v = vertices[i + 1].impl_;
+      const auto edge_id = communication::bolt::Id::FromUint(e.Gid().AsUint());
+      const auto vertex_id = communication::bolt::Id::FromUint(v.Gid().AsUint());
+
+      if (!add_index(unique_edges, edge_id, e.ToVertex().Gid() == v.Gid() ? 1 : -1, 1)) {
+        auto maybe_edge = ReadEdge(e);
+        if (maybe_edge.HasError()) return maybe_edge.GetError();
+        unique_edges.emplace_back(*std::move(maybe_edge));
+      }
+      if (!add_index(unique_vertices, vertex_id, 1, 0)) {
+        auto maybe_vertex = ReadVertex(v);
+        if (maybe_vertex.HasError()) return maybe_vertex.GetError();
+        unique_vertices.emplace_back(*std::move(maybe_vertex));
+      }
+    }
+
+    encoder_.WritePath(
+        unique_vertices.size(),
+        [&] {
+          for (const auto &v : unique_vertices) WriteVertex(v);
+        },
+        unique_edges.size(),
+        [&] {
+          for (const auto &e : unique_edges) WriteUnboundedEdge(e);
+        },
+        indices);
+    return {};
+  }
+
+  /// Same layout as ToBoltGraph: a map with the "edges" and "nodes" lists, in key order.
+  storage::Result<void> WriteGraph(const query::Graph &graph) {
+    std::vector<VertexParts> vertices;
+    vertices.reserve(graph.vertices().size());
+    for (const auto &v : graph.vertices()) {
+      auto maybe_vertex = ReadVertex(v.impl_);
+      if (maybe_vertex.HasError()) return maybe_vertex.GetError();
+      vertices.emplace_back(*std::move(maybe_vertex));
+    }
+    std::vector<EdgeParts> edges;
+    edges.reserve(graph.edges().size());
+    for (const auto &e : graph.edges()) {
+      auto maybe_edge = ReadEdge(e.impl_);
+      if (maybe_edge.HasError()) return maybe_edge.GetError();
+      edges.emplace_back(*std::move(maybe_edge));
+    }
+
+    encoder_.WriteTypeSize(2, communication::bolt::MarkerMap);
+    encoder_.WriteString("edges");
+    encoder_.WriteTypeSize(edges.size(), communication::bolt::MarkerList);
+    for (const auto &e : edges) WriteEdge(e);
+    encoder_.WriteString("nodes");
+    encoder_.WriteTypeSize(vertices.size(), communication::bolt::MarkerList);
+    for (const auto &v : vertices) WriteVertex(v);
+    return {};
+  }
+
+  /// Bolt does not know about enums, encoded as a map instead
+  void WriteEnum(storage::Enum value) {
+    auto maybe_enum_value_str = db_->enum_store_.ToString(value);
+    if (maybe_enum_value_str.HasError()) [[unlikely]] {
+      throw communication::bolt::ValueException("Enum not registered in the database");
+    }
+    static_assert(communication::bolt::kMgTypeType < communication::bolt::kMgTypeValue);
+    encoder_.WriteTypeSize(2, communication::bolt::MarkerMap);
+    encoder_.WriteString(communication::bolt::kMgTypeType);
+    encoder_.WriteString(communication::bolt::kMgTypeEnum);
+    encoder_.WriteString(communication::bolt::kMgTypeValue);
+    encoder_.WriteString(*maybe_enum_value_str);
+  }
+
+  /// Properties are keyed by id, Bolt maps are written in the order of their keys' names.
+  template <typename TProperties>
+  void WriteProperties(const TProperties &properties) {
+    std::vector<std::pair<std::string_view, const storage::PropertyValue *>> by_name;
+    by_name.reserve(properties.size());
+    for (const auto &[property, value] : properties) {
+      by_name.emplace_back(db_->PropertyToName(property), &value);
+    }
+    std::ranges::sort(by_name, {}, &decltype(by_name)::value_type::first);
+    for (const auto &[name, value] : by_name) {
+      encoder_.WriteString(name);
+      WritePropertyValue(*value);
+    }
+  }
+
+  void WritePropertyValue(const storage::PropertyValue &value) {
+    switch (value.type()) {
+      case storage::PropertyValue::Type::Null:
+        encoder_.WriteNull();
+        return;
+      case storage::PropertyValue::Type::Bool:
+        encoder_.WriteBool(value.ValueBool());
+        return;
+      case storage::PropertyValue::Type::Int:
+        encoder_.WriteInt(value.ValueInt());
+        return;
+      case storage::PropertyValue::Type::Double:
+        encoder_.WriteDouble(value.ValueDouble());
+        return;
+      case storage::PropertyValue::Type::String:
+        encoder_.WriteString(std::string_view(value.ValueString()));
+        return;
+      case storage::PropertyValue::Type::List: {
+        const auto &list = value.ValueList();
+        encoder_.WriteTypeSize(list.size(), communication::bolt::MarkerList);
+        for (const auto &item : list) WritePropertyValue(item);
+        return;
+      }
+      case storage::PropertyValue::Type::Map: {
+        const auto &map = value.ValueMap();
+        encoder_.WriteTypeSize(map.size(), communication::bolt::MarkerMap);
+        WriteProperties(map);
+        return;
+      }
+      case storage::PropertyValue::Type::TemporalData: {
+        const auto &temporal = value.ValueTemporalData();
+        switch (temporal.type) {
+          case storage::TemporalType::Date:
+            encoder_.WriteDate(utils::Date(temporal.microseconds));
+            return;
+          case storage::TemporalType::LocalTime:
+            encoder_.WriteLocalTime(utils::LocalTime(temporal.microseconds));
+            return;
+          case storage::TemporalType::LocalDateTime:
+            encoder_.WriteLocalDateTime(utils::LocalDateTime(temporal.microseconds));
+            return;
+          case storage::TemporalType::Duration:
+            encoder_.WriteDuration(utils::Duration(temporal.microseconds));
+            return;
+        }
+        return;
+      }
+      case storage::PropertyValue::Type::ZonedTemporalData: {
+        const auto &temporal = value.ValueZonedTemporalData();
+        switch (temporal.type) {
+          case storage::ZonedTemporalType::ZonedDateTime:
+            encoder_.WriteZonedDateTime(utils::ZonedDateTime(temporal.microseconds, temporal.timezone));
+            return;
+        }
+        return;
+      }
+      case storage::PropertyValue::Type::Enum:
+        WriteEnum(value.ValueEnum());
+        return;
+      case storage::PropertyValue::Type::Point2d:
+        encoder_.WritePoint2d(value.ValuePoint2d());
+        return;
+      case storage::PropertyValue::Type::Point3d:
+        encoder_.WritePoint3d(value.ValuePoint3d());
+        return;
+    }
+  }
+
+  TEncoder &encoder_;
+  const storage::Storage *db_;
+  storage::View view_;
+};
+
+}  // namespace memgraph::glue
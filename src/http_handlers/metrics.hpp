@@ -12,19 +12,26 @@
 #pragma once
 
 #include <atomic>
+#include <string>
+#include <string_view>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 #include <spdlog/spdlog.h>
 #include <boost/beast/http.hpp>
 #include <boost/beast/version.hpp>
+#include <fmt/format.h>
 #include <nlohmann/json_fwd.hpp>
 
+#include "dbms/dbms_handler.hpp"
 #include "license/license_sender.hpp"
 #include "storage/v2/storage.hpp"
 #include "utils/event_counter.hpp"
 #include "utils/event_gauge.hpp"
 #include "utils/event_histogram.hpp"
+#include "utils/event_labeled_histogram.hpp"
+#include "utils/lock_contention.hpp"
 
 namespace memgraph::metrics {
 
@@ -109,18 +116,146 @@ struct MetricsResponse {
 
 class MetricsService {
  public:
-  explicit MetricsService(storage::Storage *storage) : db_(storage) {}
+  explicit MetricsService(dbms::DbmsHandler *dbms_handler) : dbms_handler_(dbms_handler) {}
 
   nlohmann::json GetMetricsJSON() {
     auto response = GetMetrics();
     return AsJson(response);
   }
 
+  // Metrics in the Prometheus text exposition format (version 0.0.4). Histograms are exposed as summaries with
+  // their configured percentiles as quantiles. Unlike the JSON response, reading the HA counters here doesn't
+  // reset them.
+  std::string GetMetricsPrometheus() {
+    std::vector<std::pair<std::string, storage::StorageInfo>> databases;
+    dbms_handler_->ForEach([&](dbms::DatabaseAccess db_acc) {
+      databases.emplace_back(fmt::format("{{database=\"{}\"}}", EscapeLabelValue(db_acc->name())),
+                             db_acc->storage()->GetBaseInfo());
+    });
+    std::string text;
+
+    const auto add_general = [&](std::string_view name, std::string_view help, auto value) {
+      AddFamily(&text, fmt::format("memgraph_{}", name), help, "gauge");
+      fmt::format_to(std::back_inserter(text), "memgraph_{} {}\n", name, value);
+    };
+    const auto add_per_database = [&](std::string_view name, std::string_view help, auto member) {
+      AddFamily(&text, fmt::format("memgraph_{}", name), help, "gauge");
+      for (const auto &[database_label, info] : databases) {
+        fmt::format_to(std::back_inserter(text), "memgraph_{}{} {}\n", name, database_label, info.*member);
+      }
+    };
+    add_per_database("vertex_count", "Number of vertices.", &storage::StorageInfo::vertex_count);
+    add_per_database("edge_count", "Number of edges.", &storage::StorageInfo::edge_count);
+    add_per_database("average_degree", "Average degree of vertices.", &storage::StorageInfo::average_degree);
+    // Memory and unreleased deltas are counted for the whole process, so any database's info has them
+    if (!databases.empty()) {
+      const auto &info = databases.front().second;
+      add_general("memory_usage", "Resident memory of the process in bytes.", info.memory_res);
+      add_general("peak_memory_usage", "Peak resident memory of the process in bytes.", info.peak_memory_res);
+      add_general("unreleased_delta_objects", "Number of deltas not yet released by the garbage collector.",
+                  info.unreleased_delta_objects);
+    }
+    add_per_database("disk_usage", "Disk usage of the data directory in bytes.", &storage::StorageInfo::disk_usage);
+
+    for (auto i = 0; i < memgraph::metrics::CounterEnd(); i++) {
+      // Counters which are also decremented can go down, which a Prometheus counter must never do
+      const bool is_gauge = memgraph::metrics::IsCounterGauge(i);
+      const auto name = fmt::format("memgraph_{}{}", memgraph::metrics::GetCounterName(i), is_gauge ? "" : "_total");
+      AddFamily(&text, name, memgraph::metrics::GetCounterDocumentation(i), is_gauge ? "gauge" : "counter");
+      fmt::format_to(std::back_inserter(text), "{} {}\n", name, memgraph::metrics::GetCounterValue(i));
+    }
+
+    for (auto i = 0; i < memgraph::metrics::GaugeEnd(); i++) {
+      const auto name = fmt::format("memgraph_{}", memgraph::metrics::GetGaugeName(i));
+      AddFamily(&text, name, memgraph::metrics::GetGaugeDocumentation(i), "gauge");
+      fmt::format_to(std::back_inserter(text), "{} {}\n", name,
+                     memgraph::metrics::global_gauges[i].load(std::memory_order_acquire));
+    }
+
+    for (auto i = 0; i < memgraph::metrics::HistogramEnd(); i++) {
+      const auto name = fmt::format("memgraph_{}", memgraph::metrics::GetHistogramName(i));
+      const auto &histogram = memgraph::metrics::global_histograms[i];
+      AddFamily(&text, name, memgraph::metrics::GetHistogramDocumentation(i), "summary");
+      for (const auto &[percentile, value] : histogram.YieldPercentiles()) {
+        fmt::format_to(std::back_inserter(text), "{}{{quantile=\"{}\"}} {}\n", name,
+                       static_cast<double>(percentile) / 100.0, value);
+      }
+      fmt::format_to(std::back_inserter(text), "{}_sum {}\n{}_count {}\n", name, histogram.Sum(), name,
+                     histogram.Count());
+    }
+
+    for (auto i = 0; i < memgraph::metrics::LabeledHistogramEnd(); i++) {
+      const auto name = fmt::format("memgraph_{}", memgraph::metrics::GetLabeledHistogramName(i));
+      const auto &label_names = memgraph::metrics::GetLabeledHistogramLabels(i);
+      AddFamily(&text, name, memgraph::metrics::GetLabeledHistogramDocumentation(i), "summary");
+      memgraph::metrics::GetLabeledHistogram(i).ForEach([&](const auto &label_values, const auto &histogram) {
+        std::string labels;
+        for (size_t j = 0; j < label_names.size(); ++j) {
+          if (j != 0) labels += ',';
+          fmt::format_to(std::back_inserter(labels), "{}=\"{}\"", label_names[j], EscapeLabelValue(label_values[j]));
+        }
+        for (const auto &[percentile, value] : histogram.YieldPercentiles()) {
+          fmt::format_to(std::back_inserter(text), "{}{{{},quantile=\"{}\"}} {}\n", name, labels,
+                         static_cast<double>(percentile) / 100.0, value);
+        }
+        fmt::format_to(std::back_inserter(text), "{}_sum{{{}}} {}\n{}_count{{{}}} {}\n", name, labels, histogram.Sum(),
+                       name, labels, histogram.Count());
+      });
+    }
+
+#ifdef MG_LOCK_CONTENTION_PROFILE
+    AddFamily(&text, "memgraph_vertex_write_conflicts_total",
+              "Write-write conflicts on the most conflicted vertices of all databases, by gid.", "counter");
+    for (const auto &[gid, conflicts] : utils::TopWriteConflicts()) {
+      fmt::format_to(std::back_inserter(text), "memgraph_vertex_write_conflicts_total{{gid=\"{}\"}} {}\n", gid,
+                     conflicts);
+    }
+#endif
+
+    return text;
+  }
+
  private:
-  storage::Storage *const db_;
+  dbms::DbmsHandler *const dbms_handler_;
+
+  static void AddFamily(std::string *text, std::string_view name, std::string_view help, std::string_view type) {
+    fmt::format_to(std::back_inserter(*text), "# HELP {} {}\n# TYPE {} {}\n", name, EscapeHelp(help), name, type);
+  }
+
+  static std::string EscapeHelp(std::string_view help) {
+    std::string escaped;
+    escaped.reserve(help.size());
+    for (const auto c : help) {
+      if (c == '\\') {
+        escaped += "\\\\";
+      } else if (c == '\n') {
+        escaped += "\\n";
+      } else {
+        escaped += c;
+      }
+    }
+    return escaped;
+  }
+
+  static std::string EscapeLabelValue(std::string_view value) {
+    std::string escaped;
+    escaped.reserve(value.size());
+    for (const auto c : value) {
+      if (c == '"') {
+        escaped += "\\\"";
+      } else if (c == '\\') {
+        escaped += "\\\\";
+      } else if (c == '\n') {
+        escaped += "\\n";
+      } else {
+        escaped += c;
+      }
+    }
+    return escaped;
+  }
 
   MetricsResponse GetMetrics() {
-    auto info = db_->GetBaseInfo();
+    auto info = dbms_handler_->Get()->storage()->GetBaseInfo();
 
     return MetricsResponse{.vertex_count = info.vertex_count,
                            .edge_count = info.edge_count,
@@ -172,11 +307,11 @@ class MetricsService {
     for (auto i = 0; i < memgraph::metrics::CounterEnd(); i++) {
       if (is_coordinator && std::find(coord_counters_to_reset.cbegin(), coord_counters_to_reset.cend(), i)) {
         event_counters.emplace_back(memgraph::metrics::GetCounterName(i), memgraph::metrics::GetCounterType(i),
-                                    memgraph::metrics::global_counters[i].exchange(0, std::memory_order_acq_rel));
+                                    memgraph::metrics::ResetCounterValue(i));
 
       } else {
         event_counters.emplace_back(memgraph::metrics::GetCounterName(i), memgraph::metrics::GetCounterType(i),
-                                    memgraph::metrics::global_counters[i].load(std::memory_order_acquire));
+                                    memgraph::metrics::GetCounterValue(i));
       }
     }
 
@@ -215,11 +350,9 @@ class MetricsService {
   }
 };
 
-// TODO: Should this be inside Database?
-// Raw pointer could be dangerous
 class MetricsRequestHandler final {
  public:
-  explicit MetricsRequestHandler(storage::Storage *storage) : service_(storage) {}
+  explicit MetricsRequestHandler(dbms::DbmsHandler *dbms_handler) : service_(dbms_handler) {}
 
   MetricsRequestHandler(const MetricsRequestHandler &) = delete;
   MetricsRequestHandler(MetricsRequestHandler &&) = delete;
@@ -267,11 +400,19 @@ class MetricsRequestHandler final {
       return send(bad_request("Illegal request-target"));
     }
 
+    // Prometheus scrapes /metrics by default; every other path keeps returning JSON
+    const auto target = std::string_view{req.target().data(), req.target().size()};
+    const bool prometheus = target.substr(0, target.find('?')) == "/metrics";
+
     // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
     boost::beast::http::string_body::value_type body;
 
-    auto service_response = service_.GetMetricsJSON();
-    body.append(service_response.dump());
+    if (prometheus) {
+      body.append(service_.GetMetricsPrometheus());
+    } else {
+      auto service_response = service_.GetMetricsJSON();
+      body.append(service_response.dump());
+    }
 
     // Cache the size since we need it after the move
     const auto size = body.size();
@@ -282,7 +423,8 @@ class MetricsRequestHandler final {
         std::piecewise_construct, std::make_tuple(std::move(body)),
         std::make_tuple(boost::beast::http::status::ok, req.version())};
     res.set(boost::beast::http::field::server, BOOST_BEAST_VERSION_STRING);
-    res.set(boost::beast::http::field::content_type, "application/json");
+    res.set(boost::beast::http::field::content_type,
+            prometheus ? "text/plain; version=0.0.4; charset=utf-8" : "application/json");
     res.content_length(size);
     res.keep_alive(req.keep_alive());
     return send(std::move(res));
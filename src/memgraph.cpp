@@ -50,6 +50,7 @@
 #include "query/procedure/callable_alias_mapper.hpp"
 #include "query/procedure/module.hpp"
 #include "query/procedure/py_module.hpp"
+#include "query/slow_query_log.hpp"
 #include "replication/state.hpp"
 #include "replication_handler/replication_handler.hpp"
 #include "requests/requests.hpp"
@@ -362,6 +363,7 @@ int main(int argc, char **argv) {
       .durability = {.storage_directory = FLAGS_data_directory,
                      .recover_on_startup = FLAGS_data_recovery_on_startup,
                      .snapshot_retention_count = FLAGS_storage_snapshot_retention_count,
+                     .snapshot_incremental_layers = FLAGS_storage_snapshot_incremental_layers,
                      .wal_file_size_kibibytes = FLAGS_storage_wal_file_size_kib,
                      .wal_file_flush_every_n_tx = FLAGS_storage_wal_file_flush_every_n_tx,
                      .snapshot_on_exit = FLAGS_storage_snapshot_on_exit,
@@ -453,7 +455,8 @@ int main(int argc, char **argv) {
       .default_kafka_bootstrap_servers = FLAGS_kafka_bootstrap_servers,
       .default_pulsar_service_url = FLAGS_pulsar_service_url,
       .stream_transaction_conflict_retries = FLAGS_stream_transaction_conflict_retries,
-      .stream_transaction_retry_interval = std::chrono::milliseconds(FLAGS_stream_transaction_retry_interval)};
+      .stream_transaction_retry_interval = std::chrono::milliseconds(FLAGS_stream_transaction_retry_interval),
+      .stream_batch_queries = FLAGS_stream_batch_queries};
 
   auto auth_glue = [](memgraph::auth::SynchedAuth *auth, std::unique_ptr<memgraph::query::AuthQueryHandler> &ah,
                       std::unique_ptr<memgraph::query::AuthChecker> &ac) {
@@ -590,6 +593,11 @@ int main(int argc, char **argv) {
   }
 #endif
 
+  // Slow query log, must outlive the interpreter context that writes to it
+  memgraph::query::SlowQueryLog slow_query_log{data_directory / "slow_query"};
+  // Started only if one of the thresholds is set
+  slow_query_log.Start();
+
   auto db_acc = dbms_handler.Get();
 
   memgraph::query::InterpreterContextLifetimeControl interpreter_context_lifetime_control(
@@ -601,6 +609,7 @@ int main(int argc, char **argv) {
       auth_handler.get(), auth_checker.get(), &replication_handler);
 
   auto &interpreter_context_ = memgraph::query::InterpreterContextHolder::GetInstance();
+  interpreter_context_.slow_query_log = &slow_query_log;
   MG_ASSERT(db_acc, "Failed to access the main database");
 
   memgraph::query::procedure::gModuleRegistry.SetModulesDirectory(memgraph::flags::ParseQueryModulesDirectory(),
@@ -715,10 +724,9 @@ int main(int argc, char **argv) {
     spdlog::error("Skipping adding logger sync for websocket.");
   }
 
-// TODO: Make multi-tenant
 #ifdef MG_ENTERPRISE
   memgraph::glue::MonitoringServerT metrics_server{
-      {FLAGS_metrics_address, static_cast<uint16_t>(FLAGS_metrics_port)}, db_acc->storage(), &context};
+      {FLAGS_metrics_address, static_cast<uint16_t>(FLAGS_metrics_port)}, &dbms_handler, &context};
   spdlog::trace("Metrics server created.");
 #endif
 
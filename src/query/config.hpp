@@ -26,5 +26,6 @@ struct InterpreterConfig {
   std::string default_pulsar_service_url;
   uint32_t stream_transaction_conflict_retries;
   std::chrono::milliseconds stream_transaction_retry_interval;
+  bool stream_batch_queries{false};
 };
 }  // namespace memgraph::query
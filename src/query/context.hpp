@@ -16,6 +16,7 @@
 #include <type_traits>
 
 #include "query/frontend/semantic/symbol_table.hpp"
+#include "query/interpret/regex_cache.hpp"
 #include "query/metadata.hpp"
 #include "query/parameters.hpp"
 #include "query/plan/profile.hpp"
@@ -57,6 +58,9 @@ struct EvaluationContext {
   /// All counters generated by `counter` function, mutable because the function
   /// modifies the values
   mutable std::unordered_map<std::string, int64_t> counters{};
+  /// Regular expressions used by `=~`, compiled once per query instead of
+  /// once per row; mutable because the evaluation fills it
+  mutable RegexCache regex_cache{};
   Scope scope{};
 };
 
@@ -1,4 +1,4 @@
-// Copyright 2025 Memgraph Ltd.
+// Copyright 2026 Memgraph Ltd.
 //
 // Use of this software is governed by the Business Source License
 // included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -10,6 +10,10 @@
 // licenses/APL.txt.
 
 #include "query/cypher_query_interpreter.hpp"
+
+#include <algorithm>
+#include <sstream>
+
 #include "frontend/ast/ast.hpp"
 #include "frontend/semantic/required_privileges.hpp"
 #include "frontend/semantic/rw_checker.hpp"
@@ -21,16 +25,156 @@
 #include "query/plan/rule_based_planner.hpp"
 #include "query/plan/vertex_count_cache.hpp"
 #include "utils/flag_validation.hpp"
+#include "utils/fnv.hpp"
 
 // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_bool(query_cost_planner, true, "Use the cost-estimating query planner.");
 // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_VALIDATED_int32(query_plan_cache_max_size, 1000, "Maximum number of query plans to cache.",
                        FLAG_IN_RANGE(0, std::numeric_limits<int32_t>::max()));
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(query_plan_cache_max_bytes, 128UL * 1024 * 1024,
+              "Maximum estimated memory in bytes taken by the cached query plans of a database. The least recently "
+              "used plans are evicted over it. 0 means no limit.");
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_int32(query_ast_cache_max_size, 10000, "Maximum number of parsed queries to cache.",
+                       FLAG_IN_RANGE(1, std::numeric_limits<int32_t>::max()));
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_int32(query_plan_cache_replan_ratio, 100,
+                       "Plan a cached query again once the rows it returns differ from the plan's estimate by at least "
+                       "this factor. 0 disables re-planning.",
+                       FLAG_IN_RANGE(0, std::numeric_limits<int32_t>::max()));
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_double(query_profile_sample_rate, 0.0,
+                        "Fraction of cached query executions that are profiled per operator. The statistics are "
+                        "summed per cached plan and listed by SHOW QUERY STATISTICS. 0 disables sampling.",
+                        FLAG_IN_RANGE(0.0, 1.0));
 
 namespace memgraph::query {
+
+namespace {
+/// Checks whether the rows a plan returns are the rows counted by its cost
+/// estimate. The estimator doesn't model how aggregations, DISTINCT, SKIP,
+/// LIMIT and OPTIONAL MATCH change the number of rows, nor the rows produced by
+/// procedures and LOAD CSV.
+class EstimatedRowsChecker final : public plan::HierarchicalLogicalOperatorVisitor {
+ public:
+  using HierarchicalLogicalOperatorVisitor::PostVisit;
+  using HierarchicalLogicalOperatorVisitor::PreVisit;
+  using HierarchicalLogicalOperatorVisitor::Visit;
+
+  bool PreVisit(plan::Aggregate & /*op*/) override { return NotModeled(); }
+  bool PreVisit(plan::Distinct & /*op*/) override { return NotModeled(); }
+  bool PreVisit(plan::Skip & /*op*/) override { return NotModeled(); }
+  bool PreVisit(plan::Limit & /*op*/) override { return NotModeled(); }
+  bool PreVisit(plan::Optional & /*op*/) override { return NotModeled(); }
+  bool PreVisit(plan::EmptyResult & /*op*/) override { return NotModeled(); }
+  bool PreVisit(plan::CallProcedure & /*op*/) override { return NotModeled(); }
+  bool PreVisit(plan::LoadCsv & /*op*/) override { return NotModeled(); }
+  bool PreVisit(plan::OutputTable & /*op*/) override { return NotModeled(); }
+  bool PreVisit(plan::OutputTableStream & /*op*/) override { return NotModeled(); }
+
+  bool Visit(plan::Once & /*op*/) override { return true; }
+
+  bool returns_estimated_rows{true};
+
+ private:
+  bool NotModeled() {
+    returns_estimated_rows = false;
+    return false;
+  }
+};
+
+bool ReturnsEstimatedRows(plan::LogicalOperator &root) {
+  EstimatedRowsChecker checker;
+  root.Accept(checker);
+  return checker.returns_estimated_rows;
+}
+
+/// Whether two row counts are far enough apart for --query-plan-cache-replan-ratio.
+bool DiffersByReplanRatio(double lhs, double rhs) {
+  auto const larger = std::max(lhs, rhs);
+  auto const smaller = std::max(std::min(lhs, rhs), 1.0);
+  if (larger < PlanWrapper::kMinRowsForReplanning) return false;
+  return larger / smaller >= FLAGS_query_plan_cache_replan_ratio;
+}
+}  // namespace
+
+PlanCacheKey::PlanCacheKey(frontend::StrippedQuery const &stripped_query, Parameters const &parameters)
+    : query(stripped_query.query()) {
+  // Only the distinctions the planner makes are kept, so that e.g. an int and
+  // a string parameter still share the plan.
+  auto const type_name = [](storage::PropertyValueType type) -> std::string_view {
+    switch (type) {
+      case storage::PropertyValueType::List:
+        return "list";
+      case storage::PropertyValueType::Map:
+        return "map";
+      default:
+        return "scalar";
+    }
+  };
+  std::vector<std::pair<int, std::string_view>> types;
+  types.reserve(parameters.size());
+  for (const auto &[position, value] : parameters) {
+    types.emplace_back(position, type_name(value.type()));
+  }
+  // User parameters come after the stripped literals, order all of them as they appear in the query.
+  std::ranges::sort(types);
+  std::ostringstream parameter_types_stream;
+  for (const auto &[position, type] : types) {
+    if (parameter_types_stream.tellp() > 0) parameter_types_stream << ", ";
+    parameter_types_stream << type;
+  }
+  parameter_types = parameter_types_stream.str();
+  hash = utils::HashCombine<uint64_t, std::string>{}(stripped_query.hash(), parameter_types);
+}
+
 PlanWrapper::PlanWrapper(std::unique_ptr<LogicalPlan> plan) : plan_(std::move(plan)) {}
 
+PlanWrapper::PlanWrapper(std::unique_ptr<LogicalPlan> plan, PlanCacheKey key, std::vector<IndexHint> index_hints,
+                         uint32_t replans)
+    : plan_(std::move(plan)), cache_key_(std::move(key)), index_hints_(std::move(index_hints)), replans_(replans) {}
+
+std::size_t PlanWrapper::ApproximateSize() const {
+  // AST nodes are of many types; each is counted at a fixed size which also
+  // covers its share of the logical operators planned from it.
+  constexpr std::size_t kAstNodeBytes = 256;
+  const auto &ast = ast_storage();
+  auto size = sizeof(PlanWrapper) + ast.storage_.size() * kAstNodeBytes;
+  for (const auto *names : {&ast.labels_, &ast.edge_types_, &ast.properties_}) {
+    for (const auto &name : *names) size += sizeof(name) + name.capacity();
+  }
+  size += static_cast<std::size_t>(symbol_table().max_position()) * sizeof(Symbol);
+  if (cache_key_) size += cache_key_->query.capacity() + cache_key_->parameter_types.capacity();
+  size += index_hints_.capacity() * sizeof(IndexHint);
+  return size;
+}
+
+void PlanWrapper::RecordReturnedRows(uint64_t rows) {
+  if (!cache_key_ || FLAGS_query_plan_cache_replan_ratio == 0 || replans_ >= kMaxReplans) return;
+  auto const estimated_rows = plan_->GetEstimatedRows();
+  if (!estimated_rows) return;
+  if (DiffersByReplanRatio(*estimated_rows, static_cast<double>(rows))) {
+    needs_replanning_.store(true, std::memory_order_release);
+  }
+}
+
+bool PlanWrapper::ShouldReplan(DbAccessor *db_accessor, const Parameters &parameters) {
+  if (!needs_replanning_.load(std::memory_order_acquire)) return false;
+  // The plan is estimated with the statistics and parameters the planner would use now. The estimator is a
+  // visitor, but it doesn't modify the plan.
+  auto vertex_counts = plan::VertexCountCache(db_accessor);
+  auto const current_rows =
+      plan::EstimatePlanCost(&vertex_counts, symbol_table(), parameters,
+                             const_cast<plan::LogicalOperator &>(plan_->GetRoot()),
+                             plan::IndexHints(index_hints_, &vertex_counts))
+          .cardinality;
+  if (DiffersByReplanRatio(*plan_->GetEstimatedRows(), current_rows)) return true;
+  needs_replanning_.store(false, std::memory_order_release);
+  return false;
+}
+
 auto PrepareQueryParameters(frontend::StrippedQuery const &stripped_query, UserParameters const &user_parameters)
     -> Parameters {
   // Copy over the parameters that were introduced during stripping.
@@ -65,6 +209,8 @@ ParsedQuery ParseQuery(const std::string &query_string, UserParameters const &us
   auto hash = stripped_query.hash();
   auto accessor = cache->access();
   auto it = accessor.find(hash);
+  // A different query with the same hash is parsed each time instead of being cached.
+  const bool hash_collision = it != accessor.end() && it->query != stripped_query.query();
   std::unique_ptr<frontend::opencypher::Parser> parser;
 
   // Return a copy of both the AST storage and the query.
@@ -81,7 +227,7 @@ ParsedQuery ParseQuery(const std::string &query_string, UserParameters const &us
     result.is_cypher_read = cached_query.is_cypher_read;
   };
 
-  if (it == accessor.end()) {
+  if (it == accessor.end() || hash_collision) {
     try {
       parser = std::make_unique<frontend::opencypher::Parser>(stripped_query.query());
     } catch (const SyntaxException &e) {
@@ -113,10 +259,14 @@ ParsedQuery ParseQuery(const std::string &query_string, UserParameters const &us
       return !rw_checker.IsWrite();
     };
 
-    if (visitor.GetQueryInfo().is_cacheable) {
+    if (visitor.GetQueryInfo().is_cacheable && !hash_collision) {
       CachedQuery cached_query{std::move(ast_storage), visitor.query(), query::GetRequiredPrivileges(visitor.query()),
                                read_check()};
-      it = accessor.insert({hash, std::move(cached_query)}).first;
+      if (accessor.size() >= static_cast<uint64_t>(FLAGS_query_ast_cache_max_size)) {
+        // Entries are ordered by hash, so the first one is as good a candidate for eviction as any.
+        if (auto first = accessor.begin(); first != accessor.end()) accessor.remove(first->first);
+      }
+      it = accessor.insert({hash, std::move(cached_query), stripped_query.query()}).first;
 
       get_information_from_cache(it->second);
     } else {
@@ -151,42 +301,72 @@ std::unique_ptr<LogicalPlan> MakeLogicalPlan(AstStorage ast_storage, CypherQuery
   auto vertex_counts = plan::VertexCountCache(db_accessor);
   auto symbol_table = MakeSymbolTable(query, predefined_identifiers);
   auto planning_context = plan::MakePlanningContext(&ast_storage, &symbol_table, query, &vertex_counts);
-  auto [root, cost] = plan::MakeLogicalPlan(&planning_context, parameters, FLAGS_query_cost_planner);
+  plan::PostProcessor post_processor(parameters, query->pre_query_directives_.index_hints_, planning_context.db);
+  auto [root, cost] = plan::MakeLogicalPlan(&planning_context, &post_processor, FLAGS_query_cost_planner);
   auto rw_type_checker = plan::ReadWriteTypeChecker();
   rw_type_checker.InferRWType(*root);
+  std::optional<double> estimated_rows;
+  if (ReturnsEstimatedRows(*root)) {
+    estimated_rows = post_processor.EstimatePlanCost(root, &vertex_counts, symbol_table).cardinality;
+  }
   return std::make_unique<SingleNodeLogicalPlan>(std::move(root), cost, std::move(ast_storage), std::move(symbol_table),
-                                                 rw_type_checker.type);
+                                                 rw_type_checker.type, estimated_rows);
 }
 
-std::shared_ptr<PlanWrapper> CypherQueryToPlan(uint64_t hash, AstStorage ast_storage, CypherQuery *query,
-                                               const Parameters &parameters, PlanCacheLRU *plan_cache,
-                                               DbAccessor *db_accessor,
+std::shared_ptr<PlanWrapper> CypherQueryToPlan(frontend::StrippedQuery const &stripped_query, AstStorage ast_storage,
+                                               CypherQuery *query, const Parameters &parameters,
+                                               PlanCacheLRU *plan_cache, DbAccessor *db_accessor,
                                                const std::vector<Identifier *> &predefined_identifiers) {
-  if (plan_cache) {
-    auto existing_plan = plan_cache->WithLock([&](auto &cache) { return cache.get(hash); });
-    if (existing_plan.has_value()) {
-      return existing_plan.value();
-    }
+  if (!plan_cache) {
+    return std::make_shared<PlanWrapper>(
+        MakeLogicalPlan(std::move(ast_storage), query, parameters, db_accessor, predefined_identifiers));
   }
 
-  auto plan = std::make_shared<PlanWrapper>(
-      MakeLogicalPlan(std::move(ast_storage), query, parameters, db_accessor, predefined_identifiers));
-
-  if (plan_cache) {
-    plan_cache->WithLock([&](auto &cache) { cache.put(hash, plan); });
+  auto key = PlanCacheKey(stripped_query, parameters);
+  auto existing_plan = plan_cache->WithLock([&](auto &cache) { return cache.get(key.hash); });
+  uint32_t replans = 0;
+  if (existing_plan.has_value()) {
+    auto &plan = existing_plan.value();
+    if (plan->cache_key() != key) {
+      // Hash collision, the cached plan belongs to another query. Plan this one without caching it.
+      return std::make_shared<PlanWrapper>(
+          MakeLogicalPlan(std::move(ast_storage), query, parameters, db_accessor, predefined_identifiers));
+    }
+    if (!plan->ShouldReplan(db_accessor, parameters)) {
+      plan->IncrementCacheHits();
+      return plan;
+    }
+    // The cached plan was made with estimates that have since changed, replace it with a plan for the current ones.
+    replans = plan->replans() + 1;
   }
 
+  auto hash = key.hash;
+  auto index_hints = query->pre_query_directives_.index_hints_;
+  auto plan = std::make_shared<PlanWrapper>(
+      MakeLogicalPlan(std::move(ast_storage), query, parameters, db_accessor, predefined_identifiers), std::move(key),
+      std::move(index_hints), replans);
+  plan_cache->WithLock([&](auto &cache) { cache.put(hash, plan, plan->ApproximateSize()); });
   return plan;
 }
 
+std::vector<std::shared_ptr<PlanWrapper>> ListCachedPlans(PlanCacheLRU const &plan_cache) {
+  std::vector<std::shared_ptr<PlanWrapper>> plans;
+  plan_cache.WithReadLock([&](auto const &cache) {
+    cache.for_each([&](uint64_t /*hash*/, auto const &plan) { plans.push_back(plan); });
+  });
+  return plans;
+}
+
 SingleNodeLogicalPlan::SingleNodeLogicalPlan(std::unique_ptr<plan::LogicalOperator> root, double cost,
                                              AstStorage storage, SymbolTable symbol_table,
-                                             plan::ReadWriteTypeChecker::RWType rw_type)
+                                             plan::ReadWriteTypeChecker::RWType rw_type,
+                                             std::optional<double> estimated_rows)
     : root_(std::move(root)),
       cost_(cost),
       storage_(std::move(storage)),
       symbol_table_(std::move(symbol_table)),
-      rw_type_{rw_type} {}
+      rw_type_{rw_type},
+      estimated_rows_{estimated_rows} {}
 
 const SymbolTable &SingleNodeLogicalPlan::GetSymbolTable() const { return symbol_table_; }
 
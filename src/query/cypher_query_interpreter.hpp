@@ -1,4 +1,4 @@
-// Copyright 2025 Memgraph Ltd.
+// Copyright 2026 Memgraph Ltd.
 //
 // Use of this software is governed by the Business Source License
 // included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -11,14 +11,21 @@
 
 #pragma once
 
+#include <atomic>
+#include <optional>
+#include <string>
+#include <vector>
+
 #include "plan/read_write_type_checker.hpp"
 #include "query/config.hpp"
 #include "query/frontend/ast/query/auth_query.hpp"
 #include "query/frontend/semantic/symbol_table.hpp"
 #include "query/frontend/stripped.hpp"
 #include "query/parameters.hpp"
+#include "query/plan/profile.hpp"
 #include "storage/v2/property_value.hpp"
 #include "utils/lru_cache.hpp"
+#include "utils/rw_spin_lock.hpp"
 #include "utils/synchronized.hpp"
 
 #include "gflags/gflags.h"
@@ -27,6 +34,14 @@
 DECLARE_bool(query_cost_planner);
 // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
 DECLARE_int32(query_plan_cache_max_size);
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DECLARE_uint64(query_plan_cache_max_bytes);
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DECLARE_int32(query_ast_cache_max_size);
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DECLARE_int32(query_plan_cache_replan_ratio);
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DECLARE_double(query_profile_sample_rate);
 
 namespace memgraph::query {
 
@@ -52,6 +67,9 @@ class LogicalPlan {
 
   virtual const plan::LogicalOperator &GetRoot() const = 0;
   virtual double GetCost() const = 0;
+  /// Estimated number of rows the plan returns, std::nullopt if the cost
+  /// estimator doesn't model them (e.g. the plan aggregates or limits rows).
+  virtual std::optional<double> GetEstimatedRows() const = 0;
   virtual const SymbolTable &GetSymbolTable() const = 0;
   virtual const AstStorage &GetAstStorage() const = 0;
   virtual plan::ReadWriteTypeChecker::RWType RWType() const = 0;
@@ -62,18 +80,77 @@ using UserParameters = storage::ExternalPropertyValue::map_t;
 auto PrepareQueryParameters(frontend::StrippedQuery const &stripped_query, UserParameters const &user_parameters)
     -> Parameters;
 
+/// Identifies a cached plan: the stripped query together with the kinds of its
+/// parameters (stripped literals included), i.e. list, map or scalar. The
+/// planner can pick a different plan for the same query depending on them,
+/// e.g. an index lookup by each element of a list vs. by a single value.
+struct PlanCacheKey {
+  PlanCacheKey(frontend::StrippedQuery const &stripped_query, Parameters const &parameters);
+
+  uint64_t hash;
+  std::string query;
+  std::string parameter_types;
+
+  bool operator==(const PlanCacheKey &other) const = default;
+};
+
 class PlanWrapper {
  public:
+  /// Cached plans whose estimated rows are off by a factor of at least
+  /// --query-plan-cache-replan-ratio are planned again, at most this many times.
+  static constexpr uint32_t kMaxReplans = 3;
+  /// Misestimates are ignored when both the estimated and the returned rows are
+  /// below this; such queries are cheap with any plan.
+  static constexpr double kMinRowsForReplanning = 1000;
+
   explicit PlanWrapper(std::unique_ptr<LogicalPlan> plan);
+  PlanWrapper(std::unique_ptr<LogicalPlan> plan, PlanCacheKey key, std::vector<IndexHint> index_hints,
+              uint32_t replans = 0);
 
   const auto &plan() const { return plan_->GetRoot(); }
   double cost() const { return plan_->GetCost(); }
+  std::optional<double> estimated_rows() const { return plan_->GetEstimatedRows(); }
   const auto &symbol_table() const { return plan_->GetSymbolTable(); }
   const auto &ast_storage() const { return plan_->GetAstStorage(); }
   auto rw_type() const { return plan_->RWType(); }
+  /// Estimate of the memory taken by the plan, its AST and its cache key. Used
+  /// to keep the plan cache under --query-plan-cache-max-bytes.
+  std::size_t ApproximateSize() const;
+
+  /// The key the plan is cached under, std::nullopt if it isn't cached.
+  const auto &cache_key() const { return cache_key_; }
+  /// Number of times the plan was reused from the cache.
+  uint64_t cache_hits() const { return cache_hits_.load(std::memory_order_relaxed); }
+  void IncrementCacheHits() { cache_hits_.fetch_add(1, std::memory_order_relaxed); }
+
+  /// Feedback from a finished execution of a cached plan. If the returned rows
+  /// show the estimate was badly off, the next lookup checks whether planning
+  /// again would help, see ShouldReplan.
+  void RecordReturnedRows(uint64_t rows);
+  /// True if the last execution misestimated its rows and the cost estimator
+  /// now estimates the plan differently than when it was planned, because the
+  /// graph statistics or the parameters changed. Planning again with the
+  /// estimates the plan was made with would only produce the same plan, so a
+  /// misestimate they don't explain is dropped.
+  bool ShouldReplan(DbAccessor *db_accessor, const Parameters &parameters);
+  /// How many times the query was planned again before arriving at this plan.
+  uint32_t replans() const { return replans_; }
+
+  /// Operator statistics of the executions sampled by --query-profile-sample-rate.
+  void RecordProfile(const plan::ProfilingStatsWithTotalTime &stats) {
+    profile_.WithLock([&stats](auto &profile) { profile.Add(stats); });
+  }
+  plan::AggregatedProfilingStats profile() const { return *profile_.ReadLock(); }
 
  private:
   std::unique_ptr<LogicalPlan> plan_;
+  std::optional<PlanCacheKey> cache_key_;
+  // Index hints of the cached query, so ShouldReplan estimates the plan the way the planner did
+  std::vector<IndexHint> index_hints_;
+  std::atomic<uint64_t> cache_hits_{0};
+  std::atomic<bool> needs_replanning_{false};
+  uint32_t replans_{0};
+  utils::Synchronized<plan::AggregatedProfilingStats, utils::RWSpinLock> profile_;
 };
 
 struct CachedQuery {
@@ -90,9 +167,10 @@ struct QueryCacheEntry {
   bool operator<(const uint64_t &other) const { return first < other; }
 
   uint64_t first;
-  // TODO: Maybe store the query string here and use it as a key with the hash
-  // so that we eliminate the risk of hash collisions.
   CachedQuery second;
+  // The stripped query, compared on lookup so that a hash collision doesn't
+  // return the AST of a different query.
+  std::string query;
 };
 
 /**
@@ -116,10 +194,12 @@ ParsedQuery ParseQuery(const std::string &query_string, UserParameters const &us
 class SingleNodeLogicalPlan final : public LogicalPlan {
  public:
   SingleNodeLogicalPlan(std::unique_ptr<plan::LogicalOperator> root, double cost, AstStorage storage,
-                        SymbolTable symbol_table, plan::ReadWriteTypeChecker::RWType rw_type);
+                        SymbolTable symbol_table, plan::ReadWriteTypeChecker::RWType rw_type,
+                        std::optional<double> estimated_rows = std::nullopt);
 
   const plan::LogicalOperator &GetRoot() const override { return *root_; }
   double GetCost() const override { return cost_; }
+  std::optional<double> GetEstimatedRows() const override { return estimated_rows_; }
   const SymbolTable &GetSymbolTable() const override;
   const AstStorage &GetAstStorage() const override { return storage_; }
   plan::ReadWriteTypeChecker::RWType RWType() const override { return rw_type_; }
@@ -130,11 +210,15 @@ class SingleNodeLogicalPlan final : public LogicalPlan {
   AstStorage storage_;
   SymbolTable symbol_table_;
   plan::ReadWriteTypeChecker::RWType rw_type_;
+  std::optional<double> estimated_rows_;
 };
 
 using PlanCacheLRU =
     utils::Synchronized<utils::LRUCache<uint64_t, std::shared_ptr<query::PlanWrapper>>, utils::RWSpinLock>;
 
+/// Plans cached for a database, from the most to the least recently used.
+std::vector<std::shared_ptr<PlanWrapper>> ListCachedPlans(PlanCacheLRU const &plan_cache);
+
 std::unique_ptr<LogicalPlan> MakeLogicalPlan(AstStorage ast_storage, CypherQuery *query, const Parameters &parameters,
                                              DbAccessor *db_accessor,
                                              const std::vector<Identifier *> &predefined_identifiers);
@@ -146,10 +230,11 @@ std::unique_ptr<LogicalPlan> MakeLogicalPlan(AstStorage ast_storage, CypherQuery
  * If an identifier is not defined in a scope, we check the predefined identifiers.
  * If an identifier is contained there, we inject it at that place and remove it,
  * because a predefined identifier can be used only in one scope.
+ * Plans are cached per stripped query and parameter types, see PlanCacheKey.
  */
-std::shared_ptr<PlanWrapper> CypherQueryToPlan(uint64_t hash, AstStorage ast_storage, CypherQuery *query,
-                                               const Parameters &parameters, PlanCacheLRU *plan_cache,
-                                               DbAccessor *db_accessor,
+std::shared_ptr<PlanWrapper> CypherQueryToPlan(frontend::StrippedQuery const &stripped_query, AstStorage ast_storage,
+                                               CypherQuery *query, const Parameters &parameters,
+                                               PlanCacheLRU *plan_cache, DbAccessor *db_accessor,
                                                const std::vector<Identifier *> &predefined_identifiers = {});
 
 }  // namespace memgraph::query
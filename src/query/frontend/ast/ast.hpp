@@ -2724,7 +2724,16 @@ class DatabaseInfoQuery : public memgraph::query::Query {
   static const utils::TypeInfo kType;
   const utils::TypeInfo &GetTypeInfo() const override { return kType; }
 
-  enum class InfoType { INDEX, CONSTRAINT, EDGE_TYPES, NODE_LABELS, METRICS, VECTOR_INDEX };
+  enum class InfoType {
+    INDEX,
+    CONSTRAINT,
+    EDGE_TYPES,
+    NODE_LABELS,
+    METRICS,
+    VECTOR_INDEX,
+    PLAN_CACHE,
+    QUERY_STATISTICS
+  };
 
   DEFVISITABLE(QueryVisitor<void>);
 
@@ -134,6 +134,14 @@ antlrcpp::Any CypherMainVisitor::visitDatabaseInfoQuery(MemgraphCypher::Database
     info_query->info_type_ = DatabaseInfoQuery::InfoType::VECTOR_INDEX;
     return info_query;
   }
+  if (ctx->planCacheInfo()) {
+    info_query->info_type_ = DatabaseInfoQuery::InfoType::PLAN_CACHE;
+    return info_query;
+  }
+  if (ctx->queryStatisticsInfo()) {
+    info_query->info_type_ = DatabaseInfoQuery::InfoType::QUERY_STATISTICS;
+    return info_query;
+  }
   // Should never get here
   throw utils::NotYetImplemented("Database info query: '{}'", ctx->getText());
 }
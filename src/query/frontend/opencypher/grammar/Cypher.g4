@@ -62,7 +62,11 @@ vectorIndexInfo : VECTOR INDEX INFO ;
 
 buildInfo : BUILD INFO ;
 
-databaseInfoQuery : SHOW ( indexInfo | constraintInfo | edgetypeInfo | nodelabelInfo | metricsInfo | vectorIndexInfo ) ;
+planCacheInfo : PLAN CACHE ;
+
+queryStatisticsInfo : QUERY STATISTICS ;
+
+databaseInfoQuery : SHOW ( indexInfo | constraintInfo | edgetypeInfo | nodelabelInfo | metricsInfo | vectorIndexInfo | planCacheInfo | queryStatisticsInfo ) ;
 
 systemInfoQuery : SHOW ( storageInfo | buildInfo | activeUsersInfo | licenseInfo ) ;
 
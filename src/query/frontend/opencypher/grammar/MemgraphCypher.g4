@@ -37,6 +37,7 @@ memgraphCypherKeyword : cypherKeyword
                       | BOOLEAN
                       | BOOTSTRAP_SERVERS
                       | BUILD
+                      | CACHE
                       | CALL
                       | CHECK
                       | CLEAR
@@ -126,6 +127,7 @@ memgraphCypherKeyword : cypherKeyword
                       | ON_DISK_TRANSACTIONAL
                       | PASSWORD
                       | PERIODIC
+                      | PLAN
                       | POINT
                       | PORT
                       | PRIVILEGES
@@ -39,6 +39,7 @@ BEFORE                  : B E F O R E ;
 BOOLEAN                 : B O O L E A N ;
 BOOTSTRAP_SERVERS       : B O O T S T R A P UNDERSCORE S E R V E R S ;
 BUILD                   : B U I L D ;
+CACHE                   : C A C H E ;
 CALL                    : C A L L ;
 CHECK                   : C H E C K ;
 CLEAR                   : C L E A R ;
@@ -128,6 +129,7 @@ OFF                     : O F F ;
 ON_DISK_TRANSACTIONAL   : O N UNDERSCORE D I S K UNDERSCORE T R A N S A C T I O N A L ;
 PASSWORD                : P A S S W O R D ;
 PERIODIC                : P E R I O D I C ;
+PLAN                    : P L A N ;
 POINT                   : P O I N T ;
 PORT                    : P O R T ;
 PRIVILEGES              : P R I V I L E G E S ;
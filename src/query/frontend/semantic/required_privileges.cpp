@@ -65,6 +65,8 @@ class PrivilegeExtractor : public QueryVisitor<void>, public HierarchicalTreeVis
         AddPrivilege(AuthQuery::Privilege::CONSTRAINT);
         break;
       case DatabaseInfoQuery::InfoType::METRICS:
+      case DatabaseInfoQuery::InfoType::PLAN_CACHE:
+      case DatabaseInfoQuery::InfoType::QUERY_STATISTICS:
         AddPrivilege(AuthQuery::Privilege::STATS);
         break;
     }
@@ -113,6 +113,7 @@ const trie::Trie kKeywords = {"active",
                               "bootstrap_servers",
                               "build",
                               "by",
+                              "cache",
                               "call",
                               "case",
                               "check",
@@ -235,6 +236,7 @@ const trie::Trie kKeywords = {"active",
                               "or",
                               "order",
                               "password",
+                              "plan",
                               "point",
                               "port",
                               "privileges",
@@ -0,0 +1,374 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "query/interpret/compiled_predicate.hpp"
+
+#include <algorithm>
+#include <string_view>
+#include <utility>
+#include <variant>
+
+#include "query/exceptions.hpp"
+#include "storage/v2/property_value.hpp"
+#include "utils/logging.hpp"
+#include "utils/typeinfo.hpp"
+#include "utils/variant_helpers.hpp"
+
+namespace memgraph::query {
+
+namespace {
+
+/// Scalar value of either a TypedValue or a storage::PropertyValue, compared without conversions.
+struct Scalar {
+  enum class Type : uint8_t { Null, Bool, Int, Double, String };
+  Type type;
+  bool bool_v{false};
+  int64_t int_v{0};
+  double double_v{0.0};
+  std::string_view string_v;
+
+  bool IsNumeric() const { return type == Type::Int || type == Type::Double; }
+  double ToDouble() const { return type == Type::Int ? static_cast<double>(int_v) : double_v; }
+};
+
+std::optional<Scalar> ToScalar(const TypedValue &value) {
+  switch (value.type()) {
+    case TypedValue::Type::Null:
+      return Scalar{.type = Scalar::Type::Null};
+    case TypedValue::Type::Bool:
+      return Scalar{.type = Scalar::Type::Bool, .bool_v = value.ValueBool()};
+    case TypedValue::Type::Int:
+      return Scalar{.type = Scalar::Type::Int, .int_v = value.ValueInt()};
+    case TypedValue::Type::Double:
+      return Scalar{.type = Scalar::Type::Double, .double_v = value.ValueDouble()};
+    case TypedValue::Type::String:
+      return Scalar{.type = Scalar::Type::String, .string_v = value.ValueString()};
+    default:
+      return std::nullopt;
+  }
+}
+
+std::optional<Scalar> ToScalar(const storage::PropertyValue &value) {
+  switch (value.type()) {
+    case storage::PropertyValue::Type::Null:
+      return Scalar{.type = Scalar::Type::Null};
+    case storage::PropertyValue::Type::Bool:
+      return Scalar{.type = Scalar::Type::Bool, .bool_v = value.ValueBool()};
+    case storage::PropertyValue::Type::Int:
+      return Scalar{.type = Scalar::Type::Int, .int_v = value.ValueInt()};
+    case storage::PropertyValue::Type::Double:
+      return Scalar{.type = Scalar::Type::Double, .double_v = value.ValueDouble()};
+    case storage::PropertyValue::Type::String:
+      return Scalar{.type = Scalar::Type::String, .string_v = value.ValueString()};
+    default:
+      return std::nullopt;
+  }
+}
+
+/// Same as `a == b` on TypedValue, for non-null scalars.
+bool ScalarEqual(const Scalar &a, const Scalar &b) {
+  if (a.IsNumeric() && b.IsNumeric()) {
+    if (a.type == Scalar::Type::Int && b.type == Scalar::Type::Int) return a.int_v == b.int_v;
+    return a.ToDouble() == b.ToDouble();
+  }
+  if (a.type != b.type) return false;
+  if (a.type == Scalar::Type::String) return a.string_v == b.string_v;
+  return a.bool_v == b.bool_v;
+}
+
+/// Same as `a < b` on TypedValue, for non-null scalars. Returns std::nullopt for the combinations TypedValue
+/// doesn't allow, which are left to it so that it throws.
+std::optional<bool> ScalarLess(const Scalar &a, const Scalar &b) {
+  if (a.IsNumeric() && b.IsNumeric()) {
+    if (a.type == Scalar::Type::Int && b.type == Scalar::Type::Int) return a.int_v < b.int_v;
+    return a.ToDouble() < b.ToDouble();
+  }
+  if (a.type == Scalar::Type::String && b.type == Scalar::Type::String) return a.string_v < b.string_v;
+  return std::nullopt;
+}
+
+template <class TExpression>
+bool IsA(Expression *expression) {
+  return utils::Downcast<TExpression>(expression) != nullptr;
+}
+
+}  // namespace
+
+/// Value of an operand: a reference to a value on the frame or among the constants, an evaluated value or a
+/// property read straight from the storage. Null properties of null objects are std::monostate.
+class CompiledPredicate::OperandValue {
+ public:
+  using Value = std::variant<std::monostate, const TypedValue *, TypedValue, storage::PropertyValue>;
+
+  explicit OperandValue(Value value) : value_{std::move(value)} {}
+
+  bool IsNull() const {
+    return std::visit(utils::Overloaded{[](std::monostate) { return true; },
+                                        [](const TypedValue *value) { return value->IsNull(); },
+                                        [](const TypedValue &value) { return value.IsNull(); },
+                                        [](const storage::PropertyValue &value) { return value.IsNull(); }},
+                      value_);
+  }
+
+  std::optional<Scalar> AsScalar() const {
+    return std::visit(
+        utils::Overloaded{[](std::monostate) { return std::optional{Scalar{.type = Scalar::Type::Null}}; },
+                          [](const TypedValue *value) { return ToScalar(*value); },
+                          [](const TypedValue &value) { return ToScalar(value); },
+                          [](const storage::PropertyValue &value) { return ToScalar(value); }},
+        value_);
+  }
+
+  TypedValue ToTypedValue(ExpressionEvaluator &evaluator) const {
+    return std::visit(
+        utils::Overloaded{
+            [&](std::monostate) { return TypedValue(evaluator.GetMemoryResource()); },
+            [&](const TypedValue *value) { return TypedValue(*value, evaluator.GetMemoryResource()); },
+            [&](const TypedValue &value) { return TypedValue(value, evaluator.GetMemoryResource()); },
+            [&](const storage::PropertyValue &value) {
+              return TypedValue(value, evaluator.GetNameIdMapper(), evaluator.GetMemoryResource());
+            }},
+        value_);
+  }
+
+ private:
+  Value value_;
+};
+
+std::optional<CompiledPredicate> CompiledPredicate::Compile(Expression *expression) {
+  CompiledPredicate predicate;
+  auto root = predicate.CompileNode(expression);
+  if (!root) return std::nullopt;
+  predicate.root_ = *root;
+  return predicate;
+}
+
+std::optional<uint32_t> CompiledPredicate::CompileNode(Expression *expression) {
+  const auto nodes_before = nodes_.size();
+  const auto constants_before = constants_.size();
+  // Drops what was compiled for the operands of a node that can't be compiled itself
+  auto fail = [&]() -> std::optional<uint32_t> {
+    nodes_.resize(nodes_before);
+    constants_.resize(constants_before);
+    return std::nullopt;
+  };
+  auto add = [&](Node node) -> std::optional<uint32_t> {
+    nodes_.emplace_back(node);
+    return static_cast<uint32_t>(nodes_.size() - 1);
+  };
+  auto compile_connective = [&](Node::Kind kind, BinaryOperator *op) -> std::optional<uint32_t> {
+    auto lhs = CompileNode(op->expression1_);
+    if (!lhs) return fail();
+    auto rhs = CompileNode(op->expression2_);
+    if (!rhs) return fail();
+    return add({.kind = kind, .lhs_node = *lhs, .rhs_node = *rhs});
+  };
+  auto compile_comparison = [&](CompareOp compare_op, BinaryOperator *op) {
+    auto lhs = CompileOperand(op->expression1_);
+    auto rhs = CompileOperand(op->expression2_);
+    return add({.kind = Node::Kind::COMPARE, .op = compare_op, .lhs = lhs, .rhs = rhs});
+  };
+
+  if (auto *op = utils::Downcast<AndOperator>(expression)) return compile_connective(Node::Kind::AND, op);
+  if (auto *op = utils::Downcast<OrOperator>(expression)) return compile_connective(Node::Kind::OR, op);
+  if (auto *op = utils::Downcast<NotOperator>(expression)) {
+    auto child = CompileNode(op->expression_);
+    if (!child) return fail();
+    return add({.kind = Node::Kind::NOT, .lhs_node = *child});
+  }
+  if (auto *op = utils::Downcast<EqualOperator>(expression)) return compile_comparison(CompareOp::EQUAL, op);
+  if (auto *op = utils::Downcast<NotEqualOperator>(expression)) return compile_comparison(CompareOp::NOT_EQUAL, op);
+  if (auto *op = utils::Downcast<LessOperator>(expression)) return compile_comparison(CompareOp::LESS, op);
+  if (auto *op = utils::Downcast<GreaterOperator>(expression)) return compile_comparison(CompareOp::GREATER, op);
+  if (auto *op = utils::Downcast<LessEqualOperator>(expression)) return compile_comparison(CompareOp::LESS_EQUAL, op);
+  if (auto *op = utils::Downcast<GreaterEqualOperator>(expression)) {
+    return compile_comparison(CompareOp::GREATER_EQUAL, op);
+  }
+  if (auto *op = utils::Downcast<IsNullOperator>(expression)) {
+    return add({.kind = Node::Kind::IS_NULL, .lhs = CompileOperand(op->expression_)});
+  }
+  return fail();
+}
+
+CompiledPredicate::Operand CompiledPredicate::CompileOperand(Expression *expression) {
+  if (IsConstant(expression)) {
+    constants_.emplace_back(expression);
+    return {.kind = Operand::Kind::CONSTANT, .constant = static_cast<uint32_t>(constants_.size() - 1)};
+  }
+  if (auto *identifier = utils::Downcast<Identifier>(expression)) {
+    return {.kind = Operand::Kind::IDENTIFIER, .identifier = identifier};
+  }
+  if (auto *lookup = utils::Downcast<PropertyLookup>(expression)) {
+    // Lookups of all properties are cached by the evaluator, leave them to it
+    auto *identifier = utils::Downcast<Identifier>(lookup->expression_);
+    if (identifier && lookup->evaluation_mode_ == PropertyLookup::EvaluationMode::GET_OWN_PROPERTY) {
+      return {.kind = Operand::Kind::PROPERTY, .identifier = identifier, .property_lookup = lookup};
+    }
+  }
+  return {.kind = Operand::Kind::EXPRESSION, .expression = expression};
+}
+
+bool CompiledPredicate::IsConstant(Expression *expression) const {
+  if (IsA<PrimitiveLiteral>(expression) || IsA<ParameterLookup>(expression)) return true;
+  if (auto *list = utils::Downcast<ListLiteral>(expression)) {
+    return std::ranges::all_of(list->elements_, [this](auto *element) { return IsConstant(element); });
+  }
+  if (auto *map = utils::Downcast<MapLiteral>(expression)) {
+    return std::ranges::all_of(map->elements_, [this](const auto &element) { return IsConstant(element.second); });
+  }
+  if (IsA<UnaryMinusOperator>(expression) || IsA<UnaryPlusOperator>(expression) || IsA<NotOperator>(expression)) {
+    return IsConstant(static_cast<UnaryOperator *>(expression)->expression_);
+  }
+  if (IsA<AdditionOperator>(expression) || IsA<SubtractionOperator>(expression) ||
+      IsA<MultiplicationOperator>(expression) || IsA<DivisionOperator>(expression) || IsA<ModOperator>(expression)) {
+    auto *op = static_cast<BinaryOperator *>(expression);
+    return IsConstant(op->expression1_) && IsConstant(op->expression2_);
+  }
+  return false;
+}
+
+bool CompiledPredicate::Evaluate(ExpressionEvaluator &evaluator, Constants &constants) const {
+  DMG_ASSERT(constants.size() == constants_.size(), "Constants don't belong to this predicate");
+  // Null is treated like false.
+  return EvaluateNode(root_, evaluator, constants) == Ternary::True;
+}
+
+CompiledPredicate::Ternary CompiledPredicate::EvaluateNode(uint32_t index, ExpressionEvaluator &evaluator,
+                                                           Constants &constants) const {
+  const auto &node = nodes_[index];
+  switch (node.kind) {
+    case Node::Kind::AND: {
+      const auto lhs = EvaluateNode(node.lhs_node, evaluator, constants);
+      // If first expression is false, don't evaluate the second one.
+      if (lhs == Ternary::False) return Ternary::False;
+      const auto rhs = EvaluateNode(node.rhs_node, evaluator, constants);
+      if (rhs == Ternary::False) return Ternary::False;
+      if (lhs == Ternary::Null || rhs == Ternary::Null) return Ternary::Null;
+      return Ternary::True;
+    }
+    case Node::Kind::OR: {
+      const auto lhs = EvaluateNode(node.lhs_node, evaluator, constants);
+      // If first expression is true, don't evaluate the second one.
+      if (lhs == Ternary::True) return Ternary::True;
+      const auto rhs = EvaluateNode(node.rhs_node, evaluator, constants);
+      if (rhs == Ternary::True) return Ternary::True;
+      if (lhs == Ternary::Null || rhs == Ternary::Null) return Ternary::Null;
+      return Ternary::False;
+    }
+    case Node::Kind::NOT: {
+      const auto value = EvaluateNode(node.lhs_node, evaluator, constants);
+      if (value == Ternary::Null) return Ternary::Null;
+      return value == Ternary::True ? Ternary::False : Ternary::True;
+    }
+    case Node::Kind::COMPARE: {
+      const auto lhs = EvaluateOperand(node.lhs, evaluator, constants);
+      const auto rhs = EvaluateOperand(node.rhs, evaluator, constants);
+      return Compare(node.op, lhs, rhs, evaluator);
+    }
+    case Node::Kind::IS_NULL:
+      return EvaluateOperand(node.lhs, evaluator, constants).IsNull() ? Ternary::True : Ternary::False;
+  }
+  LOG_FATAL("Unknown compiled predicate node");
+}
+
+CompiledPredicate::OperandValue CompiledPredicate::EvaluateOperand(const Operand &operand,
+                                                                   ExpressionEvaluator &evaluator,
+                                                                   Constants &constants) const {
+  switch (operand.kind) {
+    case Operand::Kind::CONSTANT: {
+      auto &constant = constants[operand.constant];
+      if (!constant) constant.emplace(constants_[operand.constant]->Accept(evaluator));
+      return OperandValue{static_cast<const TypedValue *>(&*constant)};
+    }
+    case Operand::Kind::IDENTIFIER: {
+      const auto &value = evaluator.GetIdentifierValue(*operand.identifier);
+      return OperandValue{&value};
+    }
+    case Operand::Kind::PROPERTY: {
+      const auto &object = evaluator.GetIdentifierValue(*operand.identifier);
+      switch (object.type()) {
+        case TypedValue::Type::Null:
+          return OperandValue{std::monostate{}};
+        case TypedValue::Type::Vertex:
+          return OperandValue{evaluator.GetStoredProperty(object.ValueVertex(), operand.property_lookup->property_)};
+        case TypedValue::Type::Edge:
+          return OperandValue{evaluator.GetStoredProperty(object.ValueEdge(), operand.property_lookup->property_)};
+        default:
+          // Maps, temporal types, points...
+          return OperandValue{operand.property_lookup->Accept(evaluator)};
+      }
+    }
+    case Operand::Kind::EXPRESSION:
+      return OperandValue{operand.expression->Accept(evaluator)};
+  }
+  LOG_FATAL("Unknown compiled predicate operand");
+}
+
+CompiledPredicate::Ternary CompiledPredicate::Compare(CompareOp op, const OperandValue &lhs, const OperandValue &rhs,
+                                                      ExpressionEvaluator &evaluator) {
+  const auto lhs_scalar = lhs.AsScalar();
+  const auto rhs_scalar = rhs.AsScalar();
+  // TypedValue rejects ordering booleans before it looks for nulls, so it has to see them to throw
+  const auto is_ordering = op != CompareOp::EQUAL && op != CompareOp::NOT_EQUAL;
+  const auto orders_bool = [&](const Scalar &scalar) { return is_ordering && scalar.type == Scalar::Type::Bool; };
+  if (lhs_scalar && rhs_scalar && !orders_bool(*lhs_scalar) && !orders_bool(*rhs_scalar)) {
+    if (lhs_scalar->type == Scalar::Type::Null || rhs_scalar->type == Scalar::Type::Null) return Ternary::Null;
+    auto to_ternary = [](bool value) { return value ? Ternary::True : Ternary::False; };
+    // Other comparisons are defined through `<` and `==`, same as on TypedValue
+    switch (op) {
+      case CompareOp::EQUAL:
+        return to_ternary(ScalarEqual(*lhs_scalar, *rhs_scalar));
+      case CompareOp::NOT_EQUAL:
+        return to_ternary(!ScalarEqual(*lhs_scalar, *rhs_scalar));
+      case CompareOp::LESS:
+      case CompareOp::GREATER:
+      case CompareOp::LESS_EQUAL:
+      case CompareOp::GREATER_EQUAL: {
+        const auto less = ScalarLess(*lhs_scalar, *rhs_scalar);
+        if (!less) break;
+        if (op == CompareOp::LESS) return to_ternary(*less);
+        if (op == CompareOp::GREATER_EQUAL) return to_ternary(!*less);
+        const auto less_equal = *less || ScalarEqual(*lhs_scalar, *rhs_scalar);
+        return to_ternary(op == CompareOp::LESS_EQUAL ? less_equal : !less_equal);
+      }
+    }
+  }
+
+  // Lists, maps, temporal types... and invalid comparisons, which TypedValue reports
+  const auto val1 = lhs.ToTypedValue(evaluator);
+  const auto val2 = rhs.ToTypedValue(evaluator);
+  auto compare = [&](std::string_view cypher_op, auto &&typed_value_op) {
+    try {
+      const auto result = typed_value_op(val1, val2);
+      if (result.IsNull()) return Ternary::Null;
+      return result.ValueBool() ? Ternary::True : Ternary::False;
+    } catch (const TypedValueException &) {
+      throw QueryRuntimeException("Invalid types: {} and {} for '{}'.", val1.type(), val2.type(), cypher_op);
+    }
+  };
+  switch (op) {
+    case CompareOp::EQUAL:
+      return compare("=", [](const auto &a, const auto &b) { return a == b; });
+    case CompareOp::NOT_EQUAL:
+      return compare("<>", [](const auto &a, const auto &b) { return a != b; });
+    case CompareOp::LESS:
+      return compare("<", [](const auto &a, const auto &b) { return a < b; });
+    case CompareOp::GREATER:
+      return compare(">", [](const auto &a, const auto &b) { return a > b; });
+    case CompareOp::LESS_EQUAL:
+      return compare("<=", [](const auto &a, const auto &b) { return a <= b; });
+    case CompareOp::GREATER_EQUAL:
+      return compare(">=", [](const auto &a, const auto &b) { return a >= b; });
+  }
+  LOG_FATAL("Unknown compiled predicate comparison");
+}
+
+}  // namespace memgraph::query
@@ -0,0 +1,98 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+/// @file
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include "query/frontend/ast/ast.hpp"
+#include "query/interpret/eval.hpp"
+#include "query/typed_value.hpp"
+
+namespace memgraph::query {
+
+/// A filter expression compiled into a flat tree of nodes, meant to be built once per plan.
+///
+/// Boolean connectives, comparisons and IS NULL checks over identifiers, property lookups and constant
+/// subexpressions are evaluated without going through the AST visitor: identifiers are compared in place on the
+/// frame, properties are compared as storage values without converting them to TypedValue, and int, double, string
+/// and bool comparisons take a direct path. Everything else is handed to the ExpressionEvaluator, so the results and
+/// the errors are the same as when evaluating the expression itself.
+class CompiledPredicate {
+ public:
+  /// Values of the constant subexpressions (literals, parameters and operators applied to them). They can differ
+  /// between executions of the same plan because of parameters, so each execution keeps its own, evaluated on first
+  /// use.
+  using Constants = std::vector<std::optional<TypedValue>>;
+
+  /// Returns std::nullopt if the root of `expression` isn't a boolean connective, a comparison or an IS NULL check,
+  /// in which case there is nothing to gain over evaluating the expression directly.
+  static std::optional<CompiledPredicate> Compile(Expression *expression);
+
+  size_t ConstantsCount() const { return constants_.size(); }
+
+  /// Same result as evaluating the expression with `evaluator` and treating null as false.
+  /// @throw QueryRuntimeException
+  bool Evaluate(ExpressionEvaluator &evaluator, Constants &constants) const;
+
+ private:
+  enum class Ternary : uint8_t { False, True, Null };
+
+  enum class CompareOp : uint8_t { EQUAL, NOT_EQUAL, LESS, GREATER, LESS_EQUAL, GREATER_EQUAL };
+
+  struct Operand {
+    enum class Kind : uint8_t { CONSTANT, IDENTIFIER, PROPERTY, EXPRESSION };
+    Kind kind;
+    // CONSTANT
+    uint32_t constant{0};
+    // IDENTIFIER, PROPERTY (the looked up object)
+    Identifier *identifier{nullptr};
+    // PROPERTY
+    PropertyLookup *property_lookup{nullptr};
+    // EXPRESSION
+    Expression *expression{nullptr};
+  };
+
+  struct Node {
+    enum class Kind : uint8_t { AND, OR, NOT, COMPARE, IS_NULL };
+    Kind kind;
+    // AND, OR, NOT (only `lhs_node`)
+    uint32_t lhs_node{0};
+    uint32_t rhs_node{0};
+    // COMPARE, IS_NULL (only `lhs`)
+    CompareOp op{CompareOp::EQUAL};
+    Operand lhs{};
+    Operand rhs{};
+  };
+
+  class OperandValue;
+
+  CompiledPredicate() = default;
+
+  std::optional<uint32_t> CompileNode(Expression *expression);
+  Operand CompileOperand(Expression *expression);
+  bool IsConstant(Expression *expression) const;
+
+  Ternary EvaluateNode(uint32_t index, ExpressionEvaluator &evaluator, Constants &constants) const;
+  OperandValue EvaluateOperand(const Operand &operand, ExpressionEvaluator &evaluator, Constants &constants) const;
+  static Ternary Compare(CompareOp op, const OperandValue &lhs, const OperandValue &rhs,
+                         ExpressionEvaluator &evaluator);
+
+  std::vector<Node> nodes_;
+  std::vector<Expression *> constants_;
+  uint32_t root_{0};
+};
+
+}  // namespace memgraph::query
@@ -83,8 +83,8 @@ TypedValue ExpressionEvaluator::Visit(RegexMatch &regex_match) {
   }
   const auto &target_string = target_string_value.ValueString();
   try {
-    std::regex const regex(regex_value.ValueString());
-    return TypedValue(std::regex_match(target_string, regex), ctx_->memory);
+    const auto &matcher = ctx_->regex_cache.Get(regex_value.ValueString());
+    return TypedValue(matcher.Match(target_string), ctx_->memory);
   } catch (const std::regex_error &e) {
     throw QueryRuntimeException("Regex error in '{}': {}", regex_value.ValueString(), e.what());
   }
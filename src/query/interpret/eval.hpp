@@ -40,6 +40,8 @@
 
 namespace memgraph::query {
 
+class CompiledPredicate;
+
 class ReferenceExpressionEvaluator : public ExpressionVisitor<TypedValue *> {
  public:
   ReferenceExpressionEvaluator(Frame *frame, const SymbolTable *symbol_table, const EvaluationContext *ctx)
@@ -202,6 +204,18 @@ class ExpressionEvaluator : public ExpressionVisitor<TypedValue> {
 
   storage::NameIdMapper *GetNameIdMapper() const { return dba_->GetStorageAccessor()->GetNameIdMapper(); }
 
+  /// Value of `identifier` on the frame, without copying it.
+  const TypedValue &GetIdentifierValue(const Identifier &identifier) const {
+    return frame_->at(symbol_table_->at(identifier));
+  }
+
+  /// Property of a vertex or an edge as the stored value, without converting it to TypedValue.
+  /// @throw QueryRuntimeException
+  template <class TRecordAccessor>
+  storage::PropertyValue GetStoredProperty(const TRecordAccessor &record_accessor, const PropertyIx &prop) {
+    return GetProperty(record_accessor, prop);
+  }
+
   void ResetPropertyLookupCache() { property_lookup_cache_.clear(); }
 
   TypedValue Visit(NamedExpression &named_expression) override {
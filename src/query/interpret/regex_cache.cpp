@@ -0,0 +1,83 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "query/interpret/regex_cache.hpp"
+
+#include <algorithm>
+
+namespace memgraph::query {
+
+namespace {
+
+constexpr std::string_view kAnyString = ".*";
+
+bool IsLiteral(std::string_view pattern) {
+  constexpr std::string_view kMetaCharacters = "\\^$.|?*+()[]{}";
+  return pattern.find_first_of(kMetaCharacters) == std::string_view::npos;
+}
+
+bool HasLineTerminator(std::string_view str) { return str.find_first_of("\n\r") != std::string_view::npos; }
+
+}  // namespace
+
+RegexMatcher::RegexMatcher(std::string_view pattern) : pattern_(pattern) {
+  auto literal = pattern;
+  const bool any_prefix = literal.starts_with(kAnyString);
+  if (any_prefix) literal.remove_prefix(kAnyString.size());
+  const bool any_suffix = literal.size() >= kAnyString.size() && literal.ends_with(kAnyString);
+  if (any_suffix) literal.remove_suffix(kAnyString.size());
+
+  if (!IsLiteral(literal)) {
+    regex_.emplace(pattern_, std::regex::ECMAScript | std::regex::optimize);
+    return;
+  }
+  literal_ = literal;
+  if (any_prefix && any_suffix) {
+    kind_ = Kind::CONTAINS;
+  } else if (any_prefix) {
+    kind_ = Kind::SUFFIX;
+  } else if (any_suffix) {
+    kind_ = Kind::PREFIX;
+  } else {
+    kind_ = Kind::EQUAL;
+  }
+}
+
+const std::regex &RegexMatcher::Regex() const {
+  if (!regex_) regex_.emplace(pattern_, std::regex::ECMAScript | std::regex::optimize);
+  return *regex_;
+}
+
+bool RegexMatcher::Match(std::string_view target) const {
+  switch (kind_) {
+    case Kind::EQUAL:
+      return target == literal_;
+    case Kind::PREFIX:
+    case Kind::SUFFIX:
+    case Kind::CONTAINS:
+      if (HasLineTerminator(target)) break;
+      if (kind_ == Kind::PREFIX) return target.starts_with(literal_);
+      if (kind_ == Kind::SUFFIX) return target.ends_with(literal_);
+      return target.find(literal_) != std::string_view::npos;
+    case Kind::REGEX:
+      break;
+  }
+  return std::regex_match(target.begin(), target.end(), Regex());
+}
+
+const RegexMatcher &RegexCache::Get(std::string_view pattern) {
+  if (auto it = matchers_.find(pattern); it != matchers_.end()) return it->second;
+  if (matchers_.size() >= kMaxSize) matchers_.clear();
+  auto matcher = RegexMatcher(pattern);
+  return matchers_.emplace(std::string(pattern), std::move(matcher)).first->second;
+}
+
+}  // namespace memgraph::query
@@ -0,0 +1,66 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+/// @file
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <optional>
+#include <regex>
+#include <string>
+#include <string_view>
+
+namespace memgraph::query {
+
+/// Full match of a string against a regular expression (ECMAScript grammar, same as `std::regex`).
+///
+/// Patterns which are a literal, optionally surrounded by `.*`, are matched with plain string comparisons and never
+/// compiled into a `std::regex`. Since `.` doesn't match line terminators, those fall back to the regex when the
+/// matched string contains one.
+class RegexMatcher {
+ public:
+  /// @throw std::regex_error if the pattern isn't a valid regular expression.
+  explicit RegexMatcher(std::string_view pattern);
+
+  bool Match(std::string_view target) const;
+
+ private:
+  enum class Kind : uint8_t { EQUAL, PREFIX, SUFFIX, CONTAINS, REGEX };
+
+  const std::regex &Regex() const;
+
+  Kind kind_{Kind::REGEX};
+  std::string pattern_;
+  // The literal part of the pattern for all kinds but REGEX
+  std::string literal_;
+  // Compiled on first use for the literal kinds
+  mutable std::optional<std::regex> regex_;
+};
+
+/// Regular expressions compiled during the execution of a single query, keyed by their pattern. A pattern usually
+/// comes from a literal or a parameter, so it is compiled once instead of once for each row.
+class RegexCache {
+ public:
+  /// Bounds the memory used by queries which build a distinct pattern for each row.
+  static constexpr size_t kMaxSize = 1024;
+
+  /// @throw std::regex_error if the pattern isn't a valid regular expression.
+  const RegexMatcher &Get(std::string_view pattern);
+
+  size_t size() const { return matchers_.size(); }
+
+ private:
+  std::map<std::string, RegexMatcher, std::less<>> matchers_;
+};
+
+}  // namespace memgraph::query
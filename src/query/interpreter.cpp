@@ -24,6 +24,7 @@
 #include <limits>
 #include <memory>
 #include <optional>
+#include <random>
 #include <string_view>
 #include <thread>
 #include <tuple>
@@ -66,6 +67,7 @@
 #include "query/plan/fmt.hpp"
 #include "query/plan/hint_provider.hpp"
 #include "query/plan/planner.hpp"
+#include "query/plan/pretty_print.hpp"
 #include "query/plan/profile.hpp"
 #include "query/plan/vertex_count_cache.hpp"
 #include "query/procedure/module.hpp"
@@ -96,6 +98,7 @@
 #include "utils/build_info.hpp"
 #include "utils/event_counter.hpp"
 #include "utils/event_histogram.hpp"
+#include "utils/event_labeled_histogram.hpp"
 #include "utils/exceptions.hpp"
 #include "utils/functional.hpp"
 #include "utils/likely.hpp"
@@ -130,6 +133,7 @@ extern const Event StreamsCreated;
 extern const Event TriggersCreated;
 
 extern const Event QueryExecutionLatency_us;
+extern const Event QueryLatency_us;
 
 extern const Event CommitedTransactions;
 extern const Event RollbackedTransactions;
@@ -2237,7 +2241,8 @@ struct PullPlan {
                     std::optional<QueryLogger> &query_logger,
                     TriggerContextCollector *trigger_context_collector = nullptr,
                     std::optional<size_t> memory_limit = {}, FrameChangeCollector *frame_change_collector_ = nullptr,
-                    std::optional<int64_t> hops_limit = {});
+                    std::optional<int64_t> hops_limit = {}, std::optional<SlowQueryLog::Entry> *slow_query = nullptr,
+                    std::string slow_query_text = {}, utils::MemoryTracker *database_memory_tracker = nullptr);
 
   std::optional<plan::ProfilingStatsWithTotalTime> Pull(AnyStream *stream, std::optional<int> n,
                                                         const std::vector<Symbol> &output_symbols,
@@ -2249,6 +2254,8 @@ struct PullPlan {
   Frame frame_;
   ExecutionContext ctx_;
   std::optional<size_t> memory_limit_;
+  // Shared by all queries of the database, set if the database has a memory limit
+  utils::MemoryTracker *database_memory_tracker_;
   // NOLINTNEXTLINE(cppcoreguidelines-avoid-const-or-ref-data-members)
   std::optional<QueryLogger> &query_logger_;
 
@@ -2264,20 +2271,49 @@ struct PullPlan {
   // we have to keep track of any unsent results from previous `PullPlan::Pull`
   // manually by using this flag.
   bool has_unsent_results_ = false;
+
+  // Rows pulled from the plan so far, reported back to a cached plan once the
+  // query finishes so that a badly estimated plan gets replaced.
+  uint64_t returned_rows_ = 0;
+
+  // The execution was picked by --query-profile-sample-rate; its operator
+  // statistics are added to the cached plan once the query finishes.
+  bool record_profile_ = false;
+
+  // Set once the query finishes if it crossed one of the slow query log
+  // thresholds; the interpreter adds the commit time and records it.
+  std::optional<SlowQueryLog::Entry> *slow_query_ = nullptr;
+  // The stripped query for the slow query log when the plan isn't cached,
+  // otherwise it is taken from the plan's cache key.
+  std::string slow_query_text_;
 };
 
+namespace {
+bool SampleProfile() {
+  const auto rate = FLAGS_query_profile_sample_rate;
+  if (rate <= 0.0) return false;
+  if (rate >= 1.0) return true;
+  thread_local std::mt19937_64 generator{std::random_device{}()};
+  return std::uniform_real_distribution<double>{0.0, 1.0}(generator) < rate;
+}
+}  // namespace
+
 PullPlan::PullPlan(const std::shared_ptr<PlanWrapper> plan, const Parameters &parameters, const bool is_profile_query,
                    DbAccessor *dba, InterpreterContext *interpreter_context, utils::MemoryResource *execution_memory,
                    std::shared_ptr<QueryUserOrRole> user_or_role, std::atomic<TransactionStatus> *transaction_status,
                    std::shared_ptr<utils::AsyncTimer> tx_timer, DatabaseAccessProtector db_acc,
                    std::optional<QueryLogger> &query_logger, TriggerContextCollector *trigger_context_collector,
                    const std::optional<size_t> memory_limit, FrameChangeCollector *frame_change_collector,
-                   const std::optional<int64_t> hops_limit)
+                   const std::optional<int64_t> hops_limit, std::optional<SlowQueryLog::Entry> *slow_query,
+                   std::string slow_query_text, utils::MemoryTracker *database_memory_tracker)
     : plan_(plan),
       cursor_(plan->plan().MakeCursor(execution_memory)),
       frame_(plan->symbol_table().max_position(), execution_memory),
       memory_limit_(memory_limit),
-      query_logger_(query_logger) {
+      database_memory_tracker_(database_memory_tracker),
+      query_logger_(query_logger),
+      slow_query_(slow_query),
+      slow_query_text_(std::move(slow_query_text)) {
   ctx_.hops_limit = query::HopsLimit{hops_limit};
   ctx_.db_accessor = dba;
   ctx_.symbol_table = plan->symbol_table();
@@ -2302,7 +2338,8 @@ PullPlan::PullPlan(const std::shared_ptr<PlanWrapper> plan, const Parameters &pa
   ctx_.timer = std::move(tx_timer);
   ctx_.is_shutting_down = &interpreter_context->is_shutting_down;
   ctx_.transaction_status = transaction_status;
-  ctx_.is_profile_query = is_profile_query;
+  record_profile_ = !is_profile_query && plan->cache_key() && SampleProfile();
+  ctx_.is_profile_query = is_profile_query || record_profile_;
   ctx_.trigger_context_collector = trigger_context_collector;
   ctx_.frame_change_collector = frame_change_collector;
   ctx_.evaluation_context.memory = execution_memory;
@@ -2312,15 +2349,17 @@ PullPlan::PullPlan(const std::shared_ptr<PlanWrapper> plan, const Parameters &pa
 std::optional<plan::ProfilingStatsWithTotalTime> PullPlan::Pull(AnyStream *stream, std::optional<int> n,
                                                                 const std::vector<Symbol> &output_symbols,
                                                                 std::map<std::string, TypedValue> *summary) {
-  if (memory_limit_) {
+  const bool track_memory = memory_limit_ || database_memory_tracker_;
+  if (track_memory) {
     auto &memory_tracker = ctx_.db_accessor->GetQueryMemoryTracker();
     if (!memory_tracker) memory_tracker = std::make_unique<utils::QueryMemoryTracker>();
-    memory_tracker->SetQueryLimit(*memory_limit_);
+    if (memory_limit_) memory_tracker->SetQueryLimit(*memory_limit_);
+    memory_tracker->SetDatabaseTracker(database_memory_tracker_);
     memgraph::memory::StartTrackingCurrentThread(memory_tracker.get());
   }
 
-  const utils::OnScopeExit reset_query_limit{[this]() {
-    if (memory_limit_.has_value()) {
+  const utils::OnScopeExit reset_query_limit{[this, track_memory]() {
+    if (track_memory) {
       // Stopping tracking of transaction occurs in interpreter::pull
       // Exception can occur so we need to handle that case there.
       // We can't stop tracking here as there can be multiple pulls
@@ -2335,7 +2374,11 @@ std::optional<plan::ProfilingStatsWithTotalTime> PullPlan::Pull(AnyStream *strea
   }};
 
   // Returns true if a result was pulled.
-  const auto pull_result = [&]() -> bool { return cursor_->Pull(frame_, ctx_); };
+  const auto pull_result = [&]() -> bool {
+    if (!cursor_->Pull(frame_, ctx_)) return false;
+    ++returned_rows_;
+    return true;
+  };
 
   auto values = std::vector<TypedValue>(output_symbols.size());
   const auto stream_values = [&] {
@@ -2405,17 +2448,40 @@ std::optional<plan::ProfilingStatsWithTotalTime> PullPlan::Pull(AnyStream *strea
   }
   cursor_->Shutdown();
   ctx_.profile_execution_time = execution_time_;
+  plan_->RecordReturnedRows(returned_rows_);
 
   if (!flags::run_time::GetHopsLimitPartialResults() && ctx_.hops_limit.IsLimitReached()) {
     throw QueryException("Query exceeded the maximum number of hops.");
   }
 
   auto stats_and_total_time = GetStatsWithTotalTime(ctx_);
+  if (record_profile_) {
+    plan_->RecordProfile(stats_and_total_time);
+    plan::MeasureOperatorMetrics(stats_and_total_time, ctx_.db_accessor->GetStorageAccessor()->id());
+  }
 
   if (query_logger_) {
     query_logger_->trace(fmt::format("Profile plan\n{}", ProfilingStatsToJson(stats_and_total_time).dump()));
   }
 
+  if (slow_query_) {
+    std::optional<int64_t> memory_peak;
+    if (const auto &memory_tracker = ctx_.db_accessor->GetQueryMemoryTracker()) {
+      memory_peak = memory_tracker->QueryPeak();
+    }
+    if (SlowQueryLog::IsSlow(execution_time_, memory_peak)) {
+      auto &entry = slow_query_->emplace();
+      entry.db = ctx_.db_accessor->GetStorageAccessor()->id();
+      entry.query = plan_->cache_key() ? plan_->cache_key()->query : std::move(slow_query_text_);
+      entry.parameters_hash = SlowQueryLog::HashParameters(ctx_.evaluation_context.parameters);
+      entry.rows = returned_rows_;
+      entry.execution_time = execution_time_.count();
+      entry.memory_peak = memory_peak;
+      entry.plan = ctx_.is_profile_query ? ProfilingStatsToJson(stats_and_total_time)
+                                         : plan::PlanToJson(*ctx_.db_accessor, &plan_->plan());
+    }
+  }
+
   return stats_and_total_time;
 }
 
@@ -2567,7 +2633,8 @@ PreparedQuery PrepareCypherQuery(ParsedQuery parsed_query, std::map<std::string,
                                  std::shared_ptr<QueryUserOrRole> user_or_role,
                                  std::atomic<TransactionStatus> *transaction_status,
                                  std::shared_ptr<utils::AsyncTimer> tx_timer, Interpreter &interpreter,
-                                 FrameChangeCollector *frame_change_collector = nullptr) {
+                                 FrameChangeCollector *frame_change_collector = nullptr,
+                                 std::optional<SlowQueryLog::Entry> *slow_query = nullptr) {
   auto *cypher_query = utils::Downcast<CypherQuery>(parsed_query.query);
 
   EvaluationContext evaluation_context;
@@ -2603,7 +2670,7 @@ PreparedQuery PrepareCypherQuery(ParsedQuery parsed_query, std::map<std::string,
   const auto is_cacheable = parsed_query.is_cacheable;
   auto *plan_cache = is_cacheable ? current_db.db_acc_->get()->plan_cache() : nullptr;
 
-  auto plan = CypherQueryToPlan(parsed_query.stripped_query.hash(), std::move(parsed_query.ast_storage), cypher_query,
+  auto plan = CypherQueryToPlan(parsed_query.stripped_query, std::move(parsed_query.ast_storage), cypher_query,
                                 parsed_query.parameters, plan_cache, dba);
 
   auto hints = plan::ProvidePlanHints(&plan->plan(), plan->symbol_table());
@@ -2641,11 +2708,16 @@ PreparedQuery PrepareCypherQuery(ParsedQuery parsed_query, std::map<std::string,
   // TODO: pass current DB into plan, in future current can change during pull
   auto *trigger_context_collector =
       current_db.trigger_context_collector_ ? &*current_db.trigger_context_collector_ : nullptr;
+  // The slow query entry is only made once the query turns out to be slow. A cached plan keeps the stripped query in
+  // its cache key, otherwise it is moved along with the plan.
+  auto slow_query_text =
+      slow_query && !plan->cache_key() ? std::move(parsed_query.stripped_query).query() : std::string{};
   auto pull_plan = std::make_shared<PullPlan>(
       plan, parsed_query.parameters, is_profile_query, dba, interpreter_context, execution_memory,
       std::move(user_or_role), transaction_status, std::move(tx_timer), current_db.db_acc_, interpreter.query_logger_,
       trigger_context_collector, memory_limit,
-      frame_change_collector->IsTrackingValues() ? frame_change_collector : nullptr, hops_limit);
+      frame_change_collector->IsTrackingValues() ? frame_change_collector : nullptr, hops_limit, slow_query,
+      std::move(slow_query_text), current_db.db_acc_->get()->query_memory_tracker());
   return PreparedQuery{std::move(header),
                        std::move(parsed_query.required_privileges),
                        [pull_plan = std::move(pull_plan), output_symbols = std::move(output_symbols), summary](
@@ -2686,7 +2758,7 @@ PreparedQuery PrepareExplainQuery(ParsedQuery parsed_query, std::map<std::string
   auto *plan_cache = parsed_inner_query.is_cacheable ? current_db.db_acc_->get()->plan_cache() : nullptr;
 
   auto cypher_query_plan =
-      CypherQueryToPlan(parsed_inner_query.stripped_query.hash(), std::move(parsed_inner_query.ast_storage),
+      CypherQueryToPlan(parsed_inner_query.stripped_query, std::move(parsed_inner_query.ast_storage),
                         cypher_query, parsed_inner_query.parameters, plan_cache, dba);
 
   auto hints = plan::ProvidePlanHints(&cypher_query_plan->plan(), cypher_query_plan->symbol_table());
@@ -2775,7 +2847,7 @@ PreparedQuery PrepareProfileQuery(ParsedQuery parsed_query, bool in_explicit_tra
 
   auto *plan_cache = parsed_inner_query.is_cacheable ? current_db.db_acc_->get()->plan_cache() : nullptr;
   auto cypher_query_plan =
-      CypherQueryToPlan(parsed_inner_query.stripped_query.hash(), std::move(parsed_inner_query.ast_storage),
+      CypherQueryToPlan(parsed_inner_query.stripped_query, std::move(parsed_inner_query.ast_storage),
                         cypher_query, parsed_inner_query.parameters, plan_cache, dba);
   TryCaching(cypher_query_plan->ast_storage(), frame_change_collector);
 
@@ -2797,6 +2869,7 @@ PreparedQuery PrepareProfileQuery(ParsedQuery parsed_query, bool in_explicit_tra
        stats_and_total_time = std::optional<plan::ProfilingStatsWithTotalTime>{},
        pull_plan = std::shared_ptr<PullPlanVector>(nullptr), transaction_status, frame_change_collector,
        tx_timer = std::move(tx_timer), db_acc = current_db.db_acc_, hops_limit,
+       database_memory_tracker = current_db.db_acc_->get()->query_memory_tracker(),
        &query_logger = interpreter.query_logger_](AnyStream *stream,
                                                   std::optional<int> n) mutable -> std::optional<QueryHandlerResult> {
         // No output symbols are given so that nothing is streamed.
@@ -2804,7 +2877,8 @@ PreparedQuery PrepareProfileQuery(ParsedQuery parsed_query, bool in_explicit_tra
           stats_and_total_time =
               PullPlan(plan, parameters, true, dba, interpreter_context, execution_memory, std::move(user_or_role),
                        transaction_status, std::move(tx_timer), db_acc, query_logger, nullptr, memory_limit,
-                       frame_change_collector->IsTrackingValues() ? frame_change_collector : nullptr, hops_limit)
+                       frame_change_collector->IsTrackingValues() ? frame_change_collector : nullptr, hops_limit,
+                       nullptr, {}, database_memory_tracker)
                   .Pull(stream, {}, {}, summary);
           pull_plan = std::make_shared<PullPlanVector>(ProfilingStatsToTable(*stats_and_total_time));
         }
@@ -4977,6 +5051,53 @@ PreparedQuery PrepareDatabaseInfoQuery(ParsedQuery parsed_query, bool in_explici
       };
       break;
     }
+    case DatabaseInfoQuery::InfoType::PLAN_CACHE: {
+      header = {"query", "parameter types", "cost", "estimated rows", "hits", "replans"};
+      handler = [database] {
+        auto plans = ListCachedPlans(*database->plan_cache());
+        std::vector<std::vector<TypedValue>> results;
+        results.reserve(plans.size());
+        for (const auto &plan : plans) {
+          const auto &key = plan->cache_key();
+          if (!key) continue;
+          auto const estimated_rows = plan->estimated_rows();
+          results.push_back({TypedValue(key->query), TypedValue(key->parameter_types), TypedValue(plan->cost()),
+                             estimated_rows ? TypedValue(*estimated_rows) : TypedValue(),
+                             TypedValue(static_cast<int64_t>(plan->cache_hits())),
+                             TypedValue(static_cast<int64_t>(plan->replans()))});
+        }
+        return std::pair{results, QueryHandlerResult::COMMIT};
+      };
+      break;
+    }
+    case DatabaseInfoQuery::InfoType::QUERY_STATISTICS: {
+      header = {"query", "parameter types", "hits", "samples", "mean time ms", "operators"};
+      handler = [database] {
+        auto plans = ListCachedPlans(*database->plan_cache());
+        std::vector<std::vector<TypedValue>> results;
+        for (const auto &plan : plans) {
+          const auto &key = plan->cache_key();
+          if (!key) continue;
+          const auto profile = plan->profile();
+          if (profile.samples() == 0) continue;
+          const auto samples = static_cast<double>(profile.samples());
+          std::vector<TypedValue> operators;
+          operators.reserve(profile.operators().size());
+          for (const auto &op : profile.operators()) {
+            operators.emplace_back(std::map<std::string, TypedValue>{
+                {"operator", TypedValue(op.name)},
+                {"mean hits", TypedValue(static_cast<double>(op.actual_hits) / samples)},
+                {"mean time ms", TypedValue(op.time_ms / samples)}});
+          }
+          results.push_back({TypedValue(key->query), TypedValue(key->parameter_types),
+                             TypedValue(static_cast<int64_t>(plan->cache_hits())),
+                             TypedValue(static_cast<int64_t>(profile.samples())),
+                             TypedValue(profile.total_time_ms() / samples), TypedValue(std::move(operators))});
+        }
+        return std::pair{results, QueryHandlerResult::COMMIT};
+      };
+      break;
+    }
   }
 
   return PreparedQuery{std::move(header), std::move(parsed_query.required_privileges),
@@ -6141,7 +6262,15 @@ struct QueryTransactionRequirements : QueryVisitor<void> {
   void Visit(AlterEnumUpdateValueQuery &) override { accessor_type_ = storage::Storage::Accessor::Type::UNIQUE; }
   void Visit(TtlQuery &) override { accessor_type_ = storage::Storage::Accessor::Type::UNIQUE; }
   void Visit(RecoverSnapshotQuery &) override { accessor_type_ = storage::Storage::Accessor::Type::UNIQUE; }
-  void Visit(IndexQuery &) override { accessor_type_ = storage::Storage::Accessor::Type::UNIQUE; }
+
+  // In-memory label and label-property indices are built online, writers are only blocked for dropping
+  void Visit(IndexQuery &index_query) override {
+    if (is_in_memory_transactional_ && index_query.action_ == IndexQuery::Action::CREATE) {
+      accessor_type_ = storage::Storage::Accessor::Type::READ;
+    } else {
+      accessor_type_ = storage::Storage::Accessor::Type::UNIQUE;
+    }
+  }
 
   // Read access required
   void Visit(ExplainQuery &) override { accessor_type_ = storage::Storage::Accessor::Type::READ; }
@@ -6296,7 +6425,10 @@ Interpreter::PrepareResult Interpreter::Prepare(ParseRes parse_res, UserParamete
       prepared_query =
           PrepareCypherQuery(std::move(parsed_query), &query_execution->summary, interpreter_context_, current_db_,
                              memory_resource, &query_execution->notifications, user_or_role_, &transaction_status_,
-                             current_timeout_timer_, *this, &*frame_change_collector_);
+                             current_timeout_timer_, *this, &*frame_change_collector_,
+                             interpreter_context_->slow_query_log && interpreter_context_->slow_query_log->IsStarted()
+                                 ? &query_execution->slow_query
+                                 : nullptr);
     } else if (utils::Downcast<ExplainQuery>(parsed_query.query)) {
       prepared_query = PrepareExplainQuery(std::move(parsed_query), &query_execution->summary,
                                            &query_execution->notifications, interpreter_context_, *this, current_db_);
@@ -6893,14 +7025,38 @@ void Interpreter::Commit() {
   // finished, that transaction probably will schedule its after commit triggers, because the other transactions that
   // want to commit are still waiting for commiting or one of them just started commiting its changes. This means the
   // ordered execution of after commit triggers are not guaranteed.
+  //
+  // With trigger_after_commit_batch_size > 1, transactions that commit while the pool is busy are coalesced: every
+  // commit queues its context and schedules a task, and the first task to run takes the whole queue, leaving the
+  // later ones with nothing to do. On-disk storage keeps running the triggers once per transaction.
   if (trigger_context && db->trigger_store()->AfterCommitTriggers().size() > 0) {
-    db->AddTask([db_acc = *current_db_.db_acc_, interpreter_context = interpreter_context_,
-                 trigger_context = std::move(*trigger_context),
-                 user_transaction = std::shared_ptr(std::move(current_db_.db_transactional_accessor_))]() mutable {
-      RunTriggersAfterCommit(db_acc, interpreter_context, std::move(trigger_context));
-      user_transaction->FinalizeTransaction();
-      SPDLOG_DEBUG("Finished executing after commit triggers");  // NOLINT(bugprone-lambda-function-name)
-    });
+    auto user_transaction = std::shared_ptr(std::move(current_db_.db_transactional_accessor_));
+    if (FLAGS_trigger_after_commit_batch_size > 1 &&
+        current_storage_mode != storage::StorageMode::ON_DISK_TRANSACTIONAL) {
+      db->after_commit_trigger_batch()->Push(std::move(*trigger_context), std::move(user_transaction));
+      db->AddTask([db_acc = *current_db_.db_acc_, interpreter_context = interpreter_context_]() mutable {
+        auto batch = db_acc->after_commit_trigger_batch()->Pop(FLAGS_trigger_after_commit_batch_size);
+        if (batch.empty()) return;
+        TriggerContext batch_context;
+        for (auto &entry : batch) {
+          batch_context.Merge(std::move(entry.context));
+        }
+        RunTriggersAfterCommit(db_acc, interpreter_context, std::move(batch_context));
+        for (auto &entry : batch) {
+          entry.transaction->FinalizeTransaction();
+        }
+        // NOLINTNEXTLINE(bugprone-lambda-function-name)
+        SPDLOG_DEBUG("Finished executing after commit triggers for {} transactions", batch.size());
+      });
+    } else {
+      db->AddTask([db_acc = *current_db_.db_acc_, interpreter_context = interpreter_context_,
+                   trigger_context = std::move(*trigger_context),
+                   user_transaction = std::move(user_transaction)]() mutable {
+        RunTriggersAfterCommit(db_acc, interpreter_context, std::move(trigger_context));
+        user_transaction->FinalizeTransaction();
+        SPDLOG_DEBUG("Finished executing after commit triggers");  // NOLINT(bugprone-lambda-function-name)
+      });
+    }
   }
 
   SPDLOG_DEBUG("Finished committing the transaction");
@@ -6929,6 +7085,31 @@ void Interpreter::AbortCommand(std::unique_ptr<QueryExecution> *query_execution)
   }
 }
 
+void Interpreter::RecordSlowQuery(SlowQueryLog::Entry entry, const std::map<std::string, TypedValue> &summary) {
+  const auto summary_time = [&summary](const std::string &key) {
+    auto it = summary.find(key);
+    return it != summary.end() && it->second.IsDouble() ? it->second.ValueDouble() : 0.0;
+  };
+  entry.parsing_time = summary_time("parsing_time");
+  entry.planning_time = summary_time("planning_time");
+  interpreter_context_->slow_query_log->Record(std::move(entry));
+}
+
+// Only queries that executed a plan have an execution time
+void Interpreter::RecordQueryLatency(const std::map<std::string, TypedValue> &summary) {
+  const auto execution_time = summary.find("plan_execution_time");
+  const auto db = summary.find("db");
+  const auto type = summary.find("type");
+  if (execution_time == summary.end() || !execution_time->second.IsDouble() || db == summary.end() ||
+      !db->second.IsString() || type == summary.end() || !type->second.IsString()) {
+    return;
+  }
+  const auto latency = std::chrono::duration<double>(execution_time->second.ValueDouble());
+  memgraph::metrics::MeasureLabeled(memgraph::metrics::QueryLatency_us,
+                                    {db->second.ValueString(), type->second.ValueString()},
+                                    std::chrono::duration_cast<std::chrono::microseconds>(latency).count());
+}
+
 std::optional<storage::IsolationLevel> Interpreter::GetIsolationLevelOverride() {
   if (next_transaction_isolation_level) {
     const auto isolation_level = *next_transaction_isolation_level;
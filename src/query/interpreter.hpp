@@ -17,6 +17,7 @@
 #include "query/context.hpp"
 #include "query/db_accessor.hpp"
 #include "query/query_logger.hpp"
+#include "query/slow_query_log.hpp"
 #include "query/stream.hpp"
 #include "system/transaction.hpp"
 #include "utils/event_counter.hpp"
@@ -25,6 +26,7 @@
 #include "utils/priorities.hpp"
 #include "utils/spin_lock.hpp"
 #include "utils/synchronized.hpp"
+#include "utils/timer.hpp"
 
 #ifdef MG_ENTERPRISE
 #include "coordination/instance_status.hpp"
@@ -429,6 +431,8 @@ class Interpreter final {
     std::optional<PreparedQuery> prepared_query;
     std::map<std::string, TypedValue> summary;
     std::vector<Notification> notifications;
+    // Only set for Cypher queries while the slow query log is started
+    std::optional<SlowQueryLog::Entry> slow_query;
 
     static auto Create() -> std::unique_ptr<QueryExecution> { return std::make_unique<QueryExecution>(); }
 
@@ -444,6 +448,7 @@ class Interpreter final {
     void CleanRuntimeData() {
       prepared_query.reset();
       notifications.clear();
+      slow_query.reset();
     }
   };
 
@@ -476,6 +481,8 @@ class Interpreter final {
   void Commit();
   void AdvanceCommand();
   void AbortCommand(std::unique_ptr<QueryExecution> *query_execution);
+  void RecordSlowQuery(SlowQueryLog::Entry entry, const std::map<std::string, TypedValue> &summary);
+  static void RecordQueryLatency(const std::map<std::string, TypedValue> &summary);
   std::optional<storage::IsolationLevel> GetIsolationLevelOverride();
 
   size_t ActiveQueryExecutions() {
@@ -526,6 +533,8 @@ std::map<std::string, TypedValue> Interpreter::Pull(TStream *result_stream, std:
     if (maybe_res) {
       // Save its summary
       maybe_summary.emplace(std::move(query_execution->summary));
+      // Save the slow query entry, it is recorded once the commit time is known
+      auto slow_query = std::move(query_execution->slow_query);
       if (!query_execution->notifications.empty()) {
         std::vector<TypedValue> notifications;
         notifications.reserve(query_execution->notifications.size());
@@ -536,9 +545,12 @@ std::map<std::string, TypedValue> Interpreter::Pull(TStream *result_stream, std:
       }
       if (!in_explicit_transaction_) {
         switch (*maybe_res) {
-          case QueryHandlerResult::COMMIT:
+          case QueryHandlerResult::COMMIT: {
+            const utils::Timer commit_timer;
             Commit();
+            if (slow_query) slow_query->commit_time = commit_timer.Elapsed().count();
             break;
+          }
           case QueryHandlerResult::ABORT:
             Abort();
             break;
@@ -560,6 +572,8 @@ std::map<std::string, TypedValue> Interpreter::Pull(TStream *result_stream, std:
         // in the transaction can be in unfinished state
         query_execution.reset(nullptr);
       }
+      if (slow_query) RecordSlowQuery(std::move(*slow_query), *maybe_summary);
+      RecordQueryLatency(*maybe_summary);
     }
   } catch (const ExplicitTransactionUsageException &e) {
     LogQueryMessage(e.what());
@@ -49,6 +49,7 @@ constexpr uint64_t kInterpreterTransactionInitialId = 1ULL << 63U;
 class AuthQueryHandler;
 class AuthChecker;
 class Interpreter;
+class SlowQueryLog;
 struct QueryUserOrRole;
 
 /**
@@ -74,6 +75,8 @@ struct InterpreterContext {
   AuthChecker *auth_checker;
   ReplicationQueryHandler *replication_handler_;
   system::System *system_;
+  // Set by the application when it starts the slow query log
+  SlowQueryLog *slow_query_log{nullptr};
 
   // Used to check active transactions
   // TODO: Have a way to read the current database
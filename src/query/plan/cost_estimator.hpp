@@ -48,6 +48,8 @@ struct CostEstimation {
 struct PlanCost {
   double cost;
   bool use_index_hints;
+  // expected number of rows, see CostEstimation
+  double cardinality{1};
 };
 
 /**
@@ -605,7 +607,8 @@ PlanCost EstimatePlanCost(TDbAccessor *db, const SymbolTable &table, const Param
                           LogicalOperator &plan, const IndexHints &index_hints) {
   CostEstimator<TDbAccessor> estimator(db, table, parameters, index_hints);
   plan.Accept(estimator);
-  return PlanCost{.cost = estimator.cost(), .use_index_hints = estimator.use_index_hints()};
+  return PlanCost{
+      .cost = estimator.cost(), .use_index_hints = estimator.use_index_hints(), .cardinality = estimator.cardinality()};
 }
 
 }  // namespace memgraph::query::plan
@@ -38,6 +38,7 @@
 #include "query/frontend/ast/ast.hpp"
 #include "query/frontend/semantic/symbol_table.hpp"
 #include "query/graph.hpp"
+#include "query/interpret/compiled_predicate.hpp"
 #include "query/interpret/eval.hpp"
 #include "query/path.hpp"
 #include "query/plan/scoped_profile.hpp"
@@ -169,6 +170,32 @@ auto ExpressionRange::Equal(Expression *value) -> ExpressionRange {
 
 auto ExpressionRange::RegexMatch() -> ExpressionRange { return {Type::REGEX_MATCH, std::nullopt, std::nullopt}; }
 
+auto ExpressionRange::StartsWith(Expression *prefix) -> ExpressionRange {
+  return {Type::STARTS_WITH, utils::MakeBoundInclusive(prefix), std::nullopt};
+}
+
+namespace {
+/// Range of the strings starting with `prefix`: [prefix, prefix with its last byte incremented). A prefix which
+/// isn't a string can't match anything, but the filter which is kept after the scan decides that (and reports the
+/// error if there is one), so all strings are scanned then.
+storage::PropertyValueRange StringPrefixRange(storage::PropertyValue const &prefix) {
+  if (!prefix.IsString()) {
+    return storage::PropertyValueRange::Bounded(utils::MakeBoundInclusive(storage::PropertyValue("")),
+                                                storage::UpperBoundForType(storage::PropertyValueType::String));
+  }
+  auto const &prefix_str = prefix.ValueString();
+  auto successor = prefix_str;
+  while (!successor.empty() && static_cast<unsigned char>(successor.back()) == 0xFF) successor.pop_back();
+  if (successor.empty()) {
+    return storage::PropertyValueRange::Bounded(utils::MakeBoundInclusive(prefix),
+                                                storage::UpperBoundForType(storage::PropertyValueType::String));
+  }
+  successor.back() = static_cast<char>(static_cast<unsigned char>(successor.back()) + 1);
+  return storage::PropertyValueRange::Bounded(utils::MakeBoundInclusive(prefix),
+                                              utils::MakeBoundExclusive(storage::PropertyValue(std::move(successor))));
+}
+}  // namespace
+
 auto ExpressionRange::Range(std::optional<utils::Bound<Expression *>> lower,
                             std::optional<utils::Bound<Expression *>> upper) -> ExpressionRange {
   return {Type::RANGE, std::move(lower), std::move(upper)};
@@ -206,6 +233,12 @@ auto ExpressionRange::Evaluate(ExpressionEvaluator &evaluator) const -> storage:
       return storage::PropertyValueRange::Bounded(std::move(empty_string), std::move(upper_bound));
     }
 
+    case Type::STARTS_WITH: {
+      auto const prefix = lower_->value()->Accept(evaluator);
+      if (!prefix.IsString()) return StringPrefixRange(storage::PropertyValue());
+      return StringPrefixRange(storage::PropertyValue(std::string_view{prefix.ValueString()}));
+    }
+
     case Type::RANGE: {
       auto lower_bound = to_bounded_property_value(lower_);
       auto upper_bound = to_bounded_property_value(upper_);
@@ -271,6 +304,12 @@ auto ExpressionRange::ResolveAtPlantime(Parameters const &params, storage::NameI
       return storage::PropertyValueRange::Bounded(std::move(empty_string), std::move(upper_bound));
     }
 
+    case Type::STARTS_WITH: {
+      auto prefix = ConstExternalPropertyValue(lower_->value(), params);
+      if (!prefix) return std::nullopt;
+      return StringPrefixRange(storage::ToPropertyValue(*prefix, name_id_mapper));
+    }
+
     case Type::RANGE: {
       auto maybe_lower_bound = to_bounded_property_value(lower_);
       if (std::holds_alternative<UnknownAtPlanTime>(maybe_lower_bound)) return std::nullopt;
@@ -1646,6 +1685,12 @@ void Expand::ExpandCursor::Reset() {
   in_edges_it_ = std::nullopt;
   out_edges_ = std::nullopt;
   out_edges_it_ = std::nullopt;
+  neighbour_index_ = std::nullopt;
+  prev_bound_nodes_ = std::nullopt;
+  anchor_ = std::nullopt;
+  anchor_reuses_ = 0;
+  anchor_scan_cost_ = 0;
+  anchor_degree_ = std::nullopt;
 }
 
 ExpansionInfo Expand::ExpandCursor::GetExpansionInfo(Frame &frame) {
@@ -1712,6 +1757,10 @@ bool Expand::ExpandCursor::InitEdges(Frame &frame, ExecutionContext &context) {
       continue;
     }
 
+    if (expansion_info_.existing_node && InitEdgesFromNeighbourIndex(context)) {
+      return true;
+    }
+
     auto vertex = *expansion_info_.input_node;
     auto direction = expansion_info_.direction;
 
@@ -1775,11 +1824,145 @@ bool Expand::ExpandCursor::InitEdges(Frame &frame, ExecutionContext &context) {
     } else {
       prev_existing_degree_ = total_expanded_edges;
     }
+    if (anchor_) anchor_scan_cost_ += total_expanded_edges;
 
     return true;
   }
 }
 
+namespace {
+// A node has to stay bound for this many rows before it's considered for indexing
+constexpr int64_t kMinAnchorReuses = 4;
+// ... and be a hub, with a degree this many times the edges scanned per row without the index
+constexpr int64_t kHubDegreeRatio = 8;
+
+EdgeAtom::Direction FlipDirection(EdgeAtom::Direction direction) {
+  switch (direction) {
+    case EdgeAtom::Direction::IN:
+      return EdgeAtom::Direction::OUT;
+    case EdgeAtom::Direction::OUT:
+      return EdgeAtom::Direction::IN;
+    default:
+      return EdgeAtom::Direction::BOTH;
+  }
+}
+}  // namespace
+
+void Expand::ExpandCursor::TrackAnchor(const VertexAccessor &vertex, const VertexAccessor &existing_vertex) {
+  if (anchor_ && (*anchor_ == vertex || *anchor_ == existing_vertex)) {
+    ++anchor_reuses_;
+  } else {
+    auto was_bound = [&](const VertexAccessor &node) {
+      return prev_bound_nodes_ && (prev_bound_nodes_->first == node || prev_bound_nodes_->second == node);
+    };
+    anchor_ = std::nullopt;
+    if (was_bound(existing_vertex)) {
+      anchor_ = existing_vertex;
+    } else if (was_bound(vertex)) {
+      anchor_ = vertex;
+    }
+    anchor_reuses_ = anchor_ ? 1 : 0;
+    anchor_scan_cost_ = 0;
+    anchor_degree_ = std::nullopt;
+  }
+  prev_bound_nodes_.emplace(vertex, existing_vertex);
+}
+
+bool Expand::ExpandCursor::ShouldIndexAnchor(EdgeAtom::Direction anchor_direction, ExecutionContext &context) {
+  if (anchor_reuses_ < kMinAnchorReuses) return false;
+
+  if (!anchor_degree_ || anchor_degree_->first != anchor_direction) {
+    int64_t degree = 0;
+    if (anchor_direction == EdgeAtom::Direction::IN || anchor_direction == EdgeAtom::Direction::BOTH) {
+      auto in_degree = anchor_->InDegree(self_.view_);
+      if (in_degree.HasError()) return false;
+      degree += static_cast<int64_t>(*in_degree);
+    }
+    if (anchor_direction == EdgeAtom::Direction::OUT || anchor_direction == EdgeAtom::Direction::BOTH) {
+      auto out_degree = anchor_->OutDegree(self_.view_);
+      if (out_degree.HasError()) return false;
+      degree += static_cast<int64_t>(*out_degree);
+    }
+    anchor_degree_.emplace(anchor_direction, degree);
+  }
+  const auto degree = anchor_degree_->second;
+
+  // Building the index scans the anchor's edges once. It's worth it only if the
+  // rows so far scanned as much, and if the anchor is a hub compared to the
+  // nodes it is paired with, whose smaller adjacency lists are scanned otherwise.
+  if (anchor_scan_cost_ < degree) return false;
+  if (degree < kHubDegreeRatio * (anchor_scan_cost_ / anchor_reuses_)) return false;
+  // The index is built without counting hops, so it mustn't do more than the limit allows
+  if (context.hops_limit.IsUsed() && degree > context.hops_limit.LeftHops()) return false;
+  return true;
+}
+
+bool Expand::ExpandCursor::InitEdgesFromNeighbourIndex(ExecutionContext &context) {
+  // With the new view, MERGE could create edges between the rows which
+  // wouldn't be in the index.
+  if (self_.view_ != storage::View::OLD) return false;
+
+  const auto &vertex = *expansion_info_.input_node;
+  const auto &existing_vertex = *expansion_info_.existing_node;
+  TrackAnchor(vertex, existing_vertex);
+  if (!anchor_) return false;
+
+  // Edges going into `vertex` from `existing_vertex` are, from the existing
+  // vertex's side, its outgoing edges and vice versa.
+  const bool anchor_is_existing = *anchor_ == existing_vertex;
+  const auto &other = anchor_is_existing ? vertex : existing_vertex;
+  const auto direction = expansion_info_.direction;
+  const auto anchor_direction = anchor_is_existing ? FlipDirection(direction) : direction;
+
+  const auto transaction_id = context.db_accessor->GetTransactionId();
+  if (!neighbour_index_ || neighbour_index_->vertex != *anchor_ || neighbour_index_->transaction_id != transaction_id) {
+    neighbour_index_ = std::nullopt;
+    if (!ShouldIndexAnchor(anchor_direction, context)) return false;
+    neighbour_index_.emplace(
+        NeighbourIndex{.vertex = *anchor_, .transaction_id = transaction_id, .in_edges = {}, .out_edges = {}});
+  }
+
+  // Hops are counted for the edges found, the scan building the index isn't counted.
+  const bool needs_in = anchor_direction == EdgeAtom::Direction::IN || anchor_direction == EdgeAtom::Direction::BOTH;
+  const bool needs_out = anchor_direction == EdgeAtom::Direction::OUT || anchor_direction == EdgeAtom::Direction::BOTH;
+  if (needs_in && !neighbour_index_->in_edges) {
+    auto &in_edges = neighbour_index_->in_edges.emplace();
+    auto in_result = UnwrapEdgesResult(anchor_->InEdges(self_.view_, self_.common_.edge_types));
+    for (auto &edge : in_result.edges) in_edges[edge.From().Gid()].emplace_back(std::move(edge));
+  }
+  if (needs_out && !neighbour_index_->out_edges) {
+    auto &out_edges = neighbour_index_->out_edges.emplace();
+    auto out_result = UnwrapEdgesResult(anchor_->OutEdges(self_.view_, self_.common_.edge_types));
+    for (auto &edge : out_result.edges) out_edges[edge.To().Gid()].emplace_back(std::move(edge));
+  }
+
+  auto lookup = [&](const auto &edges_by_neighbour) {
+    auto found = edges_by_neighbour->find(other.Gid());
+    if (found == edges_by_neighbour->end()) return std::vector<EdgeAccessor>{};
+    const auto &edges = found->second;
+    auto count = static_cast<int64_t>(edges.size());
+    if (context.hops_limit.IsUsed()) {
+      if (context.hops_limit.LeftHops() == 0) {
+        context.hops_limit.limit_reached = true;
+        return std::vector<EdgeAccessor>{};
+      }
+      count = std::min(count, context.hops_limit.LeftHops());
+      context.hops_limit.IncrementHopsCount(count);
+    }
+    context.number_of_hops += count;
+    return std::vector<EdgeAccessor>(edges.begin(), edges.begin() + count);
+  };
+  if (direction == EdgeAtom::Direction::IN || direction == EdgeAtom::Direction::BOTH) {
+    in_edges_.emplace(lookup(anchor_is_existing ? neighbour_index_->out_edges : neighbour_index_->in_edges));
+    in_edges_it_.emplace(in_edges_->begin());
+  }
+  if (direction == EdgeAtom::Direction::OUT || direction == EdgeAtom::Direction::BOTH) {
+    out_edges_.emplace(lookup(anchor_is_existing ? neighbour_index_->in_edges : neighbour_index_->out_edges));
+    out_edges_it_.emplace(out_edges_->begin());
+  }
+  return true;
+}
+
 ExpandVariable::ExpandVariable(const std::shared_ptr<LogicalOperator> &input, Symbol input_symbol, Symbol node_symbol,
                                Symbol edge_symbol, EdgeAtom::Type type, EdgeAtom::Direction direction,
                                const std::vector<storage::EdgeTypeId> &edge_types, bool is_reverse,
@@ -3470,6 +3653,15 @@ UniqueCursorPtr Filter::MakeCursor(utils::MemoryResource *mem) const {
   return MakeUniqueCursorPtr<FilterCursor>(mem, *this, mem);
 }
 
+const CompiledPredicate *Filter::GetCompiledExpression() const {
+  std::call_once(compile_expression_once_, [this] {
+    if (auto compiled = CompiledPredicate::Compile(expression_)) {
+      compiled_expression_ = std::make_shared<const CompiledPredicate>(*std::move(compiled));
+    }
+  });
+  return compiled_expression_.get();
+}
+
 std::vector<Symbol> Filter::ModifiedSymbols(const SymbolTable &table) const { return input_->ModifiedSymbols(table); }
 
 std::unique_ptr<LogicalOperator> Filter::Clone(AstStorage *storage) const {
@@ -3576,7 +3768,9 @@ static std::vector<UniqueCursorPtr> MakeCursorVector(const std::vector<std::shar
 Filter::FilterCursor::FilterCursor(const Filter &self, utils::MemoryResource *mem)
     : self_(self),
       input_cursor_(self_.input_->MakeCursor(mem)),
-      pattern_filter_cursors_(MakeCursorVector(self_.pattern_filters_, mem)) {}
+      pattern_filter_cursors_(MakeCursorVector(self_.pattern_filters_, mem)),
+      compiled_expression_(self_.GetCompiledExpression()),
+      constants_(compiled_expression_ ? compiled_expression_->ConstantsCount() : 0) {}
 
 bool Filter::FilterCursor::Pull(Frame &frame, ExecutionContext &context) {
   OOMExceptionEnabler oom_exception;
@@ -3592,7 +3786,10 @@ bool Filter::FilterCursor::Pull(Frame &frame, ExecutionContext &context) {
     for (const auto &pattern_filter_cursor : pattern_filter_cursors_) {
       pattern_filter_cursor->Pull(frame, context);
     }
-    if (EvaluateFilter(evaluator, self_.expression_)) return true;
+    if (compiled_expression_ ? compiled_expression_->Evaluate(evaluator, constants_)
+                             : EvaluateFilter(evaluator, self_.expression_)) {
+      return true;
+    }
   }
   return false;
 }
@@ -6245,6 +6442,9 @@ class CallProcedureCursor : public Cursor {
   UniqueCursorPtr input_cursor_;
   mgp_result result_;
   decltype(result_.rows.end()) result_row_it_{result_.rows.end()};
+  // Position in `result_.batches`, which are pulled once all `result_.rows` are
+  size_t result_batch_idx_{0};
+  size_t result_batch_row_{0};
   // Holds the lock on the module so it doesn't get reloaded
   std::shared_ptr<procedure::Module> module_;
   mgp_proc const *proc_{nullptr};
@@ -6300,18 +6500,12 @@ class CallProcedureCursor : public Cursor {
 
     AbortCheck(context);
 
-    auto skip_rows_with_deleted_values = [this]() {
-      while (result_row_it_ != result_.rows.end() && result_row_it_->has_deleted_values) {
-        ++result_row_it_;
-      }
-    };
-
     // We need to fetch new procedure results after pulling from input.
     // TODO: Look into openCypher's distinction between procedures returning an
     // empty result set vs procedures which return `void`. We currently don't
     // have procedures registering what they return.
     // This `while` loop will skip over empty results.
-    while (result_row_it_ == result_.rows.end()) {
+    while (!SkipToNextResultRow()) {
       if (!proc_->info.is_batched) {
         stream_exhausted = true;
       }
@@ -6333,6 +6527,7 @@ class CallProcedureCursor : public Cursor {
         cleanup_.emplace(*proc_->cleanup);
       }
       result_.rows.clear();
+      result_.batches.clear();
 
       const auto graph_view = proc_->info.is_write ? storage::View::NEW : storage::View::OLD;
       ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
@@ -6353,30 +6548,40 @@ class CallProcedureCursor : public Cursor {
         throw QueryRuntimeException("{}: {}", self_->procedure_name_, *result_.error_msg);
       }
       result_row_it_ = result_.rows.begin();
-      if (!result_.is_transactional) {
-        skip_rows_with_deleted_values();
-      }
+      result_batch_idx_ = 0;
+      result_batch_row_ = 0;
 
-      stream_exhausted = result_row_it_ == result_.rows.end();
+      stream_exhausted = !SkipToNextResultRow();
     }
 
-    // Instead of checking if procedure yielded all required values
-    // it is filled with null values on construction. This came as a
-    // direct consequence of changing from mgp_result rows from map to vector
-    // PRO: this is a lot faster
-    // CON: doesn't throw anymore if not all values are present
-    // Values are ordered the same as result_fields
-    auto &values = result_row_it_->values;
-    for (int i = 0; i < self_->result_fields_.size(); ++i) {
-      frame[self_->result_symbols_[i]] = std::move(values[i]);
+    auto set_result = [&](size_t i, TypedValue &&value) {
+      frame[self_->result_symbols_[i]] = std::move(value);
       if (context.frame_change_collector &&
           context.frame_change_collector->IsKeyTracked(self_->result_symbols_[i].name())) {
         context.frame_change_collector->ResetTrackingValue(self_->result_symbols_[i].name());
       }
-    }
-    ++result_row_it_;
-    if (!result_.is_transactional) {
-      skip_rows_with_deleted_values();
+    };
+    if (result_row_it_ != result_.rows.end()) {
+      // Instead of checking if procedure yielded all required values
+      // it is filled with null values on construction. This came as a
+      // direct consequence of changing from mgp_result rows from map to vector
+      // PRO: this is a lot faster
+      // CON: doesn't throw anymore if not all values are present
+      // Values are ordered the same as result_fields
+      auto &values = result_row_it_->values;
+      for (size_t i = 0; i < self_->result_fields_.size(); ++i) {
+        set_result(i, std::move(values[i]));
+      }
+      ++result_row_it_;
+    } else {
+      // Columns which were never set are empty and yield null
+      auto &batch = result_.batches[result_batch_idx_];
+      for (size_t i = 0; i < self_->result_fields_.size(); ++i) {
+        auto &column = batch.columns[i];
+        set_result(i, column.empty() ? TypedValue(context.evaluation_context.memory)
+                                     : std::move(column[result_batch_row_]));
+      }
+      ++result_batch_row_;
     }
 
     return true;
@@ -6384,7 +6589,10 @@ class CallProcedureCursor : public Cursor {
 
   void Reset() override {
     result_.rows.clear();
+    result_.batches.clear();
     result_row_it_ = result_.rows.begin();
+    result_batch_idx_ = 0;
+    result_batch_row_ = 0;
     if (cleanup_) {
       cleanup_.value()();
     }
@@ -6395,6 +6603,26 @@ class CallProcedureCursor : public Cursor {
       cleanup_.value()();
     }
   }
+
+ private:
+  // Advances past the rows containing deleted values and returns whether a row of the last procedure call is yet to
+  // be pulled, either from `result_.rows` or from `result_.batches`.
+  bool SkipToNextResultRow() {
+    while (result_row_it_ != result_.rows.end() && result_row_it_->has_deleted_values) {
+      ++result_row_it_;
+    }
+    if (result_row_it_ != result_.rows.end()) return true;
+    for (; result_batch_idx_ < result_.batches.size(); ++result_batch_idx_, result_batch_row_ = 0) {
+      const auto &batch = result_.batches[result_batch_idx_];
+      if (!batch.has_deleted_values.empty()) {
+        while (result_batch_row_ < batch.size && batch.has_deleted_values[result_batch_row_]) {
+          ++result_batch_row_;
+        }
+      }
+      if (result_batch_row_ < batch.size) return true;
+    }
+    return false;
+  }
 };
 
 class CallValidateProcedureCursor : public Cursor {
@@ -12,6 +12,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <unordered_map>
 #include <utility>
@@ -35,6 +36,7 @@
 namespace memgraph::query {
 
 struct ExecutionContext;
+class CompiledPredicate;
 class ExpressionEvaluator;
 class Frame;
 class SymbolTable;
@@ -50,6 +52,7 @@ struct ExpressionRange {
 
   static auto Equal(Expression *value) -> ExpressionRange;
   static auto RegexMatch() -> ExpressionRange;
+  static auto StartsWith(Expression *prefix) -> ExpressionRange;
   static auto Range(std::optional<utils::Bound<Expression *>> lower, std::optional<utils::Bound<Expression *>> upper)
       -> ExpressionRange;
   static auto In(Expression *value) -> ExpressionRange;
@@ -983,7 +986,33 @@ class Expand : public memgraph::query::plan::LogicalOperator {
     int64_t prev_input_degree_{-1};
     int64_t prev_existing_degree_{-1};
 
+    // Edges of a single vertex grouped by the vertex on their other end. When
+    // both nodes are bound and one of them, the anchor, is a hub which stays
+    // the same over many consecutive input rows, as for the edge closing a
+    // cycle, the edges between them are looked up here instead of scanning an
+    // adjacency list for each row. Only the directions needed are built.
+    struct NeighbourIndex {
+      VertexAccessor vertex;
+      std::optional<uint64_t> transaction_id;
+      // Keyed by the edge's From()
+      std::optional<std::unordered_map<storage::Gid, std::vector<EdgeAccessor>>> in_edges;
+      // Keyed by the edge's To()
+      std::optional<std::unordered_map<storage::Gid, std::vector<EdgeAccessor>>> out_edges;
+    };
+    std::optional<NeighbourIndex> neighbour_index_;
+    std::optional<std::pair<VertexAccessor, VertexAccessor>> prev_bound_nodes_;
+    // The node bound on consecutive rows, with the number of rows it stayed
+    // bound for and the edges scanned for those rows without the index
+    std::optional<VertexAccessor> anchor_;
+    int64_t anchor_reuses_{0};
+    int64_t anchor_scan_cost_{0};
+    // Degree of the anchor in the given direction, the cost of indexing it
+    std::optional<std::pair<EdgeAtom::Direction, int64_t>> anchor_degree_;
+
     bool InitEdges(Frame &, ExecutionContext &);
+    bool InitEdgesFromNeighbourIndex(ExecutionContext &);
+    void TrackAnchor(const VertexAccessor &vertex, const VertexAccessor &existing_vertex);
+    bool ShouldIndexAnchor(EdgeAtom::Direction anchor_direction, ExecutionContext &);
   };
 
   std::shared_ptr<memgraph::query::plan::LogicalOperator> input_;
@@ -1169,6 +1198,13 @@ class Filter : public memgraph::query::plan::LogicalOperator {
   std::unique_ptr<LogicalOperator> Clone(AstStorage *storage) const override;
 
  private:
+  /// Returns `expression_` compiled on the first call, after the rewrites are done with it. The compiled expression
+  /// is shared by all the executions of the (cached) plan. Returns nullptr if the expression can't be compiled.
+  const CompiledPredicate *GetCompiledExpression() const;
+
+  mutable std::once_flag compile_expression_once_;
+  mutable std::shared_ptr<const CompiledPredicate> compiled_expression_;
+
   class FilterCursor : public Cursor {
    public:
     FilterCursor(const Filter &, utils::MemoryResource *);
@@ -1180,6 +1216,9 @@ class Filter : public memgraph::query::plan::LogicalOperator {
     const Filter &self_;
     const UniqueCursorPtr input_cursor_;
     const std::vector<UniqueCursorPtr> pattern_filter_cursors_;
+    const CompiledPredicate *compiled_expression_;
+    // Constants of the compiled expression for this execution
+    std::vector<std::optional<TypedValue>> constants_;
   };
 };
 
@@ -663,6 +663,20 @@ void Filters::AnalyzeAndStoreFilter(Expression *expr, const SymbolTable &symbol_
     all_filters_.emplace_back(filter);
     return;
   };
+  // Checks if maybe_starts_with is a STARTS WITH on a property lookup, stores
+  // it as a prefix match PropertyFilter and returns true. Otherwise returns false.
+  auto add_prop_starts_with = [&](auto *maybe_starts_with) -> bool {
+    auto *function = utils::Downcast<Function>(maybe_starts_with);
+    if (!function || function->function_name_ != kStartsWith || function->arguments_.size() != 2U) return false;
+    PropertyLookup *prop_lookup = nullptr;
+    Identifier *ident = nullptr;
+    if (!get_property_lookup(function->arguments_[0], prop_lookup, ident)) return false;
+    auto filter = make_filter(FilterInfo::Type::Property);
+    filter.property_filter = PropertyFilter(symbol_table, symbol_table.at(*ident), prop_lookup->property_,
+                                            function->arguments_[1], PropertyFilter::Type::STARTS_WITH);
+    all_filters_.emplace_back(filter);
+    return true;
+  };
   // Check if maybe_id_fun is ID invocation on an indentifier and add it as
   // IdFilter.
   auto add_id_equal = [&](auto *maybe_id_fun, auto *val_expr) -> bool {
@@ -866,8 +880,8 @@ void Filters::AnalyzeAndStoreFilter(Expression *expr, const SymbolTable &symbol_
   } else if (auto *exists = utils::Downcast<Exists>(expr)) {
     all_filters_.emplace_back(make_filter(FilterInfo::Type::Pattern));
   } else if (auto *function = utils::Downcast<Function>(expr)) {
-    // WHERE point.withinbbox()
-    if (!add_point_withinbbox_filter_unary(expr, WithinBBoxCondition::INSIDE)) {
+    // WHERE point.withinbbox() or WHERE n.prop STARTS WITH prefix
+    if (!add_point_withinbbox_filter_unary(expr, WithinBBoxCondition::INSIDE) && !add_prop_starts_with(function)) {
       all_filters_.emplace_back(make_filter(FilterInfo::Type::Generic));
     }
   } else if (auto *or_operator = utils::Downcast<OrOperator>(expr)) {
@@ -390,10 +390,11 @@ class PropertyFilter {
   using Bound = utils::Bound<Expression *>;
 
   /// Depending on type, this PropertyFilter may be a value equality, regex
-  /// matched value or a range with lower and (or) upper bounds, IN list filter.
-  enum class Type : uint8_t { EQUAL = 0, REGEX_MATCH = 1, RANGE = 2, IN = 3, IS_NOT_NULL = 4 };
+  /// matched value or a range with lower and (or) upper bounds, IN list filter,
+  /// or a string prefix (STARTS WITH) match.
+  enum class Type : uint8_t { EQUAL = 0, REGEX_MATCH = 1, RANGE = 2, IN = 3, IS_NOT_NULL = 4, STARTS_WITH = 5 };
 
-  /// Construct with Expression being the equality or regex match check.
+  /// Construct with Expression being the equality, regex match or prefix check.
   PropertyFilter(const SymbolTable &, const Symbol &, PropertyIx, Expression *, Type);
   /// Construct the range based filter.
   PropertyFilter(const SymbolTable &, const Symbol &, PropertyIx, const std::optional<Bound> &,
@@ -404,6 +405,10 @@ class PropertyFilter {
   /// values that should be filtered further.
   PropertyFilter(Symbol, PropertyIx, Type);
 
+  /// True if scanning an index by this filter only narrows down the candidates,
+  /// so the original filter expression still has to be checked on them.
+  bool IsCheckedAfterIndexScan() const { return type_ == Type::REGEX_MATCH || type_ == Type::STARTS_WITH; }
+
   /// Symbol whose property is looked up.
   Symbol symbol_;
   PropertyIx property_;
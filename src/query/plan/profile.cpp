@@ -13,13 +13,20 @@
 
 #include <algorithm>
 #include <chrono>
+#include <string_view>
 
 #include <fmt/format.h>
 #include <nlohmann/json.hpp>
 
 #include "query/context.hpp"
+#include "utils/event_labeled_histogram.hpp"
 #include "utils/likely.hpp"
 
+namespace memgraph::metrics {
+extern const Event OperatorTime_us;
+extern const Event OperatorRows;
+}  // namespace memgraph::metrics
+
 namespace memgraph::query::plan {
 
 namespace {
@@ -163,4 +170,54 @@ nlohmann::json ProfilingStatsToJson(const ProfilingStatsWithTotalTime &stats) {
   return helper.ToJson();
 }
 
+namespace {
+
+void MeasureOperatorMetrics(const ProfilingStats &stats, unsigned long long total_cycles,
+                            std::chrono::duration<double> total_time, std::string_view database) {
+  // The name describes the operator's symbols after its type, e.g. "ScanAllByLabel (n :Person)"
+  const auto op = std::string_view{stats.name}.substr(0, stats.name.find(' '));
+  if (total_cycles != 0) {
+    const auto time_ms = AbsoluteTime(IndividualCycles(stats), total_cycles, total_time);
+    metrics::MeasureLabeled(metrics::OperatorTime_us, {database, op}, static_cast<uint64_t>(time_ms * 1000));
+  }
+  metrics::MeasureLabeled(metrics::OperatorRows, {database, op}, stats.actual_hits);
+
+  for (const auto &child : stats.children) {
+    MeasureOperatorMetrics(child, total_cycles, total_time, database);
+  }
+}
+
+}  // namespace
+
+void MeasureOperatorMetrics(const ProfilingStatsWithTotalTime &stats, std::string_view database) {
+  MeasureOperatorMetrics(stats.cumulative_stats, stats.cumulative_stats.num_cycles, stats.total_time, database);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// AggregatedProfilingStats
+
+void AggregatedProfilingStats::Add(const ProfilingStatsWithTotalTime &stats) {
+  ++samples_;
+  total_time_ms_ += std::chrono::duration<double, std::milli>(stats.total_time).count();
+  Add(stats.cumulative_stats, stats.cumulative_stats.num_cycles, stats.total_time);
+}
+
+void AggregatedProfilingStats::Add(const ProfilingStats &stats, unsigned long long total_cycles,
+                                   std::chrono::duration<double> total_time) {
+  auto it =
+      std::find_if(operators_.begin(), operators_.end(), [&stats](const auto &op) { return op.key == stats.key; });
+  if (it == operators_.end()) {
+    it = operators_.insert(operators_.end(), OperatorStats{.key = stats.key, .name = stats.name});
+  }
+  it->actual_hits += stats.actual_hits;
+  if (total_cycles != 0) {
+    it->time_ms += AbsoluteTime(IndividualCycles(stats), total_cycles, total_time);
+  }
+
+  for (const auto &child : stats.children) {
+    Add(child, total_cycles, total_time);
+  }
+}
+
 }  // namespace memgraph::query::plan
@@ -13,6 +13,8 @@
 
 #include <chrono>
 #include <cstdint>
+#include <string>
+#include <string_view>
 #include <vector>
 
 #include <nlohmann/json_fwd.hpp>
@@ -42,4 +44,37 @@ std::vector<std::vector<TypedValue>> ProfilingStatsToTable(const ProfilingStatsW
 
 nlohmann::json ProfilingStatsToJson(const ProfilingStatsWithTotalTime &stats);
 
+/// Measures the time and rows of every operator into the per-operator
+/// histograms of `database`.
+void MeasureOperatorMetrics(const ProfilingStatsWithTotalTime &stats, std::string_view database);
+
+/**
+ * Profiling statistics of many executions of the same plan, summed per logical
+ * operator.
+ */
+class AggregatedProfilingStats {
+ public:
+  struct OperatorStats {
+    uint64_t key{0};
+    std::string name;
+    int64_t actual_hits{0};
+    // Time spent in the operator itself, without its children
+    double time_ms{0};
+  };
+
+  void Add(const ProfilingStatsWithTotalTime &stats);
+
+  uint64_t samples() const { return samples_; }
+  double total_time_ms() const { return total_time_ms_; }
+  /// Operators in pre-order of the plan, as first seen by an execution.
+  const std::vector<OperatorStats> &operators() const { return operators_; }
+
+ private:
+  void Add(const ProfilingStats &stats, unsigned long long total_cycles, std::chrono::duration<double> total_time);
+
+  uint64_t samples_{0};
+  double total_time_ms_{0};
+  std::vector<OperatorStats> operators_;
+};
+
 }  // namespace memgraph::query::plan
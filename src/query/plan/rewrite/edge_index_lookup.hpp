@@ -862,10 +862,10 @@ class EdgeIndexRewriter final : public HierarchicalLogicalOperatorVisitor {
     if (found_index) {
       // Copy the property filter and then erase it from filters.
       const auto prop_filter = *found_index->filter.property_filter;
-      if (prop_filter.type_ != PropertyFilter::Type::REGEX_MATCH) {
+      if (!prop_filter.IsCheckedAfterIndexScan()) {
         // Remove the original expression from Filter operation only if it's not
-        // a regex match. In such a case we need to perform the matching even
-        // after we've scanned the index.
+        // a regex or prefix match. In such a case we need to perform the matching
+        // even after we've scanned the index.
         filter_exprs_for_removal_.insert(found_index->filter.expression);
       }
       filters_.EraseFilter(found_index->filter);
@@ -880,7 +880,7 @@ class EdgeIndexRewriter final : public HierarchicalLogicalOperatorVisitor {
             GetEdgeType(found_index.value()), GetProperty(prop_filter.property_), prop_filter.lower_bound_,
             prop_filter.upper_bound_, view);
       }
-      if (prop_filter.type_ == PropertyFilter::Type::REGEX_MATCH) {
+      if (prop_filter.IsCheckedAfterIndexScan()) {
         // Generate index scan using the empty string as a lower bound.
         Expression *empty_string = ast_storage_->Create<PrimitiveLiteral>("");
         auto lower_bound = utils::MakeBoundInclusive(empty_string);
@@ -938,10 +938,10 @@ class EdgeIndexRewriter final : public HierarchicalLogicalOperatorVisitor {
 
     // Copy the property filter and then erase it from filters.
     const auto prop_filter = *found_property_index->filter.property_filter;
-    if (prop_filter.type_ != PropertyFilter::Type::REGEX_MATCH) {
+    if (!prop_filter.IsCheckedAfterIndexScan()) {
       // Remove the original expression from Filter operation only if it's not
-      // a regex match. In such a case we need to perform the matching even
-      // after we've scanned the index.
+      // a regex or prefix match. In such a case we need to perform the matching
+      // even after we've scanned the index.
       filter_exprs_for_removal_.insert(found_property_index->filter.expression);
     }
     filters_.EraseFilter(found_property_index->filter);
@@ -950,7 +950,7 @@ class EdgeIndexRewriter final : public HierarchicalLogicalOperatorVisitor {
           input, common.edge_symbol, common.node1_symbol, common.node2_symbol, common.direction,
           GetProperty(prop_filter.property_), prop_filter.lower_bound_, prop_filter.upper_bound_, view);
     }
-    if (prop_filter.type_ == PropertyFilter::Type::REGEX_MATCH) {
+    if (prop_filter.IsCheckedAfterIndexScan()) {
       // Generate index scan using the empty string as a lower bound.
       Expression *empty_string = ast_storage_->Create<PrimitiveLiteral>("");
       auto lower_bound = utils::MakeBoundInclusive(empty_string);
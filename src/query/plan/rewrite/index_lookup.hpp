@@ -1123,6 +1123,8 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
                 return 6.0;
               }
             }
+            case STARTS_WITH:
+              return 6.0;  // scans only the strings with the prefix, but they are compared once more
             case REGEX_MATCH:
               return 5.0;  // REGEX compare is more expensive
             case IN:
@@ -1311,6 +1313,9 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
         case PropertyFilter::Type::REGEX_MATCH: {
           return ExpressionRange::RegexMatch();
         }
+        case PropertyFilter::Type::STARTS_WITH: {
+          return ExpressionRange::StartsWith(filter.property_filter->value_);
+        }
         case PropertyFilter::Type::RANGE: {
           return ExpressionRange::Range(filter.property_filter->lower_bound_, filter.property_filter->upper_bound_);
         }
@@ -1408,10 +1413,10 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
       for (auto const &filter_info : found_index->filters) {
         const PropertyFilter prop_filter = *filter_info.property_filter;
 
-        if (prop_filter.type_ != PropertyFilter::Type::REGEX_MATCH) {
+        if (!prop_filter.IsCheckedAfterIndexScan()) {
           // Remove the original expression from Filter operation only if it's not
-          // a regex match. In such a case we need to perform the matching even
-          // after we've scanned the index.
+          // a regex or prefix match. In such a case we need to perform the matching
+          // even after we've scanned the index.
           filter_exprs_for_removal_.insert(filter_info.expression);
         }
 
@@ -1476,10 +1481,10 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
             // Filter cleanup, track which expressions to remove
             for (auto const &filter_info : label_property_index.filters) {
               const PropertyFilter prop_filter = *filter_info.property_filter;
-              if (prop_filter.type_ != PropertyFilter::Type::REGEX_MATCH) {
+              if (!prop_filter.IsCheckedAfterIndexScan()) {
                 // Remove the original expression from Filter operation only if it's not
-                // a regex match. In such a case we need to perform the matching even
-                // after we've scanned the index.
+                // a regex or prefix match. In such a case we need to perform the matching
+                // even after we've scanned the index.
                 removed_expressions.push_back(filter_info.expression);
               }
             }
@@ -11,8 +11,9 @@
 
 #include "query/plan/variable_start_planner.hpp"
 
+#include <algorithm>
+#include <deque>
 #include <limits>
-#include <queue>
 #include <utility>
 
 #include "utils/flag_validation.hpp"
@@ -27,13 +28,21 @@ namespace memgraph::query::plan::impl {
 
 namespace {
 
+// The share of the Cartesian product of a disconnected part with what is
+// already expanded that is kept by joining them on the part's starting node.
+// An equality between a property of the node and of an expanded symbol is
+// rewritten into a HashJoin or an IndexedJoin, while any other filter between
+// them only filters the product.
+constexpr double kEqualityJoinSelectivity{0.01};
+constexpr double kFilterJoinSelectivity{0.25};
+
 // Add applicable expansions for `node_symbol` to `next_expansions`. These
 // expansions are removed from `atom_symbol_to_expansions`, while
 // `seen_expansions` and `expanded_symbols` are populated with new data.
 void AddNextExpansions(const Symbol &atom_symbol, const Matching &matching, const SymbolTable &symbol_table,
                        std::unordered_set<Symbol> &expanded_symbols,
                        std::unordered_map<Symbol, std::set<size_t>> &atom_symbol_to_expansions,
-                       std::unordered_set<size_t> &seen_expansions, std::queue<Expansion> &next_expansions) {
+                       std::unordered_set<size_t> &seen_expansions, std::deque<Expansion> &next_expansions) {
   auto atom_to_expansions_it = atom_symbol_to_expansions.find(atom_symbol);
   if (atom_to_expansions_it == atom_symbol_to_expansions.end()) {
     return;
@@ -101,7 +110,7 @@ void AddNextExpansions(const Symbol &atom_symbol, const Matching &matching, cons
       expanded_symbols.insert(symbol_table.at(*expansion.edge->identifier_));
       expanded_symbols.insert(symbol_table.at(*expansion.node2->identifier_));
     }
-    next_expansions.emplace(std::move(expansion));
+    next_expansions.emplace_back(std::move(expansion));
     atom_expansions_it = atom_expansions.erase(atom_expansions_it);
   }
   if (atom_expansions.empty()) {
@@ -109,18 +118,80 @@ void AddNextExpansions(const Symbol &atom_symbol, const Matching &matching, cons
   }
 }
 
+// How much of the Cartesian product is kept when a part starting at
+// `node_symbol` is joined with the `bound_symbols`, judging by the filters
+// between them.
+double JoinSelectivity(const Symbol &node_symbol, const Filters &filters,
+                       const std::unordered_set<Symbol> &bound_symbols) {
+  double selectivity = 1.0;
+  for (const auto &filter : filters) {
+    if (filter.used_symbols.size() < 2 || !filter.used_symbols.contains(node_symbol)) continue;
+    const bool joins_bound = std::ranges::all_of(filter.used_symbols, [&](const auto &symbol) {
+      return symbol == node_symbol || bound_symbols.contains(symbol);
+    });
+    if (!joins_bound) continue;
+    const bool is_equality =
+        filter.type == FilterInfo::Type::Property && filter.property_filter->type_ == PropertyFilter::Type::EQUAL;
+    selectivity = std::min(selectivity, is_equality ? kEqualityJoinSelectivity : kFilterJoinSelectivity);
+  }
+  return selectivity;
+}
+
+// True if both nodes of the expansion are already bound. Such an expansion
+// closes a cycle of the pattern and only checks for the edge, so it can't
+// grow the number of rows.
+bool ClosesCycle(const Expansion &expansion, const SymbolTable &symbol_table,
+                 const std::unordered_set<Symbol> &bound_symbols) {
+  return expansion.edge && expansion.node2 && expansion.symbols_in_range.empty() &&
+         bound_symbols.contains(symbol_table.at(*expansion.node1->identifier_)) &&
+         bound_symbols.contains(symbol_table.at(*expansion.node2->identifier_));
+}
+
+// Returns the node of the not yet expanded part of the matching which is
+// expected to produce the fewest rows when joined with the `bound_symbols`,
+// or nullptr if every expansion has been used. That is the number of
+// vertices the node matches, weighted by the kind of join it allows.
+const NodeAtom *CheapestRemainingNode(const Matching &matching, const SymbolTable &symbol_table,
+                                      const std::unordered_set<size_t> &seen_expansions,
+                                      const std::unordered_set<Symbol> &bound_symbols,
+                                      const NodeCardinalityEstimator &estimate_cardinality) {
+  const NodeAtom *cheapest_node = nullptr;
+  double cheapest_cardinality = std::numeric_limits<double>::max();
+  auto try_node = [&](const NodeAtom *node) {
+    if (!node) return;
+    const auto &symbol = symbol_table.at(*node->identifier_);
+    const auto cardinality = estimate_cardinality(symbol, matching.filters) *
+                             JoinSelectivity(symbol, matching.filters, bound_symbols);
+    if (cardinality < cheapest_cardinality) {
+      cheapest_node = node;
+      cheapest_cardinality = cardinality;
+    }
+  };
+  for (size_t i = 0; i < matching.expansions.size(); ++i) {
+    if (seen_expansions.contains(i)) continue;
+    try_node(matching.expansions[i].node1);
+    try_node(matching.expansions[i].node2);
+  }
+  return cheapest_node;
+}
+
 // Generates expansions emanating from the start_node by forming a chain. When
 // the chain can no longer be continued, a different starting node is picked
 // among remaining expansions and the process continues. This is done until all
-// matching.expansions are used.
+// matching.expansions are used. Expansions closing a cycle are chained before
+// the ones reaching new nodes.
 std::vector<Expansion> ExpansionsFrom(const PatternAtom *start_atom, const Matching &matching,
-                                      const SymbolTable &symbol_table) {
+                                      const SymbolTable &symbol_table,
+                                      const NodeCardinalityEstimator &estimate_cardinality) {
   // Make a copy of atom_symbol_to_expansions, because we will modify it as
   // expansions are chained.
   auto atom_symbol_to_expansions = matching.atom_symbol_to_expansions;
   std::unordered_set<size_t> seen_expansions;
-  std::queue<Expansion> next_expansions;
+  std::deque<Expansion> next_expansions;
   std::unordered_set<Symbol> expanded_symbols({symbol_table.at(*start_atom->identifier_)});
+  // Symbols of the chained expansions, unlike expanded_symbols which also has
+  // those of the expansions waiting in next_expansions
+  std::unordered_set<Symbol> bound_symbols({symbol_table.at(*start_atom->identifier_)});
 
   auto add_next_expansions = [&](const auto *atom) {
     AddNextExpansions(symbol_table.at(*atom->identifier_), matching, symbol_table, expanded_symbols,
@@ -133,23 +204,51 @@ std::vector<Expansion> ExpansionsFrom(const PatternAtom *start_atom, const Match
   // additional expansions be added.
   std::vector<Expansion> expansions;
   while (!next_expansions.empty()) {
-    auto expansion = next_expansions.front();
-    next_expansions.pop();
+    auto next = next_expansions.begin();
+    if (!expansions.empty()) {
+      next = std::ranges::find_if(next_expansions, [&](const auto &expansion) {
+        return ClosesCycle(expansion, symbol_table, bound_symbols);
+      });
+      if (next == next_expansions.end()) next = next_expansions.begin();
+    }
+    auto expansion = std::move(*next);
+    next_expansions.erase(next);
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
     if (expansions.empty() && utils::Downcast<EdgeAtom>(const_cast<PatternAtom *>(start_atom))) {
       expansion.expand_from_edge = true;
     }
+    bound_symbols.insert(symbol_table.at(*expansion.node1->identifier_));
+    if (expansion.edge) {
+      bound_symbols.insert(symbol_table.at(*expansion.edge->identifier_));
+      bound_symbols.insert(symbol_table.at(*expansion.node2->identifier_));
+    }
     expansions.emplace_back(expansion);
     add_next_expansions(expansion.node1);
     if (expansion.node2) {
       add_next_expansions(expansion.node2);
     }
+    if (next_expansions.empty() && !atom_symbol_to_expansions.empty() && estimate_cardinality) {
+      // The rest of the matching isn't connected to what was expanded so far,
+      // so it will be joined with it. Continue from the node expected to join
+      // into the fewest rows. That way the disconnected parts are ordered from
+      // the smallest to the largest, preferring those that can be hash or index
+      // joined, and the smaller ones end up on the cached, left side of the
+      // Cartesian (or the join it gets rewritten into).
+      const auto *next_start =
+          CheapestRemainingNode(matching, symbol_table, seen_expansions, bound_symbols, estimate_cardinality);
+      if (next_start) {
+        expanded_symbols.insert(symbol_table.at(*next_start->identifier_));
+        bound_symbols.insert(symbol_table.at(*next_start->identifier_));
+        add_next_expansions(next_start);
+      }
+    }
   }
   if (!atom_symbol_to_expansions.empty()) {
-    // We could pick a new starting expansion, but to avoid runtime
-    // complexity, simply append the remaining expansions. They should have the
-    // correct order, since the original expansions were verified during
-    // semantic analysis.
+    // Without an estimate we could pick a new starting expansion, but to avoid
+    // runtime complexity, simply append the remaining expansions. They should
+    // have the correct order, since the original expansions were verified
+    // during semantic analysis. The same is done with expansions which can't
+    // be chained because their range uses symbols that aren't expanded.
     for (size_t i = 0; i < matching.expansions.size(); ++i) {
       if (seen_expansions.find(i) != seen_expansions.end()) {
         continue;
@@ -196,9 +295,11 @@ FilterMatching ToFilterMatching(Matching &matching) {
 
 }  // namespace
 
-VaryMatchingStart::VaryMatchingStart(Matching matching, const SymbolTable &symbol_table)
+VaryMatchingStart::VaryMatchingStart(Matching matching, const SymbolTable &symbol_table,
+                                     NodeCardinalityEstimator estimate_cardinality)
     : matching_(matching),
       symbol_table_(symbol_table),
+      estimate_cardinality_(std::move(estimate_cardinality)),
       graph_atoms_(ExpansionAtoms(matching.expansions, symbol_table)) {}
 
 VaryMatchingStart::iterator::iterator(VaryMatchingStart *self, bool is_done)
@@ -212,7 +313,8 @@ VaryMatchingStart::iterator::iterator(VaryMatchingStart *self, bool is_done)
     // Overwrite the original matching expansions with the new ones by
     // generating it from the first start node.
     start_atoms_it_ = self_->graph_atoms_.begin();
-    current_matching_.expansions = ExpansionsFrom(**start_atoms_it_, self_->matching_, self_->symbol_table_);
+    current_matching_.expansions = ExpansionsFrom(**start_atoms_it_, self_->matching_, self_->symbol_table_,
+                                                   self_->estimate_cardinality_);
   }
   DMG_ASSERT(start_atoms_it_ || self_->graph_atoms_.empty(),
              "start_atoms_it_ should only be nullopt when self_->graph_atoms_ is empty");
@@ -236,22 +338,24 @@ VaryMatchingStart::iterator &VaryMatchingStart::iterator::operator++() {
     return *this;
   }
   const auto &start_atom = **start_atoms_it_;
-  current_matching_.expansions = ExpansionsFrom(start_atom, self_->matching_, self_->symbol_table_);
+  current_matching_.expansions =
+      ExpansionsFrom(start_atom, self_->matching_, self_->symbol_table_, self_->estimate_cardinality_);
   return *this;
 }
 
 CartesianProduct<VaryMatchingStart> VaryMultiMatchingStarts(const std::vector<Matching> &matchings,
-                                                            const SymbolTable &symbol_table) {
+                                                            const SymbolTable &symbol_table,
+                                                            const NodeCardinalityEstimator &estimate_cardinality) {
   std::vector<VaryMatchingStart> variants;
   variants.reserve(matchings.size());
   for (const auto &matching : matchings) {
-    variants.emplace_back(matching, symbol_table);
+    variants.emplace_back(matching, symbol_table, estimate_cardinality);
   }
   return MakeCartesianProduct(std::move(variants));
 }
 
-CartesianProduct<VaryMatchingStart> VaryFilterMatchingStarts(const Matching &matching,
-                                                             const SymbolTable &symbol_table) {
+CartesianProduct<VaryMatchingStart> VaryFilterMatchingStarts(const Matching &matching, const SymbolTable &symbol_table,
+                                                             const NodeCardinalityEstimator &estimate_cardinality) {
   auto filter_matchings_cnt = 0;
   for (const auto &filter : matching.filters) {
     filter_matchings_cnt += static_cast<int>(filter.matchings.size());
@@ -262,19 +366,21 @@ CartesianProduct<VaryMatchingStart> VaryFilterMatchingStarts(const Matching &mat
 
   for (const auto &filter : matching.filters) {
     for (const auto &filter_matching : filter.matchings) {
-      variants.emplace_back(filter_matching, symbol_table);
+      variants.emplace_back(filter_matching, symbol_table, estimate_cardinality);
     }
   }
 
   return MakeCartesianProduct(std::move(variants));
 }
 
-VaryQueryPartMatching::VaryQueryPartMatching(SingleQueryPart query_part, const SymbolTable &symbol_table)
+VaryQueryPartMatching::VaryQueryPartMatching(SingleQueryPart query_part, const SymbolTable &symbol_table,
+                                             const NodeCardinalityEstimator &estimate_cardinality)
     : query_part_(std::move(query_part)),
-      matchings_(VaryMatchingStart(query_part_.matching, symbol_table)),
-      optional_matchings_(VaryMultiMatchingStarts(query_part_.optional_matching, symbol_table)),
-      merge_matchings_(VaryMultiMatchingStarts(query_part_.merge_matching, symbol_table)),
-      filter_matchings_(VaryFilterMatchingStarts(query_part_.matching, symbol_table)) {}
+      matchings_(VaryMatchingStart(query_part_.matching, symbol_table, estimate_cardinality)),
+      optional_matchings_(
+          VaryMultiMatchingStarts(query_part_.optional_matching, symbol_table, estimate_cardinality)),
+      merge_matchings_(VaryMultiMatchingStarts(query_part_.merge_matching, symbol_table, estimate_cardinality)),
+      filter_matchings_(VaryFilterMatchingStarts(query_part_.matching, symbol_table, estimate_cardinality)) {}
 
 VaryQueryPartMatching::iterator::iterator(SingleQueryPart query_part, VaryMatchingStart::iterator matchings_begin,
                                           VaryMatchingStart::iterator matchings_end,
@@ -12,10 +12,13 @@
 /// @file
 #pragma once
 
+#include <functional>
+
 #include "cppitertools/imap.hpp"
 #include "cppitertools/slice.hpp"
 #include "gflags/gflags.h"
 
+#include "query/plan/cost_estimator.hpp"
 #include "query/plan/rule_based_planner.hpp"
 
 DECLARE_uint64(query_max_plans);
@@ -178,11 +181,18 @@ class PatternAtomSymbolEqual {
   const SymbolTable &symbol_table_;
 };
 
+// Estimated number of vertices a node symbol matches on its own, judging only
+// by the filters applied to it.
+using NodeCardinalityEstimator = std::function<double(const Symbol &, const Filters &)>;
+
 // Generates n matchings, where n is the number of nodes to match. Each Matching
-// will have a different node as a starting node for expansion.
+// will have a different node as a starting node for expansion. When the
+// estimator is given, the parts of the matching which aren't connected to the
+// starting node are expanded from their most selective node, the smallest
+// part first.
 class VaryMatchingStart {
  public:
-  VaryMatchingStart(Matching, const SymbolTable &);
+  VaryMatchingStart(Matching, const SymbolTable &, NodeCardinalityEstimator = {});
 
   class iterator {
    public:
@@ -222,21 +232,24 @@ class VaryMatchingStart {
   friend class iterator;
   Matching matching_;
   const SymbolTable &symbol_table_;
+  NodeCardinalityEstimator estimate_cardinality_;
   std::vector<PatternAtom *> graph_atoms_;
 };
 
 // Similar to VaryMatchingStart, but varies the starting nodes for all given
 // matchings. After all matchings produce multiple alternative starts, the
 // Cartesian product of all of them is returned.
-CartesianProduct<VaryMatchingStart> VaryMultiMatchingStarts(const std::vector<Matching> &, const SymbolTable &);
+CartesianProduct<VaryMatchingStart> VaryMultiMatchingStarts(const std::vector<Matching> &, const SymbolTable &,
+                                                            const NodeCardinalityEstimator & = {});
 
-CartesianProduct<VaryMatchingStart> VaryFilterMatchingStarts(const Matching &matching, const SymbolTable &symbol_table);
+CartesianProduct<VaryMatchingStart> VaryFilterMatchingStarts(const Matching &matching, const SymbolTable &symbol_table,
+                                                             const NodeCardinalityEstimator &estimate_cardinality = {});
 
 // Produces alternative query parts out of a single part by varying how each
 // graph matching is done.
 class VaryQueryPartMatching {
  public:
-  VaryQueryPartMatching(SingleQueryPart, const SymbolTable &);
+  VaryQueryPartMatching(SingleQueryPart, const SymbolTable &, const NodeCardinalityEstimator & = {});
 
   class iterator {
    public:
@@ -319,12 +332,38 @@ class VariableStartPlanner {
     auto single_query_parts = ExtractSingleQueryParts(std::make_unique<QueryParts>(query_parts));
 
     for (const auto &single_query_part : single_query_parts) {
-      varying_query_matchings.emplace_back(single_query_part, symbol_table);
+      varying_query_matchings.emplace_back(single_query_part, symbol_table, [this](const auto &symbol,
+                                                                                   const auto &filters) {
+        return EstimateNodeCardinality(symbol, filters);
+      });
     }
 
     return iter::slice(MakeCartesianProduct(std::move(varying_query_matchings)), 0UL, FLAGS_query_max_plans);
   }
 
+  // Same estimates the CostEstimator makes for the scan of a single node: an id
+  // filter matches a single vertex, an indexed label all of its vertices and
+  // every other filter keeps a fixed share of them.
+  double EstimateNodeCardinality(const Symbol &symbol, const Filters &filters) const {
+    using CardParam = typename CostEstimator<std::remove_pointer_t<decltype(context_->db)>>::CardParam;
+    auto *db = context_->db;
+    if (!filters.IdFilters(symbol).empty()) return 1.0;
+    auto cardinality = static_cast<double>(db->VerticesCount());
+    double selectivity = 1.0;
+    for (const auto &label : filters.FilteredLabels(symbol)) {
+      const auto label_id = db->NameToLabel(label.name);
+      if (db->LabelIndexExists(label_id)) {
+        cardinality = std::min(cardinality, static_cast<double>(db->VerticesCount(label_id)));
+      } else {
+        selectivity *= CardParam::kFilter;
+      }
+    }
+    for ([[maybe_unused]] const auto &property_filter : filters.PropertyFilters(symbol)) {
+      selectivity *= CardParam::kFilter;
+    }
+    return cardinality * selectivity;
+  }
+
   std::vector<SingleQueryPart> ExtractSingleQueryParts(const std::shared_ptr<QueryParts> query_parts) {
     std::vector<SingleQueryPart> results;
 
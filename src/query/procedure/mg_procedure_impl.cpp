@@ -1714,6 +1714,124 @@ mgp_error mgp_result_record_insert(mgp_result_record *record, const char *field_
   });
 }
 
+mgp_error mgp_result_new_batch(mgp_result *res, size_t size, mgp_result_batch **result) {
+  return WrapExceptions(
+      [res, size] {
+        auto allocator = res->batches.get_allocator();
+        res->batches.push_back(mgp_result_batch{
+            .signature = &res->signature,
+            .size = size,
+            .columns =
+                memgraph::utils::pmr::vector<memgraph::utils::pmr::vector<memgraph::query::TypedValue>>{
+                    res->signature.size(), memgraph::utils::pmr::vector<memgraph::query::TypedValue>(allocator),
+                    allocator},
+            .has_deleted_values = memgraph::utils::pmr::vector<bool>(allocator),
+            .ignore_deleted_values = !res->is_transactional});
+        return &res->batches.back();
+      },
+      result);
+}
+
+mgp_error mgp_result_batch_size(mgp_result_batch *batch, size_t *result) {
+  return WrapExceptions([batch] { return batch->size; }, result);
+}
+
+namespace {
+
+const ResultsMetadata &FindResultField(const mgp_result_batch &batch, const char *field_name) {
+  MG_ASSERT(batch.signature, "Expected to have a valid signature");
+  auto find_it = batch.signature->find(field_name);
+  if (find_it == batch.signature->end()) {
+    throw std::out_of_range{fmt::format("The result doesn't have any field named '{}'.", field_name)};
+  }
+  return find_it->second;
+}
+
+// All values of a column have the same type, so the field type is checked only once.
+template <typename TMakeValue>
+void SetResultColumn(mgp_result_batch *batch, const char *field_name, const TMakeValue &make_value) {
+  const auto &field = FindResultField(*batch, field_name);
+  auto &column = batch->columns[field.field_id];
+  if (batch->size == 0) return;
+  // The column is left as it was if any of the values can't be made
+  memgraph::utils::pmr::vector<memgraph::query::TypedValue> values(column.get_allocator());
+  values.reserve(batch->size);
+  values.push_back(make_value(0, values.get_allocator()));
+  if (!field.type->SatisfiesType(values.front())) [[unlikely]] {
+    throw std::logic_error{
+        fmt::format("The type of value doesn't satisfy the type '{}'!", field.type->GetPresentableName())};
+  }
+  for (size_t i = 1; i < batch->size; ++i) {
+    values.push_back(make_value(i, values.get_allocator()));
+  }
+  column = std::move(values);
+}
+
+}  // namespace
+
+mgp_error mgp_result_batch_set_int_column(mgp_result_batch *batch, const char *field_name, const int64_t *values) {
+  return WrapExceptions([=] {
+    SetResultColumn(batch, field_name, [values](size_t i, memgraph::query::TypedValue::allocator_type allocator) {
+      return memgraph::query::TypedValue(values[i], allocator);
+    });
+  });
+}
+
+mgp_error mgp_result_batch_set_double_column(mgp_result_batch *batch, const char *field_name, const double *values) {
+  return WrapExceptions([=] {
+    SetResultColumn(batch, field_name, [values](size_t i, memgraph::query::TypedValue::allocator_type allocator) {
+      return memgraph::query::TypedValue(values[i], allocator);
+    });
+  });
+}
+
+mgp_error mgp_result_batch_set_bool_column(mgp_result_batch *batch, const char *field_name, const int *values) {
+  return WrapExceptions([=] {
+    SetResultColumn(batch, field_name, [values](size_t i, memgraph::query::TypedValue::allocator_type allocator) {
+      return memgraph::query::TypedValue(values[i] != 0, allocator);
+    });
+  });
+}
+
+mgp_error mgp_result_batch_set_vertex_column(mgp_result_batch *batch, const char *field_name, mgp_graph *graph,
+                                             const int64_t *vertex_ids) {
+  return WrapExceptions([=] {
+    SetResultColumn(batch, field_name,
+                    [graph, vertex_ids](size_t i, memgraph::query::TypedValue::allocator_type allocator) {
+                      auto maybe_vertex = std::visit(
+                          [graph, id = vertex_ids[i]](auto *impl) {
+                            return impl->FindVertex(memgraph::storage::Gid::FromInt(id), graph->view);
+                          },
+                          graph->impl);
+                      if (!maybe_vertex) {
+                        throw std::out_of_range{fmt::format("There is no vertex with ID {}.", vertex_ids[i])};
+                      }
+                      return memgraph::query::TypedValue(*maybe_vertex, allocator);
+                    });
+  });
+}
+
+mgp_error mgp_result_batch_insert(mgp_result_batch *batch, size_t index, const char *field_name, mgp_value *val) {
+  return WrapExceptions([=] {
+    if (index >= batch->size) {
+      throw std::out_of_range{fmt::format("The record index {} exceeds the batch size {}.", index, batch->size)};
+    }
+    const auto &field = FindResultField(*batch, field_name);
+    if (batch->ignore_deleted_values && ContainsDeleted(val)) [[unlikely]] {
+      batch->has_deleted_values.resize(batch->size, false);
+      batch->has_deleted_values[index] = true;
+      return;
+    }
+    if (!field.type->SatisfiesType(*val)) [[unlikely]] {
+      throw std::logic_error{
+          fmt::format("The type of value doesn't satisfy the type '{}'!", field.type->GetPresentableName())};
+    }
+    auto &column = batch->columns[field.field_id];
+    column.resize(batch->size, memgraph::query::TypedValue(column.get_allocator()));
+    column[index] = ToTypedValue(*val, column.get_allocator());
+  });
+}
+
 mgp_error mgp_func_result_set_error_msg(mgp_func_result *res, const char *msg, mgp_memory *memory) {
   return WrapExceptions([=] {
     // We are copying error message string here, that includes the out of memory message
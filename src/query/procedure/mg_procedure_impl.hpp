@@ -580,12 +580,25 @@ struct mgp_result_record {
   bool has_deleted_values = false;
 };
 
+struct mgp_result_batch {
+  const memgraph::utils::pmr::map<memgraph::utils::pmr::string, ResultsMetadata> *signature;
+  size_t size;
+  /// A column for each field, indexed by `ResultsMetadata::field_id`. A column is empty until it is set, so fields
+  /// which are never set don't cost a null value for each record.
+  memgraph::utils::pmr::vector<memgraph::utils::pmr::vector<memgraph::query::TypedValue>> columns;
+  /// Records which are skipped because they contain a deleted value; empty while none is deleted
+  memgraph::utils::pmr::vector<bool> has_deleted_values;
+  bool ignore_deleted_values = false;
+};
+
 struct mgp_result {
-  explicit mgp_result(memgraph::utils::MemoryResource *mem) : signature(mem), rows(mem) {}
+  explicit mgp_result(memgraph::utils::MemoryResource *mem) : signature(mem), rows(mem), batches(mem) {}
 
   /// Store all needed metadata so everything is searchable using one find
   memgraph::utils::pmr::map<memgraph::utils::pmr::string, ResultsMetadata> signature;
   memgraph::utils::pmr::vector<mgp_result_record> rows;
+  /// Yielded after `rows`
+  memgraph::utils::pmr::vector<mgp_result_batch> batches;
   std::optional<memgraph::utils::pmr::string> error_msg;
   bool is_transactional = true;
 };
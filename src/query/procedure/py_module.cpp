@@ -15,12 +15,18 @@
 #include <methodobject.h>
 #include <objimpl.h>
 #include <pyerrors.h>
+#include <algorithm>
 #include <array>
+#include <cstring>
+#include <limits>
 #include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "mg_procedure.h"
 #include "query/exceptions.hpp"
@@ -394,6 +400,222 @@ PyObject *PyGraphMustAbort(PyGraph *self, PyObject *Py_UNUSED(ignored)) {
   return PyBool_FromLong(mgp_must_abort(self->graph));
 }
 
+// Native numbers written straight into a Python `bytearray`, which grows like a vector and is handed over to
+// Python without copying the values again.
+template <typename T>
+class BytesColumn {
+ public:
+  bool Reserve(size_t capacity) {
+    if (capacity <= capacity_) return true;
+    const auto bytes_size = static_cast<Py_ssize_t>(capacity * sizeof(T));
+    if (!bytes_) {
+      bytes_ = py::Object(PyByteArray_FromStringAndSize(nullptr, bytes_size));
+      if (!bytes_) return false;
+    } else if (PyByteArray_Resize(bytes_.Ptr(), bytes_size) != 0) {
+      return false;
+    }
+    capacity_ = capacity;
+    return true;
+  }
+
+  bool PushBack(T value) {
+    if (size_ == capacity_ && !Reserve(std::max(kMinCapacity, capacity_ * 2))) return false;
+    std::memcpy(PyByteArray_AS_STRING(bytes_.Ptr()) + (size_ * sizeof(T)), &value, sizeof(T));
+    ++size_;
+    return true;
+  }
+
+  T operator[](size_t index) const {
+    T value;
+    std::memcpy(&value, PyByteArray_AS_STRING(bytes_.Ptr()) + (index * sizeof(T)), sizeof(T));
+    return value;
+  }
+
+  size_t size() const { return size_; }
+
+  // Shrinks the `bytearray` to the written values and hands it over.
+  py::Object Release() {
+    const auto size = std::exchange(size_, 0);
+    capacity_ = 0;
+    if (!bytes_) return py::Object(PyByteArray_FromStringAndSize(nullptr, 0));
+    if (PyByteArray_Resize(bytes_.Ptr(), static_cast<Py_ssize_t>(size * sizeof(T))) != 0) return py::Object();
+    return std::exchange(bytes_, py::Object());
+  }
+
+ private:
+  static constexpr size_t kMinCapacity = 1024;
+
+  py::Object bytes_;
+  size_t size_{0};
+  size_t capacity_{0};
+};
+
+// Graph exported by _mgp.Graph.export_arrays
+struct GraphArrays {
+  BytesColumn<int64_t> vertex_ids;
+  BytesColumn<int64_t> edge_ids;
+  // Indices into `vertex_ids`
+  BytesColumn<int64_t> sources;
+  BytesColumn<int64_t> targets;
+  // A column for each exported property, aligned with `vertex_ids` and `edge_ids`
+  std::vector<BytesColumn<double>> vertex_properties;
+  std::vector<BytesColumn<double>> edge_properties;
+};
+
+// Takes the ownership of `value`.
+double NumericPropertyValue(mgp_value *value) {
+  MgpUniquePtr<mgp_value> owned_value{value, mgp_value_destroy};
+  switch (Call<mgp_value_type>(mgp_value_get_type, value)) {
+    case MGP_VALUE_TYPE_INT:
+      return static_cast<double>(Call<int64_t>(mgp_value_get_int, value));
+    case MGP_VALUE_TYPE_DOUBLE:
+      return Call<double>(mgp_value_get_double, value);
+    case MGP_VALUE_TYPE_BOOL:
+      return CallBool(mgp_value_get_bool, value) ? 1.0 : 0.0;
+    default:
+      return std::numeric_limits<double>::quiet_NaN();
+  }
+}
+
+// Exports the graph with a single pass over the vertices and their out edges.
+mgp_error ExportGraphArrays(mgp_graph *graph, mgp_memory *memory, const std::vector<std::string> &vertex_properties,
+                            const std::vector<std::string> &edge_properties, GraphArrays &arrays) {
+  MgpUniquePtr<mgp_vertices_iterator> vertices_it{nullptr, mgp_vertices_iterator_destroy};
+  if (const auto err = CreateMgpObject(vertices_it, mgp_graph_iter_vertices, graph, memory);
+      err != mgp_error::MGP_ERROR_NO_ERROR) {
+    return err;
+  }
+  std::vector<int64_t> target_ids;
+  mgp_vertex *vertex{nullptr};
+  auto err = mgp_vertices_iterator_get(vertices_it.get(), &vertex);
+  for (; err == mgp_error::MGP_ERROR_NO_ERROR && vertex; err = mgp_vertices_iterator_next(vertices_it.get(), &vertex)) {
+    const auto source = static_cast<int64_t>(arrays.vertex_ids.size());
+    if (!arrays.vertex_ids.PushBack(Call<mgp_vertex_id>(mgp_vertex_get_id, vertex).as_int)) {
+      return mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE;
+    }
+    for (size_t i = 0; i < vertex_properties.size(); ++i) {
+      mgp_value *value{nullptr};
+      if (err = mgp_vertex_get_property(vertex, vertex_properties[i].c_str(), memory, &value);
+          err != mgp_error::MGP_ERROR_NO_ERROR) {
+        return err;
+      }
+      if (!arrays.vertex_properties[i].PushBack(NumericPropertyValue(value))) {
+        return mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE;
+      }
+    }
+
+    MgpUniquePtr<mgp_edges_iterator> edges_it{nullptr, mgp_edges_iterator_destroy};
+    if (err = CreateMgpObject(edges_it, mgp_vertex_iter_out_edges, vertex, memory);
+        err != mgp_error::MGP_ERROR_NO_ERROR) {
+      return err;
+    }
+    mgp_edge *edge{nullptr};
+    for (err = mgp_edges_iterator_get(edges_it.get(), &edge); err == mgp_error::MGP_ERROR_NO_ERROR && edge;
+         err = mgp_edges_iterator_next(edges_it.get(), &edge)) {
+      if (!arrays.edge_ids.PushBack(Call<mgp_edge_id>(mgp_edge_get_id, edge).as_int) ||
+          !arrays.sources.PushBack(source)) {
+        return mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE;
+      }
+      target_ids.push_back(Call<mgp_vertex_id>(mgp_vertex_get_id, Call<mgp_vertex *>(mgp_edge_get_to, edge)).as_int);
+      for (size_t i = 0; i < edge_properties.size(); ++i) {
+        mgp_value *value{nullptr};
+        if (err = mgp_edge_get_property(edge, edge_properties[i].c_str(), memory, &value);
+            err != mgp_error::MGP_ERROR_NO_ERROR) {
+          return err;
+        }
+        if (!arrays.edge_properties[i].PushBack(NumericPropertyValue(value))) {
+          return mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE;
+        }
+      }
+    }
+    if (err != mgp_error::MGP_ERROR_NO_ERROR) return err;
+  }
+  if (err != mgp_error::MGP_ERROR_NO_ERROR) return err;
+
+  std::unordered_map<int64_t, int64_t> vertex_indices;
+  vertex_indices.reserve(arrays.vertex_ids.size());
+  for (size_t i = 0; i < arrays.vertex_ids.size(); ++i) {
+    vertex_indices.emplace(arrays.vertex_ids[i], static_cast<int64_t>(i));
+  }
+  if (!arrays.targets.Reserve(target_ids.size())) return mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE;
+  for (const auto target_id : target_ids) {
+    // A subgraph can contain an edge without its target
+    auto found = vertex_indices.find(target_id);
+    arrays.targets.PushBack(found == vertex_indices.end() ? -1 : found->second);
+  }
+  return mgp_error::MGP_ERROR_NO_ERROR;
+}
+
+std::optional<std::vector<std::string>> PropertyNamesFromPython(PyObject *py_names) {
+  py::Object py_sequence(PySequence_Fast(py_names, "Expected a sequence of property names."));
+  if (!py_sequence) return std::nullopt;
+  std::vector<std::string> names;
+  const auto size = PySequence_Fast_GET_SIZE(py_sequence.Ptr());
+  names.reserve(size);
+  for (Py_ssize_t i = 0; i < size; ++i) {
+    auto *py_name = PySequence_Fast_GET_ITEM(py_sequence.Ptr(), i);
+    if (!PyUnicode_Check(py_name)) {
+      PyErr_SetString(PyExc_TypeError, "Expected property name to be 'str'.");
+      return std::nullopt;
+    }
+    const char *name = PyUnicode_AsUTF8(py_name);
+    if (!name) return std::nullopt;
+    names.emplace_back(name);
+  }
+  return names;
+}
+
+// Returns a dict of `bytes` with native int64 and float64 items, which `mgp.GraphArrays` exposes as typed memoryviews.
+PyObject *GraphArraysToPython(GraphArrays &arrays, const std::vector<std::string> &vertex_properties,
+                              const std::vector<std::string> &edge_properties) {
+  auto set_item = [](const py::Object &dict, const char *key, const py::Object &value) {
+    return value && PyDict_SetItemString(dict.Ptr(), key, value.Ptr()) == 0;
+  };
+  auto properties_to_python = [&](const std::vector<std::string> &names, auto &columns) {
+    py::Object py_properties(PyDict_New());
+    if (!py_properties) return py::Object();
+    for (size_t i = 0; i < names.size(); ++i) {
+      if (!set_item(py_properties, names[i].c_str(), columns[i].Release())) return py::Object();
+    }
+    return py_properties;
+  };
+
+  py::Object py_arrays(PyDict_New());
+  if (!py_arrays || !set_item(py_arrays, "vertex_ids", arrays.vertex_ids.Release()) ||
+      !set_item(py_arrays, "edge_ids", arrays.edge_ids.Release()) ||
+      !set_item(py_arrays, "sources", arrays.sources.Release()) ||
+      !set_item(py_arrays, "targets", arrays.targets.Release()) ||
+      !set_item(py_arrays, "vertex_properties", properties_to_python(vertex_properties, arrays.vertex_properties)) ||
+      !set_item(py_arrays, "edge_properties", properties_to_python(edge_properties, arrays.edge_properties))) {
+    return nullptr;
+  }
+  return py_arrays.Steal();
+}
+
+PyObject *PyGraphExportArrays(PyGraph *self, PyObject *args) {
+  MG_ASSERT(PyGraphIsValidImpl(*self));
+  MG_ASSERT(self->memory);
+  PyObject *py_vertex_properties = nullptr;
+  PyObject *py_edge_properties = nullptr;
+  if (!PyArg_ParseTuple(args, "OO", &py_vertex_properties, &py_edge_properties)) return nullptr;
+  auto vertex_properties = PropertyNamesFromPython(py_vertex_properties);
+  if (!vertex_properties) return nullptr;
+  auto edge_properties = PropertyNamesFromPython(py_edge_properties);
+  if (!edge_properties) return nullptr;
+
+  GraphArrays arrays{.vertex_ids = {},
+                     .edge_ids = {},
+                     .sources = {},
+                     .targets = {},
+                     .vertex_properties = std::vector<BytesColumn<double>>(vertex_properties->size()),
+                     .edge_properties = std::vector<BytesColumn<double>>(edge_properties->size())};
+  if (RaiseExceptionFromErrorCode(
+          ExportGraphArrays(self->graph, self->memory, *vertex_properties, *edge_properties, arrays))) {
+    return nullptr;
+  }
+  return GraphArraysToPython(arrays, *vertex_properties, *edge_properties);
+}
+
 static PyMethodDef PyGraphMethods[] = {
     {"__reduce__", reinterpret_cast<PyCFunction>(DisallowPickleAndCopy), METH_NOARGS, "__reduce__ is not supported"},
     {"invalidate", reinterpret_cast<PyCFunction>(PyGraphInvalidate), METH_NOARGS,
@@ -413,6 +635,8 @@ static PyMethodDef PyGraphMethods[] = {
     {"iter_vertices", reinterpret_cast<PyCFunction>(PyGraphIterVertices), METH_NOARGS, "Return _mgp.VerticesIterator."},
     {"must_abort", reinterpret_cast<PyCFunction>(PyGraphMustAbort), METH_NOARGS,
      "Check whether the running procedure should abort"},
+    {"export_arrays", reinterpret_cast<PyCFunction>(PyGraphExportArrays), METH_VARARGS,
+     "Export vertices, edges and numeric properties as flat arrays."},
     {nullptr, {}, {}, {}},
 };
 
@@ -924,13 +1148,27 @@ void SkipRecord(mgp_value *field_val, std::vector<RecordFieldCache> &current_rec
   }
 }
 
+// Classes of the `mgp` module that procedure results are checked against. They are looked up once, when a
+// procedure is registered while its module loads, instead of importing `mgp` for every record.
+struct MgpResultTypes {
+  py::Object record;
+  py::Object columns;
+  py::Object vertex_ids;
+
+  static std::optional<MgpResultTypes> Import() {
+    py::Object py_mgp(PyImport_ImportModule("mgp"));
+    if (!py_mgp) return std::nullopt;
+    MgpResultTypes types{.record = py_mgp.GetAttr("Record"),
+                         .columns = py_mgp.GetAttr("Columns"),
+                         .vertex_ids = py_mgp.GetAttr("VertexIds")};
+    if (!types.record || !types.columns || !types.vertex_ids) return std::nullopt;
+    return types;
+  }
+};
+
 std::optional<py::ExceptionInfo> AddRecordFromPython(mgp_result *result, py::Object py_record, mgp_graph *graph,
-                                                     mgp_memory *memory) {
-  py::Object py_mgp(PyImport_ImportModule("mgp"));
-  if (!py_mgp) return py::FetchError();
-  auto record_cls = py_mgp.GetAttr("Record");
-  if (!record_cls) return py::FetchError();
-  if (!PyObject_IsInstance(py_record.Ptr(), record_cls.Ptr())) {
+                                                     mgp_memory *memory, const MgpResultTypes &types) {
+  if (!PyObject_IsInstance(py_record.Ptr(), types.record.Ptr())) {
     std::stringstream ss;
     ss << "Value '" << py_record << "' is not an instance of 'mgp.Record'";
     const auto &msg = ss.str();
@@ -1020,7 +1258,7 @@ std::optional<py::ExceptionInfo> AddRecordFromPython(mgp_result *result, py::Obj
 }
 
 std::optional<py::ExceptionInfo> AddMultipleRecordsFromPython(mgp_result *result, py::Object py_seq, mgp_graph *graph,
-                                                              mgp_memory *memory) {
+                                                              mgp_memory *memory, const MgpResultTypes &types) {
   Py_ssize_t len = PySequence_Size(py_seq.Ptr());
   if (len == -1) return py::FetchError();
   result->rows.reserve(len);
@@ -1029,7 +1267,7 @@ std::optional<py::ExceptionInfo> AddMultipleRecordsFromPython(mgp_result *result
   for (Py_ssize_t i = 0, curr_item = 0; i < len; ++i, ++curr_item) {
     py::Object py_record(PySequence_GetItem(py_seq.Ptr(), curr_item));
     if (!py_record) return py::FetchError();
-    auto maybe_exc = AddRecordFromPython(result, py_record, graph, memory);
+    auto maybe_exc = AddRecordFromPython(result, py_record, graph, memory, types);
     if (maybe_exc) return maybe_exc;
     // Once PySequence_DelSlice deletes "transformed" objects, starting index is 0 again.
     if (i && i % del_cnt == 0) {
@@ -1043,20 +1281,270 @@ std::optional<py::ExceptionInfo> AddMultipleRecordsFromPython(mgp_result *result
 }
 
 std::optional<py::ExceptionInfo> AddMultipleBatchRecordsFromPython(mgp_result *result, py::Object py_seq,
-                                                                   mgp_graph *graph, mgp_memory *memory) {
+                                                                   mgp_graph *graph, mgp_memory *memory,
+                                                                   const MgpResultTypes &types) {
   Py_ssize_t len = PySequence_Size(py_seq.Ptr());
   if (len == -1) return py::FetchError();
   result->rows.reserve(len);
   for (Py_ssize_t i = 0; i < len; ++i) {
     py::Object py_record(PySequence_GetItem(py_seq.Ptr(), i));
     if (!py_record) return py::FetchError();
-    auto maybe_exc = AddRecordFromPython(result, py_record, graph, memory);
+    auto maybe_exc = AddRecordFromPython(result, py_record, graph, memory, types);
     if (maybe_exc) return maybe_exc;
   }
   PySequence_DelSlice(py_seq.Ptr(), 0, PySequence_Size(py_seq.Ptr()));
   return std::nullopt;
 }
 
+// A column of `mgp.Columns`. Columns exposing a 1-D buffer of numbers (`array.array`, NumPy arrays, ...) are read
+// in place, without creating a Python object for each element.
+class ResultColumn {
+ public:
+  static std::optional<ResultColumn> FromPython(PyObject *py_name, PyObject *py_column, mgp_graph *graph,
+                                                const MgpResultTypes &types) {
+    ResultColumn column;
+    column.py_name_ = py::Object::FromBorrow(py_name);
+    column.name_ = PyUnicode_AsUTF8(py_name);
+    if (!column.name_) return std::nullopt;
+    py::Object py_values = py::Object::FromBorrow(py_column);
+    const auto is_vertex_ids = PyObject_IsInstance(py_column, types.vertex_ids.Ptr());
+    if (is_vertex_ids == -1) return std::nullopt;
+    if (is_vertex_ids) {
+      column.graph_ = graph;
+      py_values = py_values.GetAttr("ids");
+      if (!py_values) return std::nullopt;
+    }
+    if (PyObject_CheckBuffer(py_values.Ptr())) {
+      py::Object py_view(PyMemoryView_FromObject(py_values.Ptr()));
+      if (!py_view) return std::nullopt;
+      const auto *view = PyMemoryView_GET_BUFFER(py_view.Ptr());
+      if (view->ndim == 1 && view->format) {
+        // Only native sizes and byte order are read in place; standard sizes ('=', '<', ...) are converted
+        std::string_view format{view->format};
+        if (format.starts_with('@')) format.remove_prefix(1);
+        if (format.size() == 1 && NativeItemSize(format[0]) == view->itemsize) {
+          column.format_ = format[0];
+          column.size_ = view->shape ? view->shape[0] : view->len / view->itemsize;
+          column.py_values_ = std::move(py_view);
+          return column;
+        }
+      }
+    }
+    // Everything else is converted element by element, same as the fields of `mgp.Record`
+    column.py_values_ = py::Object(PySequence_Fast(py_values.Ptr(), "Expected a column to be a sequence."));
+    if (!column.py_values_) return std::nullopt;
+    column.size_ = PySequence_Fast_GET_SIZE(column.py_values_.Ptr());
+    return column;
+  }
+
+  Py_ssize_t Size() const { return size_; }
+
+  const char *Name() const { return name_; }
+
+  PyObject *PyName() const { return py_name_.Ptr(); }
+
+  // Returns nullptr with the Python error set on failure.
+  mgp_value *Value(Py_ssize_t row, mgp_memory *memory) const {
+    if (!format_) {
+      auto *py_value = PySequence_Fast_GET_ITEM(py_values_.Ptr(), row);
+      if (!graph_) return PyObjectToMgpValueWithPythonExceptions(py_value, memory);
+      const auto id = PyLong_AsLongLong(py_value);
+      if (id == -1 && PyErr_Occurred()) return nullptr;
+      return MakeVertex(id, memory);
+    }
+    const auto *view = PyMemoryView_GET_BUFFER(py_values_.Ptr());
+    const auto *item = static_cast<const char *>(view->buf) + row * (view->strides ? view->strides[0] : view->itemsize);
+    switch (format_) {
+      case 'b':
+        return MakeInt(Read<signed char>(item), memory);
+      case 'B':
+        return MakeInt(Read<unsigned char>(item), memory);
+      case 'h':
+        return MakeInt(Read<short>(item), memory);
+      case 'H':
+        return MakeInt(Read<unsigned short>(item), memory);
+      case 'i':
+        return MakeInt(Read<int>(item), memory);
+      case 'I':
+        return MakeInt(Read<unsigned int>(item), memory);
+      case 'l':
+        return MakeInt(Read<long>(item), memory);
+      case 'L':
+        return MakeInt(static_cast<int64_t>(Read<unsigned long>(item)), memory);
+      case 'q':
+        return MakeInt(Read<long long>(item), memory);
+      case 'Q':
+        return MakeInt(static_cast<int64_t>(Read<unsigned long long>(item)), memory);
+      case 'f':
+        return MakeDouble(Read<float>(item), memory);
+      case 'd':
+        return MakeDouble(Read<double>(item), memory);
+      case '?':
+        return MakeBool(Read<bool>(item), memory);
+      default:
+        LOG_FATAL("Unexpected column format '{}'", format_);
+    }
+  }
+
+ private:
+  // Size of a native `struct` format character, 0 for the ones not read in place
+  static Py_ssize_t NativeItemSize(char format) {
+    switch (format) {
+      case 'b':
+      case 'B':
+        return sizeof(char);
+      case 'h':
+      case 'H':
+        return sizeof(short);
+      case 'i':
+      case 'I':
+        return sizeof(int);
+      case 'l':
+      case 'L':
+        return sizeof(long);
+      case 'q':
+      case 'Q':
+        return sizeof(long long);
+      case 'f':
+        return sizeof(float);
+      case 'd':
+        return sizeof(double);
+      case '?':
+        return sizeof(bool);
+      default:
+        return 0;
+    }
+  }
+
+  template <typename T>
+  static T Read(const char *item) {
+    T value;
+    std::memcpy(&value, item, sizeof(T));
+    return value;
+  }
+
+  mgp_value *MakeInt(int64_t value, mgp_memory *memory) const {
+    if (graph_) return MakeVertex(value, memory);
+    mgp_value *mgp_val{nullptr};
+    if (RaiseExceptionFromErrorCode(mgp_value_make_int(value, memory, &mgp_val))) return nullptr;
+    return mgp_val;
+  }
+
+  mgp_value *MakeDouble(double value, mgp_memory *memory) const {
+    if (graph_) {
+      PyErr_SetString(PyExc_TypeError, "Expected 'mgp.VertexIds' to contain integers.");
+      return nullptr;
+    }
+    mgp_value *mgp_val{nullptr};
+    if (RaiseExceptionFromErrorCode(mgp_value_make_double(value, memory, &mgp_val))) return nullptr;
+    return mgp_val;
+  }
+
+  mgp_value *MakeBool(bool value, mgp_memory *memory) const {
+    if (graph_) {
+      PyErr_SetString(PyExc_TypeError, "Expected 'mgp.VertexIds' to contain integers.");
+      return nullptr;
+    }
+    mgp_value *mgp_val{nullptr};
+    if (RaiseExceptionFromErrorCode(mgp_value_make_bool(value, memory, &mgp_val))) return nullptr;
+    return mgp_val;
+  }
+
+  mgp_value *MakeVertex(int64_t id, mgp_memory *memory) const {
+    mgp_vertex *vertex{nullptr};
+    if (RaiseExceptionFromErrorCode(mgp_graph_get_vertex_by_id(graph_, mgp_vertex_id{.as_int = id}, memory, &vertex))) {
+      return nullptr;
+    }
+    if (!vertex) {
+      PyErr_Format(PyExc_IndexError, "Unable to find the vertex with ID %lld.", static_cast<long long>(id));
+      return nullptr;
+    }
+    mgp_value *mgp_val{nullptr};
+    if (RaiseExceptionFromErrorCode(mgp_value_make_vertex(vertex, &mgp_val))) {
+      mgp_vertex_destroy(vertex);
+      return nullptr;
+    }
+    return mgp_val;
+  }
+
+  py::Object py_name_;
+  const char *name_{nullptr};
+  // Either a memoryview when `format_` is set, or the result of `PySequence_Fast`
+  py::Object py_values_;
+  char format_{0};
+  Py_ssize_t size_{0};
+  // Set when the column holds vertex IDs which are resolved to vertices
+  mgp_graph *graph_{nullptr};
+};
+
+std::optional<py::ExceptionInfo> AddColumnsFromPython(mgp_result *result, py::Object py_columns, mgp_graph *graph,
+                                                      mgp_memory *memory, const MgpResultTypes &types) {
+  py::Object columns_dict(py_columns.GetAttr("columns"));
+  if (!columns_dict) return py::FetchError();
+  if (!PyDict_Check(columns_dict)) {
+    PyErr_SetString(PyExc_TypeError, "Expected 'mgp.Columns.columns' to be a 'dict'");
+    return py::FetchError();
+  }
+  std::vector<ResultColumn> columns;
+  columns.reserve(PyDict_Size(columns_dict.Ptr()));
+  PyObject *key{nullptr};
+  PyObject *value{nullptr};
+  Py_ssize_t pos = 0;
+  while (PyDict_Next(columns_dict.Ptr(), &pos, &key, &value)) {
+    if (!PyUnicode_Check(key)) {
+      std::stringstream ss;
+      ss << "Field name '" << py::Object::FromBorrow(key) << "' is not an instance of 'str'";
+      const auto &msg = ss.str();
+      PyErr_SetString(PyExc_TypeError, msg.c_str());
+      return py::FetchError();
+    }
+    auto column = ResultColumn::FromPython(key, value, graph, types);
+    if (!column) return py::FetchError();
+    if (!columns.empty() && column->Size() != columns.front().Size()) {
+      PyErr_SetString(PyExc_ValueError, "Expected all columns of 'mgp.Columns' to have the same length.");
+      return py::FetchError();
+    }
+    columns.push_back(std::move(*column));
+  }
+  if (columns.empty()) return std::nullopt;
+
+  const auto rows = columns.front().Size();
+  result->rows.reserve(result->rows.size() + rows);
+  const auto is_transactional = storage::IsTransactional(graph->storage_mode);
+  std::vector<mgp_value *> row_values(columns.size(), nullptr);
+  utils::OnScopeExit destroy_row_values{[&row_values] {
+    for (auto *&row_value : row_values) {
+      mgp_value_destroy(std::exchange(row_value, nullptr));
+    }
+  }};
+  for (Py_ssize_t row = 0; row < rows; ++row) {
+    bool contains_deleted = false;
+    for (size_t i = 0; i < columns.size(); ++i) {
+      row_values[i] = columns[i].Value(row, memory);
+      if (!row_values[i]) return py::FetchError();
+      // IN_MEMORY_ANALYTICAL skips the whole row if it contains a deleted value
+      contains_deleted = contains_deleted || (!is_transactional && ContainsDeleted(row_values[i]));
+    }
+    if (contains_deleted) {
+      for (auto *&row_value : row_values) {
+        mgp_value_destroy(std::exchange(row_value, nullptr));
+      }
+      continue;
+    }
+    mgp_result_record *record{nullptr};
+    if (RaiseExceptionFromErrorCode(mgp_result_new_record(result, &record))) {
+      return py::FetchError();
+    }
+    for (size_t i = 0; i < columns.size(); ++i) {
+      // InsertField takes the ownership of the value
+      auto *field_val = std::exchange(row_values[i], nullptr);
+      auto maybe_exc = InsertField(columns[i].PyName(), columns[i].PyName(), record, columns[i].Name(), field_val);
+      if (maybe_exc) return maybe_exc;
+    }
+  }
+  return std::nullopt;
+}
+
 std::function<void()> PyObjectCleanup(py::Object &py_object) {
   return [py_object]() {
     // After making sure all references from our side have been cleared,
@@ -1070,8 +1558,8 @@ std::function<void()> PyObjectCleanup(py::Object &py_object) {
   };
 }
 
-void CallPythonProcedure(const py::Object &py_cb, mgp_list *args, mgp_graph *graph, mgp_result *result,
-                         mgp_memory *memory, bool is_batched) {
+void CallPythonProcedure(const py::Object &py_cb, const MgpResultTypes &types, mgp_list *args, mgp_graph *graph,
+                         mgp_result *result, mgp_memory *memory, bool is_batched) {
   auto gil = py::EnsureGIL();
 
   auto error_to_msg = [](const std::optional<py::ExceptionInfo> &exc_info) -> std::optional<std::string> {
@@ -1088,13 +1576,16 @@ void CallPythonProcedure(const py::Object &py_cb, mgp_list *args, mgp_graph *gra
     if (!py_args) return py::FetchError();
     auto py_res = py_cb.Call(py_graph, py_args);
     if (!py_res) return py::FetchError();
+    if (PyObject_IsInstance(py_res.Ptr(), types.columns.Ptr())) {
+      return AddColumnsFromPython(result, py_res, graph, memory, types);
+    }
     if (PySequence_Check(py_res.Ptr())) {
       if (is_batched) {
-        return AddMultipleBatchRecordsFromPython(result, py_res, graph, memory);
+        return AddMultipleBatchRecordsFromPython(result, py_res, graph, memory, types);
       }
-      return AddMultipleRecordsFromPython(result, py_res, graph, memory);
+      return AddMultipleRecordsFromPython(result, py_res, graph, memory, types);
     }
-    return AddRecordFromPython(result, py_res, graph, memory);
+    return AddRecordFromPython(result, py_res, graph, memory, types);
   };
 
   // It is *VERY IMPORTANT* to note that this code takes great care not to keep
@@ -1161,8 +1652,8 @@ void CallPythonInitializer(const py::Object &py_initializer, mgp_list *args, mgp
   }
 }
 
-void CallPythonTransformation(const py::Object &py_cb, mgp_messages *msgs, mgp_graph *graph, mgp_result *result,
-                              mgp_memory *memory) {
+void CallPythonTransformation(const py::Object &py_cb, const MgpResultTypes &types, mgp_messages *msgs,
+                              mgp_graph *graph, mgp_result *result, mgp_memory *memory) {
   auto gil = py::EnsureGIL();
 
   auto error_to_msg = [](const std::optional<py::ExceptionInfo> &exc_info) -> std::optional<std::string> {
@@ -1178,9 +1669,9 @@ void CallPythonTransformation(const py::Object &py_cb, mgp_messages *msgs, mgp_g
     auto py_res = py_cb.Call(py_graph, py_messages);
     if (!py_res) return py::FetchError();
     if (PySequence_Check(py_res.Ptr())) {
-      return AddMultipleRecordsFromPython(result, py_res, graph, memory);
+      return AddMultipleRecordsFromPython(result, py_res, graph, memory, types);
     }
-    return AddRecordFromPython(result, py_res, graph, memory);
+    return AddRecordFromPython(result, py_res, graph, memory, types);
   };
 
   // It is *VERY IMPORTANT* to note that this code takes great care not to keep
@@ -1300,10 +1791,13 @@ PyObject *PyQueryModuleAddProcedure(PyQueryModule *self, PyObject *cb, bool is_w
     PyErr_SetString(PyExc_ValueError, "Procedure name is not a valid identifier");
     return nullptr;
   }
+  auto types = MgpResultTypes::Import();
+  if (!types) return nullptr;
   auto *memory = self->module->procedures.get_allocator().resource();
   mgp_proc proc(name,
-                [py_cb](mgp_list *args, mgp_graph *graph, mgp_result *result, mgp_memory *memory) {
-                  CallPythonProcedure(py_cb, args, graph, result, memory, false);
+                [py_cb, types = std::move(*types)](mgp_list *args, mgp_graph *graph, mgp_result *result,
+                                                   mgp_memory *memory) {
+                  CallPythonProcedure(py_cb, types, args, graph, result, memory, false);
                 },
                 memory, {.is_write = is_write_procedure});
   const auto &[proc_it, did_insert] = self->module->procedures.emplace(name, std::move(proc));
@@ -1341,11 +1835,13 @@ PyObject *PyQueryModuleAddBatchProcedure(PyQueryModule *self, PyObject *args, bo
     PyErr_SetString(PyExc_ValueError, "Procedure name is not a valid identifier");
     return nullptr;
   }
+  auto types = MgpResultTypes::Import();
+  if (!types) return nullptr;
   auto *memory = self->module->procedures.get_allocator().resource();
   mgp_proc proc(
       name,
-      [py_cb](mgp_list *args, mgp_graph *graph, mgp_result *result, mgp_memory *memory) {
-        CallPythonProcedure(py_cb, args, graph, result, memory, true);
+      [py_cb, types = std::move(*types)](mgp_list *args, mgp_graph *graph, mgp_result *result, mgp_memory *memory) {
+        CallPythonProcedure(py_cb, types, args, graph, result, memory, true);
       },
       [py_initializer](mgp_list *args, mgp_graph *graph, mgp_memory *memory) {
         CallPythonInitializer(py_initializer, args, graph, memory);
@@ -1394,11 +1890,13 @@ PyObject *PyQueryModuleAddTransformation(PyQueryModule *self, PyObject *cb) {
     PyErr_SetString(PyExc_ValueError, "Transformation name is not a valid identifier");
     return nullptr;
   }
+  auto types = MgpResultTypes::Import();
+  if (!types) return nullptr;
   auto *memory = self->module->transformations.get_allocator().resource();
   mgp_trans trans(
       name,
-      [py_cb](mgp_messages *msgs, mgp_graph *graph, mgp_result *result, mgp_memory *memory) {
-        CallPythonTransformation(py_cb, msgs, graph, result, memory);
+      [py_cb, types = std::move(*types)](mgp_messages *msgs, mgp_graph *graph, mgp_result *result, mgp_memory *memory) {
+        CallPythonTransformation(py_cb, types, msgs, graph, result, memory);
       },
       memory);
   const auto [trans_it, did_insert] = self->module->transformations.emplace(name, std::move(trans));
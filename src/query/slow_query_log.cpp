@@ -0,0 +1,110 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "query/slow_query_log.hpp"
+
+#include <thread>
+#include <utility>
+
+#include "flags/query.hpp"
+#include "utils/fnv.hpp"
+#include "utils/logging.hpp"
+
+namespace memgraph::query {
+
+SlowQueryLog::SlowQueryLog(std::filesystem::path storage_directory, int32_t buffer_size,
+                           int32_t buffer_flush_interval_millis)
+    : storage_directory_(std::move(storage_directory)),
+      buffer_size_(buffer_size),
+      buffer_flush_interval_millis_(buffer_flush_interval_millis) {}
+
+void SlowQueryLog::Start() {
+  MG_ASSERT(!started_, "Trying to start an already started slow query log!");
+  if (FLAGS_query_log_slow_threshold_ms == 0 && FLAGS_query_log_slow_memory_threshold_mb == 0) return;
+
+  utils::EnsureDirOrDie(storage_directory_);
+
+  buffer_.emplace(buffer_size_);
+  started_ = true;
+
+  ReopenLog();
+  scheduler_.SetInterval(std::chrono::milliseconds(buffer_flush_interval_millis_));
+  scheduler_.Run("SlowQueryLog", [&] { Flush(); });
+}
+
+SlowQueryLog::~SlowQueryLog() {
+  if (!started_) return;
+
+  started_ = false;
+  std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+  scheduler_.Stop();
+  Flush();
+}
+
+bool SlowQueryLog::IsSlow(std::chrono::duration<double> execution_time, std::optional<int64_t> memory_peak) {
+  const auto latency_threshold = FLAGS_query_log_slow_threshold_ms;
+  if (latency_threshold != 0 && execution_time >= std::chrono::milliseconds(latency_threshold)) return true;
+  const auto memory_threshold = FLAGS_query_log_slow_memory_threshold_mb;
+  return memory_threshold != 0 && memory_peak &&
+         static_cast<uint64_t>(*memory_peak) >= memory_threshold * 1024 * 1024;
+}
+
+uint64_t SlowQueryLog::HashParameters(const Parameters &parameters) {
+  using Parameter = std::pair<int, storage::ExternalPropertyValue>;
+  struct ParameterHash {
+    size_t operator()(const Parameter &parameter) const {
+      return utils::HashCombine<int, storage::ExternalPropertyValue>{}(parameter.first, parameter.second);
+    }
+  };
+  return utils::FnvCollection<Parameters, Parameter, ParameterHash>{}(parameters);
+}
+
+void SlowQueryLog::Record(Entry entry) {
+  if (!started_.load(std::memory_order_relaxed)) return;
+  entry.timestamp =
+      std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch())
+          .count();
+  buffer_->emplace(std::move(entry));
+}
+
+void SlowQueryLog::ReopenLog() {
+  if (!started_.load(std::memory_order_relaxed)) return;
+  auto guard = std::lock_guard{lock_};
+  if (log_.IsOpen()) log_.Close();
+  log_.Open(storage_directory_ / "slow_query.log", utils::OutputFile::Mode::APPEND_TO_EXISTING);
+}
+
+void SlowQueryLog::Flush() {
+  auto guard = std::lock_guard{lock_};
+  for (int32_t i = 0; i < buffer_size_; ++i) {
+    auto entry = buffer_->pop();
+    if (!entry) break;
+
+    auto line = nlohmann::json::object();
+    line["timestamp"] = entry->timestamp;
+    line["db"] = std::move(entry->db);
+    line["query"] = std::move(entry->query);
+    line["parameters_hash"] = entry->parameters_hash;
+    line["rows"] = entry->rows;
+    line["parsing_time"] = entry->parsing_time;
+    line["planning_time"] = entry->planning_time;
+    line["execution_time"] = entry->execution_time;
+    line["commit_time"] = entry->commit_time;
+    line["memory_peak"] = entry->memory_peak ? nlohmann::json(*entry->memory_peak) : nlohmann::json();
+    line["plan"] = std::move(entry->plan);
+
+    log_.Write(line.dump() + "\n");
+  }
+  log_.Sync();
+}
+
+}  // namespace memgraph::query
@@ -0,0 +1,101 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <string>
+
+#include <nlohmann/json.hpp>
+
+#include "data_structures/ring_buffer.hpp"
+#include "query/parameters.hpp"
+#include "utils/file.hpp"
+#include "utils/scheduler.hpp"
+
+namespace memgraph::query {
+
+/// Structured log of queries that exceeded --query-log-slow-threshold-ms or
+/// --query-log-slow-memory-threshold-mb. Entries are queued in a ring buffer
+/// and written as JSON lines by a background flush, the same way the audit log
+/// is written. Functions used for logging are thread-safe, functions used for
+/// setup aren't thread-safe.
+class SlowQueryLog {
+ public:
+  struct Entry {
+    // Microseconds since epoch, set when the entry is recorded
+    int64_t timestamp{0};
+    std::string db;
+    // The stripped query, with literals replaced by parameters
+    std::string query;
+    uint64_t parameters_hash{0};
+    uint64_t rows{0};
+    // Times in seconds, as in the query summary
+    double parsing_time{0};
+    double planning_time{0};
+    double execution_time{0};
+    double commit_time{0};
+    std::optional<int64_t> memory_peak;
+    // The executed plan, with per-operator statistics when the execution was profiled
+    nlohmann::json plan;
+  };
+
+  static constexpr int32_t kBufferSize = 1000;
+  static constexpr int32_t kBufferFlushIntervalMillis = 1000;
+
+  explicit SlowQueryLog(std::filesystem::path storage_directory, int32_t buffer_size = kBufferSize,
+                        int32_t buffer_flush_interval_millis = kBufferFlushIntervalMillis);
+
+  ~SlowQueryLog();
+
+  SlowQueryLog(const SlowQueryLog &) = delete;
+  SlowQueryLog(SlowQueryLog &&) = delete;
+  SlowQueryLog &operator=(const SlowQueryLog &) = delete;
+  SlowQueryLog &operator=(SlowQueryLog &&) = delete;
+
+  /// Starts the log if at least one of the thresholds is set. All functions can
+  /// still be used when the log isn't started and they won't do anything.
+  void Start();
+
+  bool IsStarted() const { return started_.load(std::memory_order_relaxed); }
+
+  /// Whether a query with the given execution time and memory peak should be logged.
+  static bool IsSlow(std::chrono::duration<double> execution_time, std::optional<int64_t> memory_peak);
+
+  static uint64_t HashParameters(const Parameters &parameters);
+
+  /// Queues an entry to be written. Thread-safe.
+  void Record(Entry entry);
+
+  /// Reopens the log file. Used for log file rotation. Thread-safe.
+  void ReopenLog();
+
+ private:
+  void Flush();
+
+  std::filesystem::path storage_directory_;
+  int32_t buffer_size_;
+  int32_t buffer_flush_interval_millis_;
+  std::atomic<bool> started_{false};
+
+  std::optional<RingBuffer<Entry>> buffer_;
+  utils::Scheduler scheduler_;
+
+  utils::OutputFile log_;
+  std::mutex lock_;
+};
+
+}  // namespace memgraph::query
@@ -0,0 +1,162 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "query/stream/batching.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <iterator>
+
+#include <fmt/format.h>
+#include <spdlog/spdlog.h>
+
+#include "query/exceptions.hpp"
+
+namespace memgraph::query::stream {
+namespace {
+// Non-ASCII bytes are parts of unicode letters, which can be used in names as well.
+bool IsNameChar(char c) {
+  return std::isalnum(static_cast<unsigned char>(c)) || c == '_' || static_cast<unsigned char>(c) >= 0x80;
+}
+
+const storage::ExternalPropertyValue::map_t &EmptyParameters() {
+  static const storage::ExternalPropertyValue::map_t empty_parameters{};
+  return empty_parameters;
+}
+}  // namespace
+
+std::optional<BatchedQuery> MakeBatchedQuery(std::string_view query) {
+  while (!query.empty() && (std::isspace(static_cast<unsigned char>(query.back())) || query.back() == ';')) {
+    query.remove_suffix(1);
+  }
+
+  std::string body;
+  body.reserve(query.size());
+  std::vector<std::string> parameters;
+  size_t i = 0;
+  // Copies everything up to and including the first `terminator` starting from `from`, or the rest of the query if
+  // there is none.
+  auto copy_until = [&](size_t from, std::string_view terminator) {
+    const auto end = query.find(terminator, from);
+    const auto copy_end = end == std::string_view::npos ? query.size() : end + terminator.size();
+    body.append(query.substr(i, copy_end - i));
+    i = copy_end;
+  };
+
+  while (i < query.size()) {
+    const char c = query[i];
+    const std::string_view rest = query.substr(i);
+    if (c == '\'' || c == '"') {
+      // String literal, skipping over escaped characters
+      size_t end = i + 1;
+      while (end < query.size() && query[end] != c) end += query[end] == '\\' ? 2 : 1;
+      end = std::min(end + 1, query.size());
+      body.append(query.substr(i, end - i));
+      i = end;
+    } else if (c == '`') {
+      // Escaped name, where a backtick is escaped by doubling it
+      size_t end = i + 1;
+      while (end < query.size() && (query[end] != '`' || (end + 1 < query.size() && query[end + 1] == '`'))) {
+        end += query[end] == '`' ? 2 : 1;
+      }
+      end = std::min(end + 1, query.size());
+      body.append(query.substr(i, end - i));
+      i = end;
+    } else if (rest.starts_with("//")) {
+      copy_until(i + 2, "\n");
+    } else if (rest.starts_with("/*")) {
+      copy_until(i + 2, "*/");
+    } else if (c == '$') {
+      size_t end = i + 1;
+      while (end < query.size() && IsNameChar(query[end])) ++end;
+      if (end == i + 1) return std::nullopt;
+      const auto parameter = query.substr(i + 1, end - i - 1);
+      fmt::format_to(std::back_inserter(body), "{}['{}']", kRowVariable, parameter);
+      if (std::find(parameters.begin(), parameters.end(), parameter) == parameters.end()) {
+        parameters.emplace_back(parameter);
+      }
+      i = end;
+    } else {
+      body.push_back(c);
+      ++i;
+    }
+  }
+
+  // The closing brace is on a new line in case the query ends with a comment.
+  return BatchedQuery{
+      .query = fmt::format("UNWIND ${} AS {} CALL {{ WITH {} {}\n}}", kBatchParameterName, kRowVariable, kRowVariable,
+                           body),
+      .parameters = std::move(parameters)};
+}
+
+bool QueryBatcher::Execute(const std::vector<QueryAndParams> &queries, const Executor &execute) {
+  for (auto it = queries.cbegin(); it != queries.cend();) {
+    auto group_end = std::find_if(std::next(it), queries.cend(),
+                                  [&](const auto &query_and_params) { return query_and_params.first != it->first; });
+    auto result = BatchResult::ONE_BY_ONE;
+    if (std::distance(it, group_end) > 1 && !failed_batches_.contains(it->first) && !IsUnbatchable(it->first)) {
+      result = ExecuteBatch(it, group_end, execute);
+    }
+    if (result == BatchResult::FAILED) return false;
+    if (result == BatchResult::ONE_BY_ONE) {
+      for (auto query_it = it; query_it != group_end; ++query_it) {
+        const auto &[query, params] = *query_it;
+        execute(query, params.IsMap() ? params.ValueMap() : EmptyParameters());
+      }
+    }
+    it = group_end;
+  }
+  return true;
+}
+
+QueryBatcher::BatchResult QueryBatcher::ExecuteBatch(Iterator begin, Iterator end, const Executor &execute) {
+  const auto &query = begin->first;
+  auto batched_query = MakeBatchedQuery(query);
+  if (!batched_query) {
+    unbatchable_queries_.put(query, true);
+    return BatchResult::ONE_BY_ONE;
+  }
+
+  storage::ExternalPropertyValue::list_t batch;
+  batch.reserve(std::distance(begin, end));
+  for (auto it = begin; it != end; ++it) {
+    const auto &params = it->second;
+    const auto has_all_parameters = std::ranges::all_of(batched_query->parameters, [&](const auto &parameter) {
+      return params.IsMap() && params.ValueMap().contains(parameter);
+    });
+    // Executing the queries one by one fails on the missing parameter, which the batched query would read as null
+    if (!has_all_parameters) return BatchResult::ONE_BY_ONE;
+    batch.emplace_back(params.IsMap() ? params : storage::ExternalPropertyValue{EmptyParameters()});
+  }
+
+  try {
+    execute(batched_query->query,
+            {{std::string{kBatchParameterName}, storage::ExternalPropertyValue{std::move(batch)}}});
+  } catch (const DatabaseContextRequiredException &) {
+    throw;
+  } catch (const QueryException &e) {
+    spdlog::warn("Executing query '{}' in stream '{}' one by one because its batched execution failed: {}", query,
+                 stream_name_, e.what());
+    failed_batches_.insert(query);
+    return BatchResult::FAILED;
+  }
+  return BatchResult::EXECUTED;
+}
+
+void QueryBatcher::Commit() {
+  // The queries were executed one by one without failing, so the batched execution failed because of batching
+  for (const auto &query : failed_batches_) {
+    unbatchable_queries_.put(query, true);
+  }
+  failed_batches_.clear();
+}
+
+}  // namespace memgraph::query::stream
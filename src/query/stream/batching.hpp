@@ -0,0 +1,103 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "storage/v2/property_value.hpp"
+#include "utils/lru_cache.hpp"
+
+namespace memgraph::query::stream {
+
+/// Name of the list parameter which holds a map of parameters for each query in a batch.
+inline constexpr std::string_view kBatchParameterName{"__memgraph_stream_batch"};
+
+/// Name of the variable which holds the map of parameters of the current query in a batched query.
+inline constexpr std::string_view kRowVariable{"__memgraph_stream_row"};
+
+struct BatchedQuery {
+  std::string query;
+  /// Names of the parameters referenced by the original query, which have to be in every map of the batch.
+  std::vector<std::string> parameters;
+
+  bool operator==(const BatchedQuery &) const = default;
+};
+
+/// Rewrites a query returned by a transformation into a query which executes it once for each map of parameters in
+/// the `kBatchParameterName` list, with the parameters of the original query read from that map. For example
+/// `CREATE (:Node {id: $id})` becomes
+///
+///   UNWIND $__memgraph_stream_batch AS __memgraph_stream_row CALL {
+///     WITH __memgraph_stream_row CREATE (:Node {id: __memgraph_stream_row['id']})
+///   }
+///
+/// A parameter missing from a map would be read as null instead of failing the query, so the batched query can only
+/// be used if every map contains all of the returned parameters.
+///
+/// Returns std::nullopt if the query references a parameter in a way that can't be rewritten. The rewritten query can
+/// still fail to prepare (e.g. if it uses a parameter for LIMIT), in which case the queries have to be executed one
+/// by one.
+std::optional<BatchedQuery> MakeBatchedQuery(std::string_view query);
+
+/// Executes the queries returned by a transformation, executing each run of consecutive queries with the same text as
+/// a single batched query.
+///
+/// A query is executed one by one if it can't be rewritten, or if one of its maps of parameters is missing a
+/// parameter. If the execution of a batched query fails, the transaction has to be aborted and the queries executed
+/// again, with that query executed one by one. The query is remembered as unbatchable only if the transaction then
+/// commits, because otherwise the failure wasn't caused by batching.
+class QueryBatcher {
+ public:
+  using QueryAndParams = std::pair<std::string, storage::ExternalPropertyValue>;
+  using Executor = std::function<void(const std::string &, const storage::ExternalPropertyValue::map_t &)>;
+
+  static constexpr size_t kMaxUnbatchableQueries = 1024;
+
+  explicit QueryBatcher(std::string stream_name, size_t max_unbatchable_queries = kMaxUnbatchableQueries)
+      : stream_name_{std::move(stream_name)}, unbatchable_queries_(static_cast<int>(max_unbatchable_queries)) {}
+
+  /// Executes the queries in the current transaction. Returns false if the transaction has to be aborted and the
+  /// queries executed again.
+  bool Execute(const std::vector<QueryAndParams> &queries, const Executor &execute);
+
+  /// Has to be called after the transaction which executed the queries commits.
+  void Commit();
+
+  /// Has to be called once the queries are done, whether they were committed or not.
+  void Reset() { failed_batches_.clear(); }
+
+  bool IsUnbatchable(const std::string &query) { return unbatchable_queries_.get(query).has_value(); }
+
+ private:
+  using Iterator = std::vector<QueryAndParams>::const_iterator;
+
+  enum class BatchResult : uint8_t { EXECUTED, ONE_BY_ONE, FAILED };
+
+  /// Executes the queries in [begin, end), which all have the same text, as a single query.
+  BatchResult ExecuteBatch(Iterator begin, Iterator end, const Executor &execute);
+
+  std::string stream_name_;
+  utils::LRUCache<std::string, bool> unbatchable_queries_;
+  /// Queries whose batched execution failed for the current queries, which are executed one by one until the queries
+  /// are done.
+  std::unordered_set<std::string> failed_batches_;
+};
+
+}  // namespace memgraph::query::stream
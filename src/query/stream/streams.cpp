@@ -29,6 +29,7 @@
 #include "query/procedure/mg_procedure_impl.hpp"
 #include "query/procedure/module.hpp"
 #include "query/query_user.hpp"
+#include "query/stream/batching.hpp"
 #include "query/stream/sources.hpp"
 #include "query/typed_value.hpp"
 #include "utils/event_counter.hpp"
@@ -84,6 +85,32 @@ std::pair<TypedValue /*query*/, TypedValue /*parameters*/> ExtractTransformation
   return {query_value, params_value};
 }
 
+/// Calls `func` with the query and the parameters of each record yielded by the transformation, either one by one or
+/// in result batches.
+template <typename TFunc>
+void ForEachTransformationResult(const mgp_result &result, const std::string_view transformation_name,
+                                 const std::string_view stream_name, TFunc &&func) {
+  for (const auto &row : result.rows) {
+    auto [query, parameters] =
+        ExtractTransformationResult(row.values, result.signature, transformation_name, stream_name);
+    func(std::move(query), std::move(parameters));
+  }
+  for (const auto &batch : result.batches) {
+    utils::pmr::vector<TypedValue> values(batch.columns.get_allocator());
+    for (size_t i = 0; i < batch.size; ++i) {
+      values.clear();
+      for (const auto &column : batch.columns) {
+        // A column which was never set is empty
+        if (column.empty()) break;
+        values.push_back(column[i]);
+      }
+      auto [query, parameters] =
+          ExtractTransformationResult(values, result.signature, transformation_name, stream_name);
+      func(std::move(query), std::move(parameters));
+    }
+  }
+}
+
 template <typename TMessage>
 void CallCustomTransformation(const std::string &transformation_name, const std::vector<TMessage> &messages,
                               mgp_result &result, storage::Storage::Accessor &storage_accessor,
@@ -102,6 +129,7 @@ void CallCustomTransformation(const std::string &transformation_name, const std:
     mgp_graph graph{&db_accessor, storage::View::OLD, nullptr, db_accessor.GetStorageMode()};
     mgp_memory memory{&memory_resource};
     result.rows.clear();
+    result.batches.clear();
     result.error_msg.reset();
 
     auto signature_query_it = trans.results.find(query_param_name);
@@ -512,7 +540,10 @@ Streams::StreamsMap::iterator Streams::CreateConsumer(StreamsMap &map, const std
                             interpreter = std::make_shared<Interpreter>(interpreter_context, std::move(db_acc)),
                             result = mgp_result{memory_resource},
                             total_retries = interpreter_context->config.stream_transaction_conflict_retries,
-                            retry_interval = interpreter_context->config.stream_transaction_retry_interval](
+                            retry_interval = interpreter_context->config.stream_transaction_retry_interval,
+                            batcher = interpreter_context->config.stream_batch_queries
+                                          ? std::make_shared<QueryBatcher>(stream_name)
+                                          : nullptr](
                                const std::vector<typename TStream::Message> &messages) mutable {
     // Set interpreter's user to the stream owner
     // NOTE: We generate an empty user to avoid generating interpreter's fine grained access control and rely only on
@@ -534,38 +565,53 @@ Streams::StreamsMap::iterator Streams::CreateConsumer(StreamsMap &map, const std
     DiscardValueResultStream stream;
 
     spdlog::trace("Start transaction in stream '{}'", stream_name);
-    utils::OnScopeExit cleanup{[&interpreter, &result]() {
+    utils::OnScopeExit cleanup{[&interpreter, &result, &batcher]() {
       result.rows.clear();
+      result.batches.clear();
       interpreter->Abort();
+      if (batcher) batcher->Reset();
     }};
+    std::vector<std::pair<std::string, storage::ExternalPropertyValue>> queries;
+    queries.reserve(result.rows.size());
+    ForEachTransformationResult(result, transformation_name, stream_name,
+                                [&queries](TypedValue query_value, TypedValue params_value) {
+                                  queries.emplace_back(std::string{query_value.ValueString()},
+                                                       storage::ExternalPropertyValue{params_value});
+                                });
+
     const static storage::ExternalPropertyValue::map_t empty_parameters{};
+    auto execute = [&](const std::string &query, const storage::ExternalPropertyValue::map_t &params) {
+      spdlog::trace("Executing query '{}' in stream '{}'", query, stream_name);
+      auto prepare_result = interpreter->Prepare(query, [&](storage::Storage const *) { return params; }, {});
+      if (!owner->IsAuthorized(prepare_result.privileges, "", &up_to_date_policy)) {
+        throw StreamsException{
+            "Couldn't execute query '{}' for stream '{}' because the owner is not authorized to execute the "
+            "query!",
+            query, stream_name};
+      }
+      interpreter->PullAll(&stream);
+    };
     uint32_t i = 0;
     while (true) {
       try {
         interpreter->BeginTransaction();
-        for (auto &row : result.rows) {
-          spdlog::trace("Processing row in stream '{}'", stream_name);
-          auto [query_value, params_value] =
-              ExtractTransformationResult(row.values, result.signature, transformation_name, stream_name);
-          storage::ExternalPropertyValue params_prop{params_value};
-          std::string query{query_value.ValueString()};
-          spdlog::trace("Executing query '{}' in stream '{}'", query, stream_name);
-          auto prepare_result = interpreter->Prepare(
-              query,
-              [=](storage::Storage const *) { return params_prop.IsMap() ? params_prop.ValueMap() : empty_parameters; },
-              {});
-          if (!owner->IsAuthorized(prepare_result.privileges, "", &up_to_date_policy)) {
-            throw StreamsException{
-                "Couldn't execute query '{}' for stream '{}' because the owner is not authorized to execute the "
-                "query!",
-                query, stream_name};
+        if (batcher) {
+          if (!batcher->Execute(queries, execute)) {
+            interpreter->Abort();
+            continue;
+          }
+        } else {
+          for (const auto &[query, params] : queries) {
+            spdlog::trace("Processing row in stream '{}'", stream_name);
+            execute(query, params.IsMap() ? params.ValueMap() : empty_parameters);
           }
-          interpreter->PullAll(&stream);
         }
 
         spdlog::trace("Commit transaction in stream '{}'", stream_name);
         interpreter->CommitTransaction();
+        if (batcher) batcher->Commit();
         result.rows.clear();
+        result.batches.clear();
         break;
       } catch (const query::TransactionSerializationException &e) {
         interpreter->Abort();
@@ -836,15 +882,13 @@ TransformationResult Streams::Check(const std::string &stream_name, TDbAccess db
           auto result_row = std::vector<TypedValue>();
           result_row.reserve(kCheckStreamResultSize);
 
-          auto queries_and_parameters = std::vector<TypedValue>(result.rows.size());
-          std::transform(
-              result.rows.cbegin(), result.rows.cend(), queries_and_parameters.begin(), [&](const auto &row) {
-                auto [query, parameters] =
-                    ExtractTransformationResult(row.values, result.signature, transformation_name, stream_name);
-
-                return std::map<std::string, TypedValue>{{"query", std::move(query)},
-                                                         {"parameters", std::move(parameters)}};
-              });
+          auto queries_and_parameters = std::vector<TypedValue>();
+          queries_and_parameters.reserve(result.rows.size());
+          ForEachTransformationResult(result, transformation_name, stream_name,
+                                      [&queries_and_parameters](TypedValue query, TypedValue parameters) {
+                                        queries_and_parameters.emplace_back(std::map<std::string, TypedValue>{
+                                            {"query", std::move(query)}, {"parameters", std::move(parameters)}});
+                                      });
           result_row.emplace_back(std::move(queries_and_parameters));
 
           auto messages_list = std::vector<TypedValue>(messages.size());
@@ -11,15 +11,22 @@
 
 #include "query/time_to_live/time_to_live.hpp"
 
+#include <algorithm>
 #include <chrono>
+#include <limits>
 #include <memory>
 #include <optional>
+#include <string>
 #include <thread>
+#include <utility>
+#include <vector>
 
 #include "query/discard_value_stream.hpp"
 #include "query/interpreter.hpp"
 #include "query/interpreter_context.hpp"
 #include "query/typed_value.hpp"
+#include "utils/event_counter.hpp"
+#include "utils/event_histogram.hpp"
 #include "utils/logging.hpp"
 #include "utils/temporal.hpp"
 
@@ -28,6 +35,7 @@
 namespace memgraph::metrics {
 extern const Event DeletedNodes;
 extern const Event DeletedEdges;
+extern const Event ExpiryLag_us;
 }  // namespace memgraph::metrics
 
 namespace {
@@ -37,6 +45,13 @@ int GetPart(auto &current) {
   current -= T{whole_part};
   return whole_part;
 }
+
+// Keeps the row returned by a TTL batch query: the smallest and the largest ttl of the deleted objects.
+struct TtlBatchResultStream final {
+  void Result(const std::vector<memgraph::query::TypedValue> &values) { row = values; }
+
+  std::vector<memgraph::query::TypedValue> row;
+};
 }  // namespace
 
 namespace memgraph::query::ttl {
@@ -68,13 +83,24 @@ void TTL::Setup_(TDbAccess db_acc, InterpreterContext *interpreter_context, cons
                                                         // register new interpreter into interpreter_context
   interpreter_context->interpreters->insert(interpreter.get());
 
-  auto TTL = [interpreter = std::move(interpreter), should_run_edge_ttl]() {
-    memgraph::query::DiscardValueResultStream result_stream;
+  // On disk the index scans aren't ordered by ttl, but deleted objects don't linger in them either
+  const bool resume_batches = db_acc->GetStorageMode() != storage::StorageMode::ON_DISK_TRANSACTIONAL;
+
+  auto TTL = [interpreter = std::move(interpreter), should_run_edge_ttl, resume_batches]() {
+    TtlBatchResultStream result_stream;
     bool finished_vertex = false;
     bool finished_edge = !should_run_edge_ttl;
     // Using microseconds to be aligned with timestamp() query, could just use seconds
     const auto now = std::chrono::system_clock::now();
     const auto now_us = std::chrono::duration_cast<std::chrono::microseconds>(now.time_since_epoch());
+    // Batches delete objects in the order of the ttl index. Each batch continues from the largest ttl deleted by the
+    // previous one, so it doesn't have to skip over the index entries of objects which were deleted by the previous
+    // batches but not yet garbage collected. Both indices are ordered by ttl, so nothing smaller than that ttl is left
+    // behind; an ORDER BY would sort every expired object just to take one batch. The vertex batch forces the :TTL(ttl)
+    // index, the edge batch can only use the global ttl edge index.
+    int64_t vertex_from = std::numeric_limits<int64_t>::min();
+    int64_t edge_from = std::numeric_limits<int64_t>::min();
+    std::optional<int64_t> oldest_deleted;
 
     auto get_value = [](auto map, std::string_view key) {
       int64_t n = 0;
@@ -87,39 +113,53 @@ void TTL::Setup_(TDbAccess db_acc, InterpreterContext *interpreter_context, cons
       return n;
     };
 
+    auto run_batch = [&](std::string_view query, int64_t from) {
+      result_stream.row.clear();
+      auto prepare_result = interpreter->Prepare(std::string{query},
+                                                 [now_us, from](auto) {
+                                                   UserParameters params;
+                                                   params.emplace("now", now_us.count());
+                                                   params.emplace("from", from);
+                                                   params.emplace("batch", kBatchSize);
+                                                   return params;
+                                                 },
+                                                 {});
+      return interpreter->PullAll(&result_stream);
+    };
+
+    // The smallest and the largest deleted ttl, if the batch deleted anything
+    auto deleted_range = [&]() -> std::optional<std::pair<int64_t, int64_t>> {
+      if (result_stream.row.size() != 2 || !result_stream.row[0].IsInt() || !result_stream.row[1].IsInt()) {
+        return std::nullopt;
+      }
+      return std::pair{result_stream.row[0].ValueInt(), result_stream.row[1].ValueInt()};
+    };
+
     spdlog::trace("Running TTL at {}", now);
     while (!finished_vertex || !finished_edge) {
       try {
         int n_deleted = 0;
         int n_edges_deleted = 0;
+        const bool vertex_batch = !finished_vertex;
+        std::optional<std::pair<int64_t, int64_t>> deleted;
         interpreter->BeginTransaction();
         // First run vertex TTL as that might already delete edges scheduled to be deleted by the edge TTL
-        if (!finished_vertex) {
-          auto prepare_result =
-              interpreter->Prepare("MATCH (n:TTL) WHERE n.ttl < $now WITH n LIMIT $batch DETACH DELETE n;",
-                                   [now_us](auto) {
-                                     UserParameters params;
-                                     params.emplace("now", now_us.count());
-                                     params.emplace("batch", 10000);
-                                     return params;
-                                   },
-                                   {});
-          const auto pull_res = interpreter->PullAll(&result_stream);
+        if (vertex_batch) {
+          const auto pull_res = run_batch(
+              "USING INDEX :TTL(ttl) MATCH (n:TTL) WHERE n.ttl >= $from AND n.ttl < $now WITH n, n.ttl AS ttl "
+              "LIMIT $batch DETACH DELETE n RETURN min(ttl), max(ttl);",
+              vertex_from);
           n_deleted = get_value(pull_res, "nodes-deleted");
           n_edges_deleted = get_value(pull_res, "relationships-deleted");
+          deleted = deleted_range();
           finished_vertex = !pull_res.at("has_more").ValueBool() && n_deleted == 0;
         } else if (!finished_edge) {
-          auto prepare_result =
-              interpreter->Prepare("MATCH ()-[e]->() WHERE e.ttl < $now WITH e LIMIT $batch DETACH DELETE e;",
-                                   [now_us](auto) {
-                                     UserParameters params;
-                                     params.emplace("now", now_us.count());
-                                     params.emplace("batch", 10000);
-                                     return params;
-                                   },
-                                   {});
-          const auto pull_res = interpreter->PullAll(&result_stream);
+          const auto pull_res = run_batch(
+              "MATCH ()-[e]->() WHERE e.ttl >= $from AND e.ttl < $now WITH e, e.ttl AS ttl LIMIT $batch "
+              "DETACH DELETE e RETURN min(ttl), max(ttl);",
+              edge_from);
           n_edges_deleted = get_value(pull_res, "relationships-deleted");
+          deleted = deleted_range();
           finished_edge = !pull_res.at("has_more").ValueBool() && n_edges_deleted == 0;
         } else {
           DMG_ASSERT(false, "Unsupported TTL state.");
@@ -127,6 +167,11 @@ void TTL::Setup_(TDbAccess db_acc, InterpreterContext *interpreter_context, cons
         spdlog::trace("Committing TTL batch transaction");
         interpreter->CommitTransaction();
         spdlog::trace("Committed TTL batch deleted {} vertices and {} edges", n_deleted, n_edges_deleted);
+        // Only move on once the batch is committed, an aborted batch has to be retried from the same ttl
+        if (deleted) {
+          if (resume_batches) (vertex_batch ? vertex_from : edge_from) = deleted->second;
+          oldest_deleted = std::min(oldest_deleted.value_or(deleted->first), deleted->first);
+        }
         // Telemetry
         memgraph::metrics::IncrementCounter(memgraph::metrics::DeletedNodes, n_deleted);
         memgraph::metrics::IncrementCounter(memgraph::metrics::DeletedEdges, n_edges_deleted);
@@ -155,6 +200,13 @@ void TTL::Setup_(TDbAccess db_acc, InterpreterContext *interpreter_context, cons
       }
       std::this_thread::yield();
     }
+    if (oldest_deleted) {
+      // How long the longest expired object stayed in the graph
+      const auto finished_us =
+          std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch());
+      memgraph::metrics::Measure(memgraph::metrics::ExpiryLag_us,
+                                 std::max<int64_t>(finished_us.count() - *oldest_deleted, 0));
+    }
     spdlog::trace("Finished TTL run from {}", now);
   };
 
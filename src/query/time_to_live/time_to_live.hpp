@@ -119,6 +119,9 @@ inline bool operator==(const TtlInfo &lhs, const TtlInfo &rhs) {
  */
 class TTL final {
  public:
+  // Number of objects deleted by a single batch transaction
+  static constexpr int64_t kBatchSize = 10000;
+
   explicit TTL(std::filesystem::path directory) : storage_{directory} {}
 
   ~TTL() = default;
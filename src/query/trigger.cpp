@@ -11,6 +11,9 @@
 
 #include "query/trigger.hpp"
 
+#include <algorithm>
+#include <limits>
+
 #include "query/config.hpp"
 #include "query/context.hpp"
 #include "query/cypher_query_interpreter.hpp"
@@ -23,8 +26,16 @@
 #include "query/typed_value.hpp"
 #include "storage/v2/property_value.hpp"
 #include "utils/event_counter.hpp"
+#include "utils/flag_validation.hpp"
 #include "utils/memory.hpp"
 
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(trigger_after_commit_batch_size, 1,
+                        "Maximum number of committed transactions whose changes are passed to a single run of the "
+                        "AFTER COMMIT triggers. Transactions that commit while the triggers are running are "
+                        "coalesced into the next run. 1 runs the triggers once per transaction.",
+                        FLAG_IN_RANGE(1, std::numeric_limits<uint64_t>::max()));
+
 namespace memgraph::metrics {
 extern const Event TriggersExecuted;
 }  // namespace memgraph::metrics
@@ -471,4 +482,18 @@ std::unordered_set<TriggerEventType> TriggerStore::GetEventTypes() const {
   add_event_types(after_commit_triggers_);
   return event_types;
 }
+
+void AfterCommitTriggerBatch::Push(TriggerContext context, std::shared_ptr<storage::Storage::Accessor> transaction) {
+  auto guard = std::lock_guard{lock_};
+  pending_.push_back({std::move(context), std::move(transaction)});
+}
+
+std::vector<AfterCommitTriggerBatch::Entry> AfterCommitTriggerBatch::Pop(const size_t max_size) {
+  auto guard = std::lock_guard{lock_};
+  const auto count = std::min(max_size, pending_.size());
+  const auto end = pending_.begin() + static_cast<std::ptrdiff_t>(count);
+  std::vector<Entry> batch(std::make_move_iterator(pending_.begin()), std::make_move_iterator(end));
+  pending_.erase(pending_.begin(), end);
+  return batch;
+}
 }  // namespace memgraph::query
@@ -12,12 +12,15 @@
 #pragma once
 
 #include <atomic>
+#include <deque>
 #include <filesystem>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include <gflags/gflags.h>
+
 #include "kvstore/kvstore.hpp"
 #include "query/auth_checker.hpp"
 #include "query/config.hpp"
@@ -25,8 +28,13 @@
 #include "query/database_access.hpp"
 #include "query/trigger_context.hpp"
 #include "storage/v2/property_value.hpp"
+#include "storage/v2/storage.hpp"
 #include "utils/rw_spin_lock.hpp"
 #include "utils/skip_list.hpp"
+#include "utils/spin_lock.hpp"
+
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DECLARE_uint64(trigger_after_commit_batch_size);
 
 namespace memgraph::query {
 
@@ -119,4 +127,25 @@ struct TriggerStore {
   utils::SkipList<Trigger> after_commit_triggers_;
 };
 
+// Committed transactions waiting for their AFTER COMMIT triggers. Each commit pushes its context and schedules a
+// task on the after commit pool; whichever task runs first takes everything pending (up to the batch size), so
+// the triggers run once for all transactions that committed while the pool was busy.
+class AfterCommitTriggerBatch {
+ public:
+  struct Entry {
+    TriggerContext context;
+    // Kept alive until the triggers ran, as the context still references objects of the user transaction
+    std::shared_ptr<storage::Storage::Accessor> transaction;
+  };
+
+  void Push(TriggerContext context, std::shared_ptr<storage::Storage::Accessor> transaction);
+
+  // Takes at most max_size pending entries, in the order they were pushed
+  std::vector<Entry> Pop(size_t max_size);
+
+ private:
+  utils::SpinLock lock_;
+  std::deque<Entry> pending_;
+};
+
 }  // namespace memgraph::query
@@ -345,6 +345,28 @@ void TriggerContext::AdaptForAccessor(DbAccessor *accessor) {
   adapt_context_with_edge(&removed_edge_properties_);
 }
 
+void TriggerContext::Merge(TriggerContext &&other) {
+  const auto append = [](auto *values, auto &&other_values) {
+    if (values->empty()) {
+      *values = std::move(other_values);
+      return;
+    }
+    values->insert(values->end(), std::make_move_iterator(other_values.begin()),
+                   std::make_move_iterator(other_values.end()));
+  };
+
+  append(&created_vertices_, std::move(other.created_vertices_));
+  append(&deleted_vertices_, std::move(other.deleted_vertices_));
+  append(&set_vertex_properties_, std::move(other.set_vertex_properties_));
+  append(&removed_vertex_properties_, std::move(other.removed_vertex_properties_));
+  append(&set_vertex_labels_, std::move(other.set_vertex_labels_));
+  append(&removed_vertex_labels_, std::move(other.removed_vertex_labels_));
+  append(&created_edges_, std::move(other.created_edges_));
+  append(&deleted_edges_, std::move(other.deleted_edges_));
+  append(&set_edge_properties_, std::move(other.set_edge_properties_));
+  append(&removed_edge_properties_, std::move(other.removed_edge_properties_));
+}
+
 TypedValue TriggerContext::GetTypedValue(const TriggerIdentifierTag tag, DbAccessor *dba) const {
   switch (tag) {
     case TriggerIdentifierTag::CREATED_VERTICES:
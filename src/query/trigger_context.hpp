@@ -1,4 +1,4 @@
-// Copyright 2024 Memgraph Ltd.
+// Copyright 2026 Memgraph Ltd.
 //
 // Use of this software is governed by the Business Source License
 // included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -195,6 +195,11 @@ class TriggerContext {
   // to the sent DbAccessor so they can be used safely)
   void AdaptForAccessor(DbAccessor *accessor);
 
+  // Append the changes of a later transaction. Changes are not folded together, so an object created by one
+  // transaction and updated by another is reported as both created and updated. An object created by one transaction
+  // and deleted by another is reported only as deleted, because AdaptForAccessor drops objects that no longer exist.
+  void Merge(TriggerContext &&other);
+
   // Get TypedValue for the identifier defined with tag
   TypedValue GetTypedValue(TriggerIdentifierTag tag, DbAccessor *dba) const;
   bool ShouldEventTrigger(TriggerEventType) const;
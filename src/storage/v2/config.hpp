@@ -81,6 +81,8 @@ struct Config {
     memgraph::utils::SchedulerInterval snapshot_interval{
         std::chrono::minutes(2)};          // PER DATABASE - as at time of initialization; can be changed by user
     uint64_t snapshot_retention_count{3};  // PER DATABASE
+    // Number of incremental snapshots written between two full snapshots (0 - only full snapshots)
+    uint64_t snapshot_incremental_layers{0};  // PER DATABASE
 
     uint64_t wal_file_size_kibibytes{20 * 1024};  // PER DATABASE
     uint64_t wal_file_flush_every_n_tx{100000};   // PER DATABASE
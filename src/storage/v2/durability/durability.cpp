@@ -27,6 +27,7 @@
 #include "replication/epoch.hpp"
 #include "storage/v2/constraints/type_constraints_kind.hpp"
 #include "storage/v2/durability/durability.hpp"
+#include "storage/v2/durability/incremental_snapshot.hpp"
 #include "storage/v2/durability/metadata.hpp"
 #include "storage/v2/durability/snapshot.hpp"
 #include "storage/v2/durability/wal.hpp"
@@ -453,6 +454,26 @@ std::optional<RecoveryInfo> Recovery::RecoverData(
   RecoveryInfo recovery_info;
   RecoveredIndicesAndConstraints indices_constraints;
   std::optional<uint64_t> snapshot_timestamp;
+
+  auto regenerate_vertex_batches = [&] {
+    // TODO edges?
+    size_t pos = 0;
+    size_t batched = 0;
+    recovery_info.vertex_batches.clear();
+    auto v_acc = vertices->access();
+    const auto size = v_acc.size();
+    for (auto v_itr = v_acc.begin(); v_itr != v_acc.end(); ++v_itr, ++pos) {
+      if (pos == batched) {
+        const auto left = size - pos;
+        if (left <= config.durability.items_per_batch) {
+          recovery_info.vertex_batches.emplace_back(v_itr->gid, left);
+          break;
+        }
+        recovery_info.vertex_batches.emplace_back(v_itr->gid, config.durability.items_per_batch);
+        batched += config.durability.items_per_batch;
+      }
+    }
+  };
   if (!snapshot_files.empty()) {
     spdlog::info("Try recovering from snapshot directory {}.", wal_directory_);
 
@@ -489,6 +510,39 @@ std::optional<RecoveryInfo> Recovery::RecoverData(
     snapshot_timestamp = recovered_snapshot->snapshot_info.durable_timestamp;
     spdlog::trace("Recovered epoch {} for db {}", recovered_snapshot->snapshot_info.epoch_id, db_name);
     repl_storage_state.epoch_.SetEpoch(std::move(recovered_snapshot->snapshot_info.epoch_id));
+
+    // Apply the incremental snapshots written on top of the recovered one. They modify the data in place, so a
+    // failure can't fall back to the next snapshot anymore.
+    auto const layers = GetIncrementalSnapshotChain(snapshot_directory_, last_snapshot_uuid_str, *snapshot_timestamp);
+    for (const auto &[layer_path, layer_info] : layers) {
+      spdlog::info("Applying incremental snapshot {}.", layer_path);
+      try {
+        auto const layer_recovery_info = LoadIncrementalSnapshot(layer_path, vertices, edges, edges_metadata,
+                                                                 name_id_mapper, edge_count, config.salient.items);
+        recovery_info.next_vertex_id = std::max(recovery_info.next_vertex_id, layer_recovery_info.next_vertex_id);
+        recovery_info.next_edge_id = std::max(recovery_info.next_edge_id, layer_recovery_info.next_edge_id);
+        recovery_info.next_timestamp = std::max(recovery_info.next_timestamp, layer_recovery_info.next_timestamp);
+      } catch (const RecoveryFailure &e) {
+        LOG_FATAL("Couldn't apply incremental snapshot {} because of: {}", layer_path, e.what());
+      }
+      snapshot_timestamp = layer_info.durable_timestamp;
+    }
+    if (!layers.empty()) {
+      spdlog::info("Applied {} incremental snapshots.", layers.size());
+      regenerate_vertex_batches();
+      if (schema_info) {
+        schema_info->Clear();
+        auto v_acc = vertices->access();
+        for (auto &vertex : v_acc) {
+          schema_info->RecoverVertex(&vertex);
+        }
+        for (auto &vertex : v_acc) {
+          for (auto const &[edge_type, to_vertex, edge_ref] : vertex.out_edges) {
+            schema_info->RecoverEdge(edge_type, edge_ref, &vertex, to_vertex, config.salient.items.properties_on_edges);
+          }
+        }
+      }
+    }
     recovery_info.last_durable_timestamp = snapshot_timestamp;
   } else {
     // UUID couldn't be recovered from the snapshot; recovering it from WALs
@@ -620,23 +674,7 @@ std::optional<RecoveryInfo> Recovery::RecoverData(
     spdlog::info("All necessary WAL files are loaded successfully.");
 
     // Regenerate the vertex batches
-    // TODO edges?
-    size_t pos = 0;
-    size_t batched = 0;
-    recovery_info.vertex_batches.clear();
-    auto v_acc = vertices->access();
-    const auto size = v_acc.size();
-    for (auto v_itr = v_acc.begin(); v_itr != v_acc.end(); ++v_itr, ++pos) {
-      if (pos == batched) {
-        const auto left = size - pos;
-        if (left <= config.durability.items_per_batch) {
-          recovery_info.vertex_batches.emplace_back(v_itr->gid, left);
-          break;
-        }
-        recovery_info.vertex_batches.emplace_back(v_itr->gid, config.durability.items_per_batch);
-        batched += config.durability.items_per_batch;
-      }
-    }
+    regenerate_vertex_batches();
   }
 
   // Apply meta structures now after all graph data has been loaded
@@ -0,0 +1,698 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/durability/incremental_snapshot.hpp"
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "spdlog/spdlog.h"
+#include "storage/v2/durability/exceptions.hpp"
+#include "storage/v2/durability/marker.hpp"
+#include "storage/v2/durability/paths.hpp"
+#include "storage/v2/durability/serialization.hpp"
+#include "storage/v2/durability/version.hpp"
+#include "storage/v2/edge_accessor.hpp"
+#include "storage/v2/fmt.hpp"
+#include "storage/v2/mvcc.hpp"
+#include "storage/v2/property_value.hpp"
+#include "storage/v2/storage.hpp"
+#include "storage/v2/vertex_accessor.hpp"
+#include "utils/counter.hpp"
+#include "utils/file.hpp"
+#include "utils/logging.hpp"
+#include "utils/message.hpp"
+#include "utils/on_scope_exit.hpp"
+#include "utils/timer.hpp"
+
+using namespace std::chrono_literals;
+namespace {
+constexpr auto kCheckIfSnapshotAborted = 3s;
+}  // namespace
+
+namespace memgraph::storage::durability {
+
+// Incremental snapshot format:
+//
+// 1) Magic string (non-encoded)
+//
+// 2) Snapshot version (non-encoded, little-endian)
+//
+// 3) Section offsets:
+//     * offset to the first edge (`0` if properties on edges are disabled)
+//     * offset to the first vertex
+//     * offset to the deleted objects section
+//     * offset to the mapper section
+//     * offset to the metadata section
+//
+// 4) Encoded modified edges, same as in the full snapshot
+//
+// 5) Encoded modified vertices, same as in the full snapshot
+//
+// 6) Deleted objects:
+//     * number of deleted vertices, followed by their gids
+//     * number of deleted edges, followed by their gids
+//
+// 7) Name to ID mapper data, same as in the full snapshot
+//
+// 8) Metadata:
+//     * storage UUID
+//     * epoch id
+//     * durable timestamp of the snapshot this one is applied on top of
+//     * start timestamp of the transaction that created the snapshot
+//     * durable timestamp
+//     * number of edges
+//     * number of vertices
+
+IncrementalSnapshotInfo ReadIncrementalSnapshotInfo(const std::filesystem::path &path) {
+  // Check magic and version.
+  Decoder snapshot;
+  auto version = snapshot.Initialize(path, kIncrementalSnapshotMagic);
+  if (!version) throw RecoveryFailure("Couldn't read incremental snapshot magic and/or version!");
+  if (!IsVersionSupported(*version)) throw RecoveryFailure("Invalid incremental snapshot version!");
+
+  // Prepare return value.
+  IncrementalSnapshotInfo info;
+
+  // Read offsets.
+  {
+    auto marker = snapshot.ReadMarker();
+    if (!marker || *marker != Marker::SECTION_OFFSETS)
+      throw RecoveryFailure("Couldn't read marker for section offsets!");
+
+    auto snapshot_size = snapshot.GetSize();
+    if (!snapshot_size) throw RecoveryFailure("Couldn't read incremental snapshot size!");
+
+    auto read_offset = [&snapshot, snapshot_size] {
+      auto maybe_offset = snapshot.ReadUint();
+      if (!maybe_offset) throw RecoveryFailure("Invalid incremental snapshot format!");
+      auto offset = *maybe_offset;
+      if (offset > *snapshot_size) throw RecoveryFailure("Invalid incremental snapshot format!");
+      return offset;
+    };
+
+    info.offset_edges = read_offset();
+    info.offset_vertices = read_offset();
+    info.offset_deleted = read_offset();
+    info.offset_mapper = read_offset();
+    info.offset_metadata = read_offset();
+  }
+
+  // Read metadata.
+  {
+    if (!snapshot.SetPosition(info.offset_metadata)) throw RecoveryFailure("Couldn't read metadata offset!");
+
+    auto marker = snapshot.ReadMarker();
+    if (!marker || *marker != Marker::SECTION_METADATA)
+      throw RecoveryFailure("Couldn't read marker for section metadata!");
+
+    auto maybe_uuid = snapshot.ReadString();
+    if (!maybe_uuid) throw RecoveryFailure("Couldn't read storage_uuid!");
+    info.uuid = std::move(*maybe_uuid);
+
+    auto maybe_epoch_id = snapshot.ReadString();
+    if (!maybe_epoch_id) throw RecoveryFailure("Couldn't read epoch id!");
+    info.epoch_id = std::move(*maybe_epoch_id);
+
+    auto maybe_base_timestamp = snapshot.ReadUint();
+    if (!maybe_base_timestamp) throw RecoveryFailure("Couldn't read base timestamp!");
+    info.base_timestamp = *maybe_base_timestamp;
+
+    auto maybe_timestamp = snapshot.ReadUint();
+    if (!maybe_timestamp) throw RecoveryFailure("Couldn't read start timestamp!");
+    info.start_timestamp = *maybe_timestamp;
+
+    auto maybe_durable_timestamp = snapshot.ReadUint();
+    if (!maybe_durable_timestamp) throw RecoveryFailure("Couldn't read durable timestamp!");
+    info.durable_timestamp = *maybe_durable_timestamp;
+
+    auto maybe_edges = snapshot.ReadUint();
+    if (!maybe_edges) throw RecoveryFailure("Couldn't read the number of edges!");
+    info.edges_count = *maybe_edges;
+
+    auto maybe_vertices = snapshot.ReadUint();
+    if (!maybe_vertices) throw RecoveryFailure("Couldn't read the number of vertices!");
+    info.vertices_count = *maybe_vertices;
+  }
+
+  return info;
+}
+
+std::vector<std::pair<std::filesystem::path, IncrementalSnapshotInfo>> GetIncrementalSnapshotChain(
+    const std::filesystem::path &snapshot_directory, std::string_view uuid, uint64_t base_timestamp) {
+  std::vector<std::pair<std::filesystem::path, IncrementalSnapshotInfo>> chain;
+  auto const directory = IncrementalSnapshotDirectory(snapshot_directory);
+  if (!utils::DirExists(directory)) return chain;
+
+  // base timestamp -> layer with the highest durable timestamp built on top of it
+  std::map<uint64_t, std::pair<std::filesystem::path, IncrementalSnapshotInfo>> layers;
+  std::error_code error_code;
+  for (const auto &item : std::filesystem::directory_iterator(directory, error_code)) {
+    if (!item.is_regular_file()) continue;
+    try {
+      auto info = ReadIncrementalSnapshotInfo(item.path());
+      if (info.uuid != uuid || info.durable_timestamp <= info.base_timestamp) continue;
+      auto [it, inserted] = layers.try_emplace(info.base_timestamp, item.path(), info);
+      if (!inserted && it->second.second.durable_timestamp < info.durable_timestamp) {
+        it->second = {item.path(), std::move(info)};
+      }
+    } catch (const RecoveryFailure &e) {
+      spdlog::warn("Incremental snapshot file {} isn't a valid incremental snapshot because of: {}.", item.path(),
+                   e.what());
+    }
+  }
+  if (error_code) {
+    spdlog::warn("Couldn't read the incremental snapshot directory {} because of: {}.", directory,
+                 error_code.message());
+    return chain;
+  }
+
+  for (auto it = layers.find(base_timestamp); it != layers.end(); it = layers.find(base_timestamp)) {
+    base_timestamp = it->second.second.durable_timestamp;
+    chain.emplace_back(std::move(it->second));
+    layers.erase(it);
+  }
+  return chain;
+}
+
+RecoveryInfo LoadIncrementalSnapshot(const std::filesystem::path &path, utils::SkipList<Vertex> *vertices,
+                                     utils::SkipList<Edge> *edges, utils::SkipList<EdgeMetadata> *edges_metadata,
+                                     NameIdMapper *name_id_mapper, std::atomic<uint64_t> *edge_count,
+                                     SalientConfig::Items items) {
+  Decoder snapshot;
+  auto version = snapshot.Initialize(path, kIncrementalSnapshotMagic);
+  if (!version) throw RecoveryFailure("Couldn't read incremental snapshot magic and/or version!");
+  if (!IsVersionSupported(*version)) throw RecoveryFailure("Invalid incremental snapshot version!");
+
+  const auto info = ReadIncrementalSnapshotInfo(path);
+  spdlog::info("Applying {} modified vertices and {} modified edges.", info.vertices_count, info.edges_count);
+  bool const snapshot_has_edges = info.offset_edges != 0;
+
+  RecoveryInfo recovery_info;
+  uint64_t highest_vertex_gid{0};
+  uint64_t highest_edge_gid{0};
+  // Edges are counted through the out edges of their from vertex
+  int64_t edge_count_diff{0};
+
+  // Recover mapper.
+  std::unordered_map<uint64_t, uint64_t> snapshot_id_map;
+  {
+    if (!snapshot.SetPosition(info.offset_mapper)) throw RecoveryFailure("Couldn't read data from snapshot!");
+
+    auto marker = snapshot.ReadMarker();
+    if (!marker || *marker != Marker::SECTION_MAPPER) throw RecoveryFailure("Failed to read section mapper!");
+
+    auto size = snapshot.ReadUint();
+    if (!size) throw RecoveryFailure("Failed to read name-id mapper size!");
+
+    for (uint64_t i = 0; i < *size; ++i) {
+      auto id = snapshot.ReadUint();
+      if (!id) throw RecoveryFailure("Failed to read id for name-id mapper!");
+      auto name = snapshot.ReadString();
+      if (!name) throw RecoveryFailure("Failed to read name for name-id mapper!");
+      snapshot_id_map.emplace(*id, name_id_mapper->NameToId(*name));
+    }
+  }
+  auto get_id = [&snapshot_id_map](uint64_t snapshot_id) {
+    auto it = snapshot_id_map.find(snapshot_id);
+    if (it == snapshot_id_map.end()) throw RecoveryFailure("Couldn't find id in snapshot_id_map!");
+    return it->second;
+  };
+
+  std::vector<std::pair<PropertyId, PropertyValue>> read_properties;
+  auto read_properties_into = [&](PropertyStore &props) {
+    auto props_size = snapshot.ReadUint();
+    if (!props_size) throw RecoveryFailure("Couldn't read the number of properties!");
+    read_properties.clear();
+    read_properties.reserve(*props_size);
+    for (uint64_t j = 0; j < *props_size; ++j) {
+      auto key = snapshot.ReadUint();
+      if (!key) throw RecoveryFailure("Couldn't read property id!");
+      auto value = snapshot.ReadExternalPropertyValue();
+      if (!value) throw RecoveryFailure("Couldn't read property value!");
+      read_properties.emplace_back(PropertyId::FromUint(get_id(*key)), ToPropertyValue(*value, name_id_mapper));
+    }
+    props.ClearProperties();
+    if (!read_properties.empty()) props.InitProperties(std::move(read_properties));
+  };
+
+  auto vertex_acc = vertices->access();
+  auto edge_acc = edges->access();
+  auto edge_metadata_acc = edges_metadata->access();
+
+  // Recover modified edges.
+  if (snapshot_has_edges) {
+    if (!snapshot.SetPosition(info.offset_edges)) throw RecoveryFailure("Couldn't read data from snapshot!");
+    for (uint64_t i = 0; i < info.edges_count; ++i) {
+      auto marker = snapshot.ReadMarker();
+      if (!marker || *marker != Marker::SECTION_EDGE) throw RecoveryFailure("Couldn't read section edge marker!");
+      auto gid = snapshot.ReadUint();
+      if (!gid) throw RecoveryFailure("Failed to read edge gid!");
+      highest_edge_gid = std::max(highest_edge_gid, *gid);
+
+      if (items.properties_on_edges) {
+        auto [it, _] = edge_acc.insert(Edge{Gid::FromUint(*gid), nullptr});
+        read_properties_into(it->properties);
+      } else {
+        auto props_size = snapshot.ReadUint();
+        if (!props_size) throw RecoveryFailure("Couldn't read size of edge properties!");
+        if (*props_size != 0)
+          throw RecoveryFailure(
+              "The snapshot has properties on edges, but the storage is "
+              "configured without properties on edges!");
+      }
+    }
+  }
+
+  // Recover modified vertices. Their connectivity is restored once all of them exist.
+  struct VertexConnectivity {
+    Vertex *vertex;
+    std::vector<std::tuple<uint64_t, uint64_t, uint64_t>> in_edges;
+    std::vector<std::tuple<uint64_t, uint64_t, uint64_t>> out_edges;
+  };
+  std::vector<VertexConnectivity> connectivity;
+  connectivity.reserve(info.vertices_count);
+  {
+    if (!snapshot.SetPosition(info.offset_vertices)) throw RecoveryFailure("Couldn't read data from snapshot!");
+    auto read_edges = [&snapshot](auto &out) {
+      auto size = snapshot.ReadUint();
+      if (!size) throw RecoveryFailure("Couldn't read the number of edges!");
+      out.reserve(*size);
+      for (uint64_t j = 0; j < *size; ++j) {
+        auto edge_gid = snapshot.ReadUint();
+        if (!edge_gid) throw RecoveryFailure("Couldn't read edge gid!");
+        auto vertex_gid = snapshot.ReadUint();
+        if (!vertex_gid) throw RecoveryFailure("Couldn't read vertex gid!");
+        auto edge_type = snapshot.ReadUint();
+        if (!edge_type) throw RecoveryFailure("Couldn't read edge type!");
+        out.emplace_back(*edge_gid, *vertex_gid, *edge_type);
+      }
+    };
+
+    for (uint64_t i = 0; i < info.vertices_count; ++i) {
+      auto marker = snapshot.ReadMarker();
+      if (!marker || *marker != Marker::SECTION_VERTEX) throw RecoveryFailure("Couldn't read section vertex marker!");
+      auto gid = snapshot.ReadUint();
+      if (!gid) throw RecoveryFailure("Couldn't read vertex gid!");
+      highest_vertex_gid = std::max(highest_vertex_gid, *gid);
+
+      auto [it, inserted] = vertex_acc.insert(Vertex{Gid::FromUint(*gid), nullptr});
+      if (!inserted) edge_count_diff -= static_cast<int64_t>(it->out_edges.size());
+
+      auto labels_size = snapshot.ReadUint();
+      if (!labels_size) throw RecoveryFailure("Couldn't read the size of vertex labels!");
+      it->labels.clear();
+      it->labels.reserve(*labels_size);
+      for (uint64_t j = 0; j < *labels_size; ++j) {
+        auto label = snapshot.ReadUint();
+        if (!label) throw RecoveryFailure("Couldn't read vertex label!");
+        it->labels.emplace_back(LabelId::FromUint(get_id(*label)));
+      }
+
+      read_properties_into(it->properties);
+
+      auto &vertex_connectivity = connectivity.emplace_back(VertexConnectivity{.vertex = &*it});
+      read_edges(vertex_connectivity.in_edges);
+      read_edges(vertex_connectivity.out_edges);
+    }
+  }
+
+  // Read deleted objects.
+  std::vector<Gid> deleted_vertices;
+  std::vector<Gid> deleted_edges;
+  {
+    if (!snapshot.SetPosition(info.offset_deleted)) throw RecoveryFailure("Couldn't read data from snapshot!");
+    auto marker = snapshot.ReadMarker();
+    if (!marker || *marker != Marker::SECTION_DELETED) throw RecoveryFailure("Couldn't read section deleted marker!");
+    auto read_gids = [&snapshot](auto &out) {
+      auto size = snapshot.ReadUint();
+      if (!size) throw RecoveryFailure("Couldn't read the number of deleted objects!");
+      out.reserve(*size);
+      for (uint64_t j = 0; j < *size; ++j) {
+        auto gid = snapshot.ReadUint();
+        if (!gid) throw RecoveryFailure("Couldn't read deleted object gid!");
+        out.emplace_back(Gid::FromUint(*gid));
+      }
+    };
+    read_gids(deleted_vertices);
+    read_gids(deleted_edges);
+  }
+
+  // Restore connectivity of the modified vertices. Every edge change modifies both of its vertices, so the edges of
+  // the untouched vertices are still valid.
+  for (auto &[vertex, in_edges, out_edges] : connectivity) {
+    auto get_edge_ref = [&](uint64_t edge_gid) {
+      highest_edge_gid = std::max(highest_edge_gid, edge_gid);
+      EdgeRef edge_ref(Gid::FromUint(edge_gid));
+      if (items.properties_on_edges) {
+        if (snapshot_has_edges) {
+          auto edge = edge_acc.find(Gid::FromUint(edge_gid));
+          if (edge == edge_acc.end()) throw RecoveryFailure("Couldn't find edge in the loaded edges!");
+          edge_ref = EdgeRef(&*edge);
+        } else {
+          auto [edge, _] = edge_acc.insert(Edge{Gid::FromUint(edge_gid), nullptr});
+          edge_ref = EdgeRef(&*edge);
+        }
+      }
+      return edge_ref;
+    };
+    auto get_vertex = [&](uint64_t vertex_gid) {
+      auto other = vertex_acc.find(Gid::FromUint(vertex_gid));
+      if (other == vertex_acc.end()) throw RecoveryFailure("Couldn't find vertex in loaded vertices!");
+      return &*other;
+    };
+
+    vertex->in_edges.clear();
+    vertex->in_edges.reserve(in_edges.size());
+    for (auto const &[edge_gid, from_gid, edge_type] : in_edges) {
+      vertex->in_edges.emplace_back(EdgeTypeId::FromUint(get_id(edge_type)), get_vertex(from_gid),
+                                    get_edge_ref(edge_gid));
+    }
+
+    vertex->out_edges.clear();
+    vertex->out_edges.reserve(out_edges.size());
+    for (auto const &[edge_gid, to_gid, edge_type] : out_edges) {
+      auto edge_ref = get_edge_ref(edge_gid);
+      if (items.properties_on_edges && items.enable_edges_metadata) {
+        auto [it, inserted] = edge_metadata_acc.insert(EdgeMetadata{Gid::FromUint(edge_gid), vertex});
+        if (!inserted) it->from_vertex = vertex;
+      }
+      vertex->out_edges.emplace_back(EdgeTypeId::FromUint(get_id(edge_type)), get_vertex(to_gid), edge_ref);
+    }
+    edge_count_diff += static_cast<int64_t>(out_edges.size());
+  }
+
+  // Remove deleted objects.
+  for (auto const gid : deleted_edges) {
+    highest_edge_gid = std::max(highest_edge_gid, gid.AsUint());
+    edge_acc.remove(gid);
+    edge_metadata_acc.remove(gid);
+  }
+  for (auto const gid : deleted_vertices) {
+    highest_vertex_gid = std::max(highest_vertex_gid, gid.AsUint());
+    auto it = vertex_acc.find(gid);
+    if (it == vertex_acc.end()) continue;
+    edge_count_diff -= static_cast<int64_t>(it->out_edges.size());
+    vertex_acc.remove(gid);
+  }
+
+  edge_count->fetch_add(static_cast<uint64_t>(edge_count_diff), std::memory_order_acq_rel);
+
+  recovery_info.next_vertex_id = highest_vertex_gid + 1;
+  recovery_info.next_edge_id = highest_edge_gid + 1;
+  recovery_info.next_timestamp = info.start_timestamp + 1;
+  recovery_info.last_durable_timestamp = info.durable_timestamp;
+  return recovery_info;
+}
+
+bool CreateIncrementalSnapshot(Storage *storage, Transaction *transaction,
+                               const std::filesystem::path &snapshot_directory, utils::SkipList<Vertex> *vertices,
+                               utils::SkipList<Edge> *edges, const SnapshotChanges &changes, uint64_t base_timestamp,
+                               utils::UUID const &uuid, const memgraph::replication::ReplicationEpoch &epoch,
+                               std::atomic_bool *abort_snapshot) {
+  utils::Timer timer;
+
+  auto const snapshot_aborted = [abort_snapshot, &timer]() -> bool {
+    if (abort_snapshot == nullptr) return false;
+    if (timer.Elapsed() >= kCheckIfSnapshotAborted) {
+      const bool abort = abort_snapshot->load(std::memory_order_acquire);
+      if (!abort) timer.ResetStartTime();
+      return abort;
+    }
+    return false;
+  };
+
+  auto const directory = IncrementalSnapshotDirectory(snapshot_directory);
+  utils::EnsureDirOrDie(directory);
+
+  auto const durable_timestamp =
+      transaction->last_durable_ts_ ? *transaction->last_durable_ts_ : transaction->start_timestamp;
+  auto path = directory / MakeSnapshotName(durable_timestamp);
+  spdlog::info("Starting incremental snapshot creation to {}", path);
+  SnapshotEncoder snapshot;
+  snapshot.Initialize(path, kIncrementalSnapshotMagic, kVersion);
+
+  bool success = false;
+  auto const cleanup = utils::OnScopeExit([&] {
+    if (success) return;
+    snapshot.Finalize();
+    utils::DeleteFile(path);
+  });
+
+  // Write placeholder offsets.
+  uint64_t offset_offsets = 0;
+  uint64_t offset_edges = 0;
+  uint64_t offset_vertices = 0;
+  uint64_t offset_deleted = 0;
+  uint64_t offset_mapper = 0;
+  uint64_t offset_metadata = 0;
+
+  auto write_offsets = [&] {
+    snapshot.WriteUint(offset_edges);
+    snapshot.WriteUint(offset_vertices);
+    snapshot.WriteUint(offset_deleted);
+    snapshot.WriteUint(offset_mapper);
+    snapshot.WriteUint(offset_metadata);
+  };
+
+  {
+    snapshot.WriteMarker(Marker::SECTION_OFFSETS);
+    offset_offsets = snapshot.GetPosition();
+    write_offsets();
+  }
+
+  // Object counters.
+  uint64_t edges_count = 0;
+  uint64_t vertices_count = 0;
+  std::vector<Gid> deleted_vertices;
+  std::vector<Gid> deleted_edges;
+
+  // Mapper data.
+  std::unordered_set<uint64_t> used_ids;
+  auto write_mapping = [&snapshot, &used_ids](auto mapping) {
+    used_ids.insert(mapping.AsUint());
+    snapshot.WriteUint(mapping.AsUint());
+  };
+
+  // Objects are written in gid order, same as in the full snapshot.
+  auto sorted_gids = [](auto const &objects) {
+    std::vector<Gid> gids;
+    gids.reserve(objects.size());
+    for (auto const &[gid, _] : objects) gids.push_back(gid);
+    std::sort(gids.begin(), gids.end());
+    return gids;
+  };
+
+  auto counter = utils::ResettableCounter{50};  // Counter used to reduce the frequency of checking abort
+
+  // Store edges.
+  if (storage->config_.salient.items.properties_on_edges) {
+    offset_edges = snapshot.GetPosition();
+    auto acc = edges->access();
+    for (auto const gid : sorted_gids(changes.edges)) {
+      if (counter() && snapshot_aborted()) [[unlikely]] {
+        return false;
+      }
+
+      auto it = acc.find(gid);
+      bool is_visible = it != acc.end();
+      if (is_visible) {
+        // The edge visibility check must be done here manually because we don't
+        // allow direct access to the edges through the public API.
+        Delta *delta = nullptr;
+        {
+          auto guard = std::shared_lock{it->lock};
+          is_visible = !it->deleted;
+          delta = it->delta;
+        }
+        ApplyDeltasForRead(transaction, delta, View::OLD, [&is_visible](const Delta &delta) {
+          switch (delta.action) {
+            case Delta::Action::ADD_LABEL:
+            case Delta::Action::REMOVE_LABEL:
+            case Delta::Action::SET_PROPERTY:
+            case Delta::Action::ADD_IN_EDGE:
+            case Delta::Action::ADD_OUT_EDGE:
+            case Delta::Action::REMOVE_IN_EDGE:
+            case Delta::Action::REMOVE_OUT_EDGE:
+              break;
+            case Delta::Action::RECREATE_OBJECT: {
+              is_visible = true;
+              break;
+            }
+            case Delta::Action::DELETE_DESERIALIZED_OBJECT:
+            case Delta::Action::DELETE_OBJECT: {
+              is_visible = false;
+              break;
+            }
+          }
+        });
+      }
+      if (!is_visible) {
+        deleted_edges.push_back(gid);
+        continue;
+      }
+
+      // Same as in the full snapshot, the accessor is only used to read the properties.
+      auto ea = EdgeAccessor{EdgeRef(&*it), EdgeTypeId::FromUint(0UL), nullptr, nullptr, storage, transaction};
+      auto maybe_props = ea.Properties(View::OLD);
+      MG_ASSERT(maybe_props.HasValue(), "Invalid database state!");
+
+      snapshot.WriteMarker(Marker::SECTION_EDGE);
+      snapshot.WriteUint(gid.AsUint());
+      const auto &props = maybe_props.GetValue();
+      snapshot.WriteUint(props.size());
+      for (const auto &item : props) {
+        write_mapping(item.first);
+        snapshot.WriteExternalPropertyValue(ToExternalPropertyValue(item.second, storage->name_id_mapper_.get()));
+      }
+      ++edges_count;
+    }
+  } else {
+    // Without properties on edges, edges only exist as part of their vertices.
+    for (auto const gid : sorted_gids(changes.edges)) deleted_edges.push_back(gid);
+  }
+
+  // Store vertices.
+  {
+    offset_vertices = snapshot.GetPosition();
+    auto acc = vertices->access();
+    for (auto const gid : sorted_gids(changes.vertices)) {
+      if (counter() && snapshot_aborted()) [[unlikely]] {
+        return false;
+      }
+
+      auto it = acc.find(gid);
+      auto va = it != acc.end() ? VertexAccessor::Create(&*it, storage, transaction, View::OLD) : std::nullopt;
+      if (!va) {
+        deleted_vertices.push_back(gid);
+        continue;
+      }
+
+      auto maybe_labels = va->Labels(View::OLD);
+      MG_ASSERT(maybe_labels.HasValue(), "Invalid database state!");
+      auto maybe_props = va->Properties(View::OLD);
+      MG_ASSERT(maybe_props.HasValue(), "Invalid database state!");
+      auto maybe_in_edges = va->InEdges(View::OLD);
+      MG_ASSERT(maybe_in_edges.HasValue(), "Invalid database state!");
+      auto maybe_out_edges = va->OutEdges(View::OLD);
+      MG_ASSERT(maybe_out_edges.HasValue(), "Invalid database state!");
+
+      snapshot.WriteMarker(Marker::SECTION_VERTEX);
+      snapshot.WriteUint(gid.AsUint());
+      const auto &labels = maybe_labels.GetValue();
+      snapshot.WriteUint(labels.size());
+      for (const auto &item : labels) {
+        write_mapping(item);
+      }
+      const auto &props = maybe_props.GetValue();
+      snapshot.WriteUint(props.size());
+      for (const auto &item : props) {
+        write_mapping(item.first);
+        snapshot.WriteExternalPropertyValue(ToExternalPropertyValue(item.second, storage->name_id_mapper_.get()));
+      }
+      auto const properties_on_edges = storage->config_.salient.items.properties_on_edges;
+      auto write_edge_gid = [&](auto const &item) {
+        snapshot.WriteUint(properties_on_edges ? item.GidPropertiesOnEdges().AsUint()
+                                               : item.GidNoPropertiesOnEdges().AsUint());
+      };
+      const auto &in_edges = maybe_in_edges.GetValue().edges;
+      snapshot.WriteUint(in_edges.size());
+      for (const auto &item : in_edges) {
+        write_edge_gid(item);
+        snapshot.WriteUint(item.FromVertex().Gid().AsUint());
+        write_mapping(item.EdgeType());
+      }
+      const auto &out_edges = maybe_out_edges.GetValue().edges;
+      snapshot.WriteUint(out_edges.size());
+      for (const auto &item : out_edges) {
+        write_edge_gid(item);
+        snapshot.WriteUint(item.ToVertex().Gid().AsUint());
+        write_mapping(item.EdgeType());
+      }
+      ++vertices_count;
+    }
+  }
+
+  // Write deleted objects.
+  {
+    offset_deleted = snapshot.GetPosition();
+    snapshot.WriteMarker(Marker::SECTION_DELETED);
+    snapshot.WriteUint(deleted_vertices.size());
+    for (auto const gid : deleted_vertices) snapshot.WriteUint(gid.AsUint());
+    snapshot.WriteUint(deleted_edges.size());
+    for (auto const gid : deleted_edges) snapshot.WriteUint(gid.AsUint());
+  }
+
+  // Write mapper data.
+  {
+    offset_mapper = snapshot.GetPosition();
+    snapshot.WriteMarker(Marker::SECTION_MAPPER);
+    snapshot.WriteUint(used_ids.size());
+    std::vector<uint64_t> sorted_ids(used_ids.begin(), used_ids.end());
+    std::sort(sorted_ids.begin(), sorted_ids.end());
+    for (auto item : sorted_ids) {
+      snapshot.WriteUint(item);
+      snapshot.WriteString(storage->name_id_mapper_->IdToName(item));
+    }
+  }
+
+  // Write metadata.
+  {
+    offset_metadata = snapshot.GetPosition();
+    snapshot.WriteMarker(Marker::SECTION_METADATA);
+    snapshot.WriteString(std::string{uuid});
+    snapshot.WriteString(epoch.id());
+    snapshot.WriteUint(base_timestamp);
+    snapshot.WriteUint(transaction->start_timestamp);
+    snapshot.WriteUint(durable_timestamp);
+    snapshot.WriteUint(edges_count);
+    snapshot.WriteUint(vertices_count);
+  }
+
+  // Write true offsets.
+  {
+    snapshot.SetPosition(offset_offsets);
+    write_offsets();
+  }
+
+  if (snapshot_aborted()) {
+    return false;
+  }
+
+  // Finalize snapshot file.
+  snapshot.Finalize();
+  success = true;
+  spdlog::info("Incremental snapshot creation successful! Written {} vertices, {} edges, {} deleted objects.",
+               vertices_count, edges_count, deleted_vertices.size() + deleted_edges.size());
+  return true;
+}
+
+void DeleteIncrementalSnapshots(const std::filesystem::path &snapshot_directory, utils::FileRetainer *file_retainer) {
+  auto const directory = IncrementalSnapshotDirectory(snapshot_directory);
+  if (!utils::DirExists(directory)) return;
+
+  std::error_code error_code;
+  for (const auto &item : std::filesystem::directory_iterator(directory, error_code)) {
+    if (!item.is_regular_file()) continue;
+    file_retainer->DeleteFile(item.path());
+  }
+  if (error_code) {
+    spdlog::error(
+        utils::MessageWithLink("Couldn't clean up the incremental snapshots because of: {}.", error_code.message(),
+                               "https://memgr.ph/snapshots"));
+  }
+}
+
+}  // namespace memgraph::storage::durability
@@ -0,0 +1,161 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "replication/epoch.hpp"
+#include "storage/v2/config.hpp"
+#include "storage/v2/durability/metadata.hpp"
+#include "storage/v2/edge.hpp"
+#include "storage/v2/id_types.hpp"
+#include "storage/v2/name_id_mapper.hpp"
+#include "storage/v2/transaction.hpp"
+#include "storage/v2/vertex.hpp"
+#include "utils/file_locker.hpp"
+#include "utils/skip_list.hpp"
+#include "utils/uuid.hpp"
+
+namespace memgraph::storage {
+class Storage;
+}  // namespace memgraph::storage
+
+namespace memgraph::storage::durability {
+
+static const std::string kIncrementalSnapshotDirectory{"incremental"};
+
+/// Objects modified by the transactions committed since the last snapshot. The next snapshot can be written as an
+/// incremental layer containing only these objects, applied on top of the previous (full or incremental) snapshot.
+struct SnapshotChanges {
+  /// Objects modified by a single transaction, gathered before it commits
+  struct Modified {
+    std::vector<Gid> vertices;
+    std::vector<Gid> edges;
+    bool metadata{false};
+  };
+
+  // Modified object -> commit timestamp of its latest modification
+  std::unordered_map<Gid, uint64_t> vertices;
+  std::unordered_map<Gid, uint64_t> edges;
+  // Set when something that isn't tracked per object happened since the last snapshot (schema change, storage mode
+  // switch, new epoch...); the next snapshot then has to be a full one. Holds the commit timestamp of the latest such
+  // change, or 0 if it wasn't caused by a commit.
+  std::optional<uint64_t> full_snapshot_needed{0};
+
+  void MarkFullSnapshotNeeded(uint64_t timestamp = 0) {
+    full_snapshot_needed = std::max(full_snapshot_needed.value_or(0), timestamp);
+  }
+
+  void Add(Modified const &modified, uint64_t commit_timestamp) {
+    if (modified.metadata || full_snapshot_needed) {
+      // The commit timestamp is kept so a snapshot that doesn't see this commit won't clear the mark
+      MarkFullSnapshotNeeded(commit_timestamp);
+      return;
+    }
+    auto add = [commit_timestamp](auto &to, auto const &gids) {
+      for (auto const gid : gids) {
+        auto [it, inserted] = to.try_emplace(gid, commit_timestamp);
+        if (!inserted) it->second = std::max(it->second, commit_timestamp);
+      }
+    };
+    add(vertices, modified.vertices);
+    add(edges, modified.edges);
+  }
+
+  void Merge(SnapshotChanges &&other) {
+    if (other.full_snapshot_needed) MarkFullSnapshotNeeded(*other.full_snapshot_needed);
+    auto merge = [](auto &to, auto &from) {
+      for (auto const &[gid, timestamp] : from) {
+        auto [it, inserted] = to.try_emplace(gid, timestamp);
+        if (!inserted) it->second = std::max(it->second, timestamp);
+      }
+    };
+    merge(vertices, other.vertices);
+    merge(edges, other.edges);
+  }
+
+  /// Returns the changes committed after `timestamp`, which a snapshot started at `timestamp` doesn't see and the
+  /// next snapshot has to include again. The changes themselves are left untouched.
+  SnapshotChanges CommittedAfter(uint64_t timestamp) const {
+    SnapshotChanges res{.full_snapshot_needed = std::nullopt};
+    if (full_snapshot_needed && *full_snapshot_needed > timestamp) res.full_snapshot_needed = full_snapshot_needed;
+    auto copy_newer = [timestamp](auto &to, auto const &from) {
+      for (auto const &[gid, commit_timestamp] : from) {
+        if (commit_timestamp > timestamp) to.emplace(gid, commit_timestamp);
+      }
+    };
+    copy_newer(res.vertices, vertices);
+    copy_newer(res.edges, edges);
+    return res;
+  }
+};
+
+/// Structure used to hold information about an incremental snapshot.
+struct IncrementalSnapshotInfo {
+  uint64_t offset_edges;
+  uint64_t offset_vertices;
+  uint64_t offset_deleted;
+  uint64_t offset_mapper;
+  uint64_t offset_metadata;
+
+  std::string uuid;
+  std::string epoch_id;
+  // Durable timestamp of the snapshot this one has to be applied on top of
+  uint64_t base_timestamp;
+  uint64_t start_timestamp;
+  uint64_t durable_timestamp;
+  uint64_t edges_count;
+  uint64_t vertices_count;
+};
+
+inline std::filesystem::path IncrementalSnapshotDirectory(const std::filesystem::path &snapshot_directory) {
+  return snapshot_directory / kIncrementalSnapshotDirectory;
+}
+
+/// Function used to read information about the incremental snapshot file.
+/// @throw RecoveryFailure
+IncrementalSnapshotInfo ReadIncrementalSnapshotInfo(const std::filesystem::path &path);
+
+/// Returns the incremental snapshots that have to be applied, in order, on top of the snapshot with the given UUID
+/// and durable timestamp. The chain stops at the first missing or unreadable layer.
+std::vector<std::pair<std::filesystem::path, IncrementalSnapshotInfo>> GetIncrementalSnapshotChain(
+    const std::filesystem::path &snapshot_directory, std::string_view uuid, uint64_t base_timestamp);
+
+/// Function used to apply an incremental snapshot on top of the already recovered data. Only the timestamp and id
+/// fields of the returned structure are filled.
+/// @throw RecoveryFailure
+RecoveryInfo LoadIncrementalSnapshot(const std::filesystem::path &path, utils::SkipList<Vertex> *vertices,
+                                     utils::SkipList<Edge> *edges, utils::SkipList<EdgeMetadata> *edges_metadata,
+                                     NameIdMapper *name_id_mapper, std::atomic<uint64_t> *edge_count,
+                                     SalientConfig::Items items);
+
+/// Writes the objects in `changes`, as seen by `transaction`, as an incremental snapshot on top of the snapshot with
+/// durable timestamp `base_timestamp`. Objects that aren't visible anymore are written as deleted.
+bool CreateIncrementalSnapshot(Storage *storage, Transaction *transaction,
+                               const std::filesystem::path &snapshot_directory, utils::SkipList<Vertex> *vertices,
+                               utils::SkipList<Edge> *edges, const SnapshotChanges &changes, uint64_t base_timestamp,
+                               utils::UUID const &uuid, const memgraph::replication::ReplicationEpoch &epoch,
+                               std::atomic_bool *abort_snapshot = nullptr);
+
+/// Deletes all incremental snapshots. Used once a new full snapshot makes them obsolete.
+void DeleteIncrementalSnapshots(const std::filesystem::path &snapshot_directory, utils::FileRetainer *file_retainer);
+
+}  // namespace memgraph::storage::durability
@@ -44,6 +44,7 @@ enum class Marker : uint8_t {
   SECTION_EPOCH_HISTORY = 0x27,
   SECTION_EDGE_INDICES = 0x28,
   SECTION_ENUMS = 0x29,
+  SECTION_DELETED = 0x2a,
 
   SECTION_OFFSETS = 0x42,
 
@@ -117,6 +118,7 @@ static constexpr Marker kMarkersAll[] = {
     Marker::SECTION_EDGE_INDICES,
     Marker::SECTION_OFFSETS,
     Marker::SECTION_ENUMS,
+    Marker::SECTION_DELETED,
     Marker::DELTA_VERTEX_CREATE,
     Marker::DELTA_VERTEX_DELETE,
     Marker::DELTA_VERTEX_ADD_LABEL,
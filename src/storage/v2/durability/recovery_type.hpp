@@ -1,4 +1,4 @@
-// Copyright 2023 Memgraph Ltd.
+// Copyright 2025 Memgraph Ltd.
 //
 // Use of this software is governed by the Business Source License
 // included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -19,5 +19,8 @@ namespace memgraph::storage::durability {
 struct ParallelizedSchemaCreationInfo {
   std::vector<std::pair<Gid, uint64_t>> vertex_recovery_info;
   uint64_t thread_count;
+  // Vertices may be added or removed while the batches are in use, so a batch ends where the next one starts instead
+  // of after its size
+  bool vertices_may_change{false};
 };
 }  // namespace memgraph::storage::durability
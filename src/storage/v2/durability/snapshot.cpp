@@ -51,6 +51,7 @@
 #include "storage/v2/storage.hpp"
 #include "storage/v2/vertex.hpp"
 #include "storage/v2/vertex_accessor.hpp"
+#include "utils/event_labeled_histogram.hpp"
 #include "utils/file.hpp"
 #include "utils/file_locker.hpp"
 #include "utils/logging.hpp"
@@ -65,6 +66,10 @@ namespace {
 constexpr auto kCheckIfSnapshotAborted = 3s;
 }  // namespace
 
+namespace memgraph::metrics {
+extern const Event SnapshotPhaseLatency_us;
+}  // namespace memgraph::metrics
+
 namespace memgraph::storage::durability {
 
 // Snapshot format:
@@ -4683,6 +4688,13 @@ bool CreateSnapshot(Storage *storage, Transaction *transaction, const std::files
     return false;
   };
 
+  utils::Timer phase_timer;
+  const auto measure_phase = [&phase_timer](std::string_view phase) {
+    metrics::MeasureLabeled(metrics::SnapshotPhaseLatency_us, {phase},
+                            std::chrono::duration_cast<std::chrono::microseconds>(phase_timer.Elapsed()).count());
+    phase_timer.ResetStartTime();
+  };
+
   // Ensure that the storage directory exists.
   utils::EnsureDirOrDie(snapshot_directory);
 
@@ -4996,6 +5008,8 @@ bool CreateSnapshot(Storage *storage, Transaction *transaction, const std::files
     }
   }
 
+  measure_phase("objects");
+
   // Write indices.
   {
     offset_indices = snapshot.GetPosition();
@@ -5223,6 +5237,8 @@ bool CreateSnapshot(Storage *storage, Transaction *transaction, const std::files
     }
   }
 
+  measure_phase("indices_and_constraints");
+
   // Write mapper data.
   {
     offset_mapper = snapshot.GetPosition();
@@ -5303,6 +5319,8 @@ bool CreateSnapshot(Storage *storage, Transaction *transaction, const std::files
     return true;
   };
 
+  measure_phase("metadata");
+
   // Write edge batches
   {
     offset_edge_batches = snapshot.GetPosition();
@@ -5332,6 +5350,7 @@ bool CreateSnapshot(Storage *storage, Transaction *transaction, const std::files
   // Finalize snapshot file.
   snapshot.Finalize();
   spdlog::info("Snapshot creation successful!");
+  measure_phase("finalize");
 
   OldSnapshotFiles old_snapshot_files =
       EnsureRetentionCountSnapshotsExist(snapshot_directory, path, uuid_str, file_retainer, storage);
@@ -5341,6 +5360,7 @@ bool CreateSnapshot(Storage *storage, Transaction *transaction, const std::files
     EnsureNecessaryWalFilesExist(wal_directory, uuid_str, std::move(old_snapshot_files), transaction, file_retainer,
                                  storage->name_id_mapper_.get());
   }
+  measure_phase("retention");
 
   // We are not updating ldt here; we are only updating it when recovering from snapshot (because there is no other
   // timestamp to use) and we are relaxing the ts checks on replica
@@ -41,6 +41,7 @@ const uint64_t kEdgePropIndex{24};
 // Magic values written to the start of a snapshot/WAL file to identify it.
 const std::string kSnapshotMagic{"MGsn"};
 const std::string kWalMagic{"MGwl"};
+const std::string kIncrementalSnapshotMagic{"MGis"};
 
 static_assert(std::is_same_v<uint8_t, unsigned char>);
 
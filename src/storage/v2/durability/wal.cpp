@@ -31,6 +31,7 @@
 #include "storage/v2/vertex.hpp"
 #include "utils/file_locker.hpp"
 #include "utils/logging.hpp"
+#include "utils/metrics_timer.hpp"
 #include "utils/tag.hpp"
 
 namespace r = ranges;
@@ -39,6 +40,10 @@ namespace rv = r::views;
 static constexpr std::string_view kInvalidWalErrorMessage =
     "Invalid WAL data! Your durability WAL files somehow got corrupted. Please contact the Memgraph team for support.";
 
+namespace memgraph::metrics {
+extern const Event WalFsyncLatency_us;
+}  // namespace memgraph::metrics
+
 namespace memgraph::storage::durability {
 
 // WAL format:
@@ -238,6 +243,7 @@ constexpr bool IsMarkerImplicitTransactionEndVersion15(Marker marker) {
     case SECTION_EDGE_INDICES:
     case SECTION_OFFSETS:
     case SECTION_ENUMS:
+    case SECTION_DELETED:
     case VALUE_FALSE:
     case VALUE_TRUE:
       throw RecoveryFailure(kInvalidWalErrorMessage);
@@ -503,6 +509,7 @@ auto ReadSkipWalDeltaData(BaseDecoder *decoder, const uint64_t version)
     case Marker::SECTION_EDGE_INDICES:
     case Marker::SECTION_OFFSETS:
     case Marker::SECTION_ENUMS:
+    case Marker::SECTION_DELETED:
     case Marker::VALUE_FALSE:
     case Marker::VALUE_TRUE:
       throw RecoveryFailure(kInvalidWalErrorMessage);
@@ -1260,7 +1267,10 @@ void WalFile::AppendTransactionEnd(uint64_t timestamp) {
   UpdateStats(timestamp);
 }
 
-void WalFile::Sync() { wal_.Sync(); }
+void WalFile::Sync() {
+  const utils::MetricsTimer timer{metrics::WalFsyncLatency_us};
+  wal_.Sync();
+}
 
 uint64_t WalFile::GetSize() { return wal_.GetSize(); }
 
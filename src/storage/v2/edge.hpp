@@ -1,4 +1,4 @@
-// Copyright 2024 Memgraph Ltd.
+// Copyright 2025 Memgraph Ltd.
 //
 // Use of this software is governed by the Business Source License
 // included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -16,6 +16,7 @@
 #include "storage/v2/delta.hpp"
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/property_store.hpp"
+#include "utils/lock_contention.hpp"
 #include "utils/logging.hpp"
 #include "utils/rw_spin_lock.hpp"
 
@@ -34,7 +35,7 @@ struct Edge {
 
   PropertyStore properties;
 
-  mutable utils::RWSpinLock lock;
+  mutable utils::ProfiledLock<utils::RWSpinLock, utils::LockClass::EDGE> lock;
   bool deleted;
   // uint8_t PAD;
   // uint16_t PAD;
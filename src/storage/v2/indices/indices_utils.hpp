@@ -21,8 +21,11 @@
 #include "utils/spin_lock.hpp"
 #include "utils/synchronized.hpp"
 
+#include <algorithm>
 #include <atomic>
+#include <optional>
 #include <thread>
+#include <vector>
 
 namespace memgraph::storage {
 
@@ -206,6 +209,75 @@ inline void TryInsertLabelIndex(Vertex &vertex, LabelId label, TIndexAccessor &i
   index_accessor.insert({&vertex, 0});
 }
 
+/// Variant of `TryInsertLabelIndex` used while other transactions may be modifying the vertex. Any version that is
+/// still reachable through the delta chain might be visible to some active transaction, so the vertex is indexed if
+/// any of them has the label. Surplus entries are cleaned up by the index GC.
+template <typename TIndexAccessor>
+inline void TryInsertLabelIndexConcurrently(Vertex &vertex, LabelId label, TIndexAccessor &index_accessor) {
+  if (!AnyVersionHasLabel(vertex, label, 0)) {
+    return;
+  }
+
+  index_accessor.insert({&vertex, 0});
+}
+
+/// Accessor stand-in handed to the population callbacks by `PopulateIndexOnMultipleThreads`. Entries are buffered
+/// and inserted into the index skip list as sorted runs: consecutive inserts then walk nearly the same path through
+/// the list, which stays in cache, instead of every worker touching random towers for each vertex.
+template <typename TIndexAccessor>
+class SortedIndexInserter {
+ public:
+  using value_type = typename TIndexAccessor::value_type;
+
+  static constexpr std::size_t kMaxBufferedEntries = 1U << 16U;
+
+  explicit SortedIndexInserter(TIndexAccessor accessor) : accessor_{std::move(accessor)} {}
+
+  void insert(value_type &&entry) {
+    buffer_.push_back(std::move(entry));
+    if (buffer_.size() == kMaxBufferedEntries) {
+      Flush();
+    }
+  }
+
+  void Flush() {
+    std::sort(buffer_.begin(), buffer_.end());
+    for (auto &entry : buffer_) {
+      accessor_.insert(std::move(entry));
+    }
+    buffer_.clear();
+  }
+
+ private:
+  TIndexAccessor accessor_;
+  std::vector<value_type> buffer_;
+};
+
+/// Splits the vertices into batches of `items_per_batch` consecutive vertices, for index creation that has no
+/// snapshot batches to reuse (e.g. an index created by a query). Returns std::nullopt if there wouldn't be more than
+/// a single batch. Unless `vertices_may_change` is set, vertices must not be added or removed while the batches are in
+/// use.
+inline std::optional<durability::ParallelizedSchemaCreationInfo> MakeParallelExecInfo(
+    utils::SkipList<Vertex>::Accessor &vertices, uint64_t items_per_batch, uint64_t thread_count,
+    bool vertices_may_change = false) {
+  if (thread_count < 2 || items_per_batch == 0 || vertices.size() <= items_per_batch) {
+    return std::nullopt;
+  }
+
+  std::vector<std::pair<Gid, uint64_t>> batches;
+  batches.reserve((vertices.size() + items_per_batch - 1) / items_per_batch);
+  for (auto const &vertex : vertices) {
+    if (batches.empty() || batches.back().second == items_per_batch) {
+      batches.emplace_back(vertex.gid, 0);
+    }
+    ++batches.back().second;
+  }
+  if (batches.size() < 2) {
+    return std::nullopt;
+  }
+  return durability::ParallelizedSchemaCreationInfo{std::move(batches), thread_count, vertices_may_change};
+}
+
 template <typename TSkipListAccessorFactory, typename TFunc>
 inline void PopulateIndexOnMultipleThreads(utils::SkipList<Vertex>::Accessor &vertices,
                                            TSkipListAccessorFactory &&accessor_factory, const TFunc &func,
@@ -230,23 +302,37 @@ inline void PopulateIndexOnMultipleThreads(utils::SkipList<Vertex>::Accessor &ve
 
     for (auto i{0U}; i < thread_count; ++i) {
       threads.emplace_back([&]() mutable {
-        auto acc = accessor_factory();
+        auto acc = SortedIndexInserter{accessor_factory()};
         while (!maybe_error.Lock()->has_value()) {
           const auto batch_index = batch_counter++;
           if (batch_index >= vertex_batches.size()) {
             return;
           }
           const auto &batch = vertex_batches[batch_index];
-          auto it = vertices.find(batch.first);
+          auto const populate = [&](Vertex &vertex) {
+            func(vertex, acc);
+            if (snapshot_info) {
+              snapshot_info->Update(UpdateType::VERTICES);
+            }
+          };
 
           try {
-            for (auto i{0U}; i < batch.second; ++i, ++it) {
-              func(*it, acc);
-              if (snapshot_info) {
-                snapshot_info->Update(UpdateType::VERTICES);
+            if (parallel_exec_info.vertices_may_change) {
+              // The last batch also covers vertices added after the batches were made
+              auto const next_batch_start = batch_index + 1 < vertex_batches.size()
+                                                ? std::optional{vertex_batches[batch_index + 1].first}
+                                                : std::nullopt;
+              for (auto it = vertices.find_equal_or_greater(batch.first);
+                   it != vertices.end() && (!next_batch_start || it->gid < *next_batch_start); ++it) {
+                populate(*it);
+              }
+            } else {
+              auto it = vertices.find(batch.first);
+              for (auto i{0U}; i < batch.second && it != vertices.end(); ++i, ++it) {
+                populate(*it);
               }
             }
-
+            acc.Flush();
           } catch (utils::OutOfMemoryException &failure) {
             utils::MemoryTracker::OutOfMemoryExceptionBlocker oom_exception_blocker;
             *maybe_error.Lock() = std::move(failure);
@@ -290,84 +376,6 @@ inline void PopulateIndex(utils::SkipList<Vertex>::Accessor &vertices, TSkipList
   }
 }
 
-// @TODO Is `Create` the correct term here? Should this be `PopulateIndexOnSingleThread`?
-template <typename TSkiplistIter, typename TIndex, typename TFunc>
-inline void CreateIndexOnSingleThread(utils::SkipList<Vertex>::Accessor &vertices, TSkiplistIter it, TIndex &index,
-                                      const TFunc &func,
-                                      std::optional<SnapshotObserverInfo> const &snapshot_info = std::nullopt) {
-  utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
-
-  try {
-    auto acc = it->second.access();
-    for (Vertex &vertex : vertices) {
-      func(vertex, acc);
-      if (snapshot_info) {
-        snapshot_info->Update(UpdateType::VERTICES);
-      }
-    }
-  } catch (const utils::OutOfMemoryException &) {
-    utils::MemoryTracker::OutOfMemoryExceptionBlocker oom_exception_blocker;
-    index.erase(it);
-    throw;
-  }
-}
-
-template <typename TIndex, typename TSKiplistIter, typename TFunc>
-inline void CreateIndexOnMultipleThreads(utils::SkipList<Vertex>::Accessor &vertices, TSKiplistIter skiplist_iter,
-                                         TIndex &index,
-                                         const durability::ParallelizedSchemaCreationInfo &parallel_exec_info,
-                                         const TFunc &func,
-                                         std::optional<SnapshotObserverInfo> const &snapshot_info = std::nullopt) {
-  utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
-
-  const auto &vertex_batches = parallel_exec_info.vertex_recovery_info;
-  const auto thread_count = std::min(parallel_exec_info.thread_count, vertex_batches.size());
-
-  MG_ASSERT(!vertex_batches.empty(),
-            "The size of batches should always be greater than zero if you want to use the parallel version of index "
-            "creation!");
-
-  std::atomic<uint64_t> batch_counter = 0;
-
-  // TODO(composite_index): return std::optional<utils::OutOfMemoryException>, handle index cleanup from caller
-  utils::Synchronized<std::optional<utils::OutOfMemoryException>, utils::SpinLock> maybe_error{};
-  {
-    std::vector<std::jthread> threads;
-    threads.reserve(thread_count);
-
-    for (auto i{0U}; i < thread_count; ++i) {
-      threads.emplace_back([&]() mutable {
-        while (!maybe_error.Lock()->has_value()) {
-          const auto batch_index = batch_counter++;
-          if (batch_index >= vertex_batches.size()) {
-            return;
-          }
-          const auto &batch = vertex_batches[batch_index];
-          auto index_accessor = skiplist_iter->second.access();
-          auto it = vertices.find(batch.first);
-
-          try {
-            for (auto i{0U}; i < batch.second; ++i, ++it) {
-              func(*it, index_accessor);
-              if (snapshot_info) {
-                snapshot_info->Update(UpdateType::VERTICES);
-              }
-            }
-
-          } catch (utils::OutOfMemoryException &failure) {
-            utils::MemoryTracker::OutOfMemoryExceptionBlocker oom_exception_blocker;
-            index.erase(skiplist_iter);  // TODO(composite_index): make this safe...only should only be called once
-            *maybe_error.Lock() = std::move(failure);
-          }
-        }
-      });
-    }
-  }
-  if (maybe_error.Lock()->has_value()) {
-    throw utils::OutOfMemoryException((*maybe_error.Lock())->what());
-  }
-}
-
 // Helper function that determines, if a transaction has an original start timestamp
 // (for example in a periodic commit when it is necessary to preserve initial index iterators)
 // whether we are allowed to see the entity in the index data structures
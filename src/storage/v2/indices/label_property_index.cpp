@@ -86,6 +86,12 @@ auto PropertiesPermutationHelper::MatchesValue(PropertyId property_id, PropertyV
   return std::pair{pos, values.values_[position_lookup_[pos]] == value};
 }
 
+auto PropertiesPermutationHelper::ExtractedPosition(PropertyId property_id) const -> std::optional<std::size_t> {
+  auto it = std::ranges::find(sorted_properties_, property_id);
+  if (it == sorted_properties_.end()) return std::nullopt;
+  return std::distance(sorted_properties_.begin(), it);
+}
+
 auto PropertiesPermutationHelper::MatchesValues(PropertyStore const &properties,
                                                 IndexOrderedPropertyValues const &values) const -> std::vector<bool> {
   return properties.ArePropertiesEqual(sorted_properties_, values.values_, position_lookup_);
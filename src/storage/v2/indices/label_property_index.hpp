@@ -135,6 +135,12 @@ struct PropertiesPermutationHelper {
   auto MatchesValue(PropertyId property_id, PropertyValue const &value, IndexOrderedPropertyValues const &values) const
       -> std::optional<std::pair<std::ptrdiff_t, bool>>;
 
+  /** Returns the position of the property with id `property_id` within the
+   * values returned by `Extract`, or `std::nullopt` if the id is not in the
+   * index.
+   */
+  auto ExtractedPosition(PropertyId property_id) const -> std::optional<std::size_t>;
+
   /** Efficiently compares multiple values in the property store with the given
    * values. This returns a vector of boolean flags indicating per-element
    * equality.
@@ -11,6 +11,7 @@
 
 #include "storage/v2/inmemory/label_index.hpp"
 
+#include <ranges>
 #include <span>
 
 #include "storage/v2/constraints/constraints.hpp"
@@ -20,42 +21,83 @@
 namespace memgraph::storage {
 
 void InMemoryLabelIndex::UpdateOnAddLabel(LabelId added_label, Vertex *vertex_after_update, const Transaction &tx) {
-  auto it = index_.find(added_label);
-  if (it == index_.end()) return;
-  auto acc = it->second.access();
+  auto index = index_.MutableSharedLock();
+  auto it = index->find(added_label);
+  if (it == index->end()) return;
+  auto acc = it->second.skiplist.access();
   acc.insert(Entry{vertex_after_update, tx.start_timestamp});
 }
 
-bool InMemoryLabelIndex::CreateIndex(
-    LabelId label, utils::SkipList<Vertex>::Accessor vertices,
+template <typename TFunc>
+bool InMemoryLabelIndex::CreateIndexImpl(
+    LabelId label, utils::SkipList<Vertex>::Accessor vertices, TFunc const &func,
     const std::optional<durability::ParallelizedSchemaCreationInfo> &parallel_exec_info,
-    std::optional<SnapshotObserverInfo> const &snapshot_info) {
-  auto [it, emplaced] = index_.emplace(std::piecewise_construct, std::forward_as_tuple(label), std::forward_as_tuple());
-  if (!emplaced) {
-    // Index already exists.
-    return false;
+    std::optional<SnapshotObserverInfo> const &snapshot_info, bool const concurrent) {
+  IndividualIndex *index = nullptr;
+  {
+    auto locked_index = index_.Lock();
+    auto [it, emplaced] =
+        locked_index->emplace(std::piecewise_construct, std::forward_as_tuple(label), std::forward_as_tuple());
+    if (!emplaced) {
+      if (!it->second.failed) {
+        // Index already exists.
+        return false;
+      }
+      it->second.failed = false;
+    }
+    index = &it->second;
   }
 
-  auto const func = [&](Vertex &vertex, auto &index_accessor) { TryInsertLabelIndex(vertex, label, index_accessor); };
-
-  if (parallel_exec_info) {
-    CreateIndexOnMultipleThreads(vertices, it, index_, *parallel_exec_info, func, snapshot_info);
-  } else {
-    CreateIndexOnSingleThread(vertices, it, index_, func, snapshot_info);
+  try {
+    auto accessor_factory = [&] { return index->skiplist.access(); };
+    auto const try_insert_into_index = [&](Vertex &vertex, auto &index_accessor) { func(vertex, index_accessor); };
+    PopulateIndex(vertices, accessor_factory, try_insert_into_index, parallel_exec_info, snapshot_info);
+  } catch (const utils::OutOfMemoryException &) {
+    utils::MemoryTracker::OutOfMemoryExceptionBlocker const oom_exception_blocker;
+    if (concurrent) {
+      index_.WithLock([index](auto & /*index*/) { index->failed = true; });
+    } else {
+      index_.Lock()->erase(label);
+    }
+    throw;
   }
 
+  index_.Lock()->at(label).ready = true;
   return true;
 }
 
-bool InMemoryLabelIndex::DropIndex(LabelId label) { return index_.erase(label) > 0; }
+bool InMemoryLabelIndex::CreateIndex(
+    LabelId label, utils::SkipList<Vertex>::Accessor vertices,
+    const std::optional<durability::ParallelizedSchemaCreationInfo> &parallel_exec_info,
+    std::optional<SnapshotObserverInfo> const &snapshot_info) {
+  auto const func = [&](Vertex &vertex, auto &index_accessor) { TryInsertLabelIndex(vertex, label, index_accessor); };
+  return CreateIndexImpl(label, std::move(vertices), func, parallel_exec_info, snapshot_info, false);
+}
 
-bool InMemoryLabelIndex::IndexExists(LabelId label) const { return index_.find(label) != index_.end(); }
+bool InMemoryLabelIndex::CreateIndexConcurrently(
+    LabelId label, utils::SkipList<Vertex>::Accessor vertices,
+    const std::optional<durability::ParallelizedSchemaCreationInfo> &parallel_exec_info) {
+  auto const func = [&](Vertex &vertex, auto &index_accessor) {
+    TryInsertLabelIndexConcurrently(vertex, label, index_accessor);
+  };
+  return CreateIndexImpl(label, std::move(vertices), func, parallel_exec_info, std::nullopt, true);
+}
+
+bool InMemoryLabelIndex::DropIndex(LabelId label) { return index_.Lock()->erase(label) > 0; }
+
+bool InMemoryLabelIndex::IndexExists(LabelId label) const {
+  auto index = index_.ReadLock();
+  auto it = index->find(label);
+  return it != index->end() && it->second.ready;
+}
 
 std::vector<LabelId> InMemoryLabelIndex::ListIndices() const {
+  auto index = index_.ReadLock();
   std::vector<LabelId> ret;
-  ret.reserve(index_.size());
-  for (const auto &item : index_) {
-    ret.push_back(item.first);
+  ret.reserve(index->size());
+  for (const auto &[label, individual_index] : *index) {
+    if (!individual_index.ready) continue;
+    ret.push_back(label);
   }
   return ret;
 }
@@ -63,11 +105,12 @@ std::vector<LabelId> InMemoryLabelIndex::ListIndices() const {
 void InMemoryLabelIndex::RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp, std::stop_token token) {
   auto maybe_stop = utils::ResettableCounter(2048);
 
-  for (auto &label_storage : index_) {
+  auto index = index_.MutableSharedLock();
+  for (auto &[label, individual_index] : *index) {
     // before starting index, check if stop_requested
     if (token.stop_requested()) return;
 
-    auto vertices_acc = label_storage.second.access();
+    auto vertices_acc = individual_index.skiplist.access();
     for (auto it = vertices_acc.begin(); it != vertices_acc.end();) {
       // Hot loop, don't check stop_requested every time
       if (maybe_stop() && token.stop_requested()) return;
@@ -81,7 +124,7 @@ void InMemoryLabelIndex::RemoveObsoleteEntries(uint64_t oldest_active_start_time
       }
 
       if ((next_it != vertices_acc.end() && it->vertex == next_it->vertex) ||
-          !AnyVersionHasLabel(*it->vertex, label_storage.first, oldest_active_start_timestamp)) {
+          !AnyVersionHasLabel(*it->vertex, label, oldest_active_start_timestamp)) {
         vertices_acc.remove(*it);
       }
 
@@ -91,10 +134,11 @@ void InMemoryLabelIndex::RemoveObsoleteEntries(uint64_t oldest_active_start_time
 }
 
 void InMemoryLabelIndex::AbortEntries(LabelIndex::AbortableInfo const &info, uint64_t exact_start_timestamp) {
+  auto index = index_.MutableSharedLock();
   for (auto const &[label, to_remove] : info) {
-    auto it = index_.find(label);
-    DMG_ASSERT(it != index_.end());
-    auto acc = it->second.access();
+    auto it = index->find(label);
+    DMG_ASSERT(it != index->end());
+    auto acc = it->second.skiplist.access();
     for (auto vertex : to_remove) {
       acc.remove(Entry{vertex, exact_start_timestamp});
     }
@@ -146,14 +190,16 @@ void InMemoryLabelIndex::Iterable::Iterator::AdvanceUntilValid() {
 }
 
 uint64_t InMemoryLabelIndex::ApproximateVertexCount(LabelId label) const {
-  auto it = index_.find(label);
-  MG_ASSERT(it != index_.end(), "Index for label {} doesn't exist", label.AsUint());
-  return it->second.size();
+  auto index = index_.ReadLock();
+  auto it = index->find(label);
+  MG_ASSERT(it != index->end(), "Index for label {} doesn't exist", label.AsUint());
+  return it->second.skiplist.size();
 }
 
 void InMemoryLabelIndex::RunGC() {
-  for (auto &index_entry : index_) {
-    index_entry.second.run_gc();
+  auto index = index_.MutableSharedLock();
+  for (auto &individual_index : *index | std::views::values) {
+    individual_index.skiplist.run_gc();
   }
 }
 
@@ -163,17 +209,19 @@ InMemoryLabelIndex::Iterable InMemoryLabelIndex::Vertices(LabelId label, View vi
                  storage->storage_mode_ == StorageMode::IN_MEMORY_ANALYTICAL,
              "LabelIndex trying to access InMemory vertices from OnDisk!");
   auto vertices_acc = static_cast<InMemoryStorage const *>(storage)->vertices_.access();
-  const auto it = index_.find(label);
-  MG_ASSERT(it != index_.end(), "Index for label {} doesn't exist", label.AsUint());
-  return {it->second.access(), std::move(vertices_acc), label, view, storage, transaction};
+  auto index = index_.MutableSharedLock();
+  const auto it = index->find(label);
+  MG_ASSERT(it != index->end(), "Index for label {} doesn't exist", label.AsUint());
+  return {it->second.skiplist.access(), std::move(vertices_acc), label, view, storage, transaction};
 }
 
 InMemoryLabelIndex::Iterable InMemoryLabelIndex::Vertices(
     LabelId label, memgraph::utils::SkipList<memgraph::storage::Vertex>::ConstAccessor vertices_acc, View view,
     Storage *storage, Transaction *transaction) {
-  const auto it = index_.find(label);
-  MG_ASSERT(it != index_.end(), "Index for label {} doesn't exist", label.AsUint());
-  return {it->second.access(), std::move(vertices_acc), label, view, storage, transaction};
+  auto index = index_.MutableSharedLock();
+  const auto it = index->find(label);
+  MG_ASSERT(it != index->end(), "Index for label {} doesn't exist", label.AsUint());
+  return {it->second.skiplist.access(), std::move(vertices_acc), label, view, storage, transaction};
 }
 
 void InMemoryLabelIndex::SetIndexStats(const storage::LabelId &label, const storage::LabelIndexStats &stats) {
@@ -212,16 +260,18 @@ bool InMemoryLabelIndex::DeleteIndexStats(const storage::LabelId &label) {
 }
 
 LabelIndex::AbortProcessor InMemoryLabelIndex::GetAbortProcessor() const {
+  // Indices that are still being populated are included, they might hold entries inserted by this transaction.
+  auto index = index_.ReadLock();
   std::vector<LabelId> res;
-  res.reserve(index_.size());
-  for (const auto &[label, _] : index_) {
+  res.reserve(index->size());
+  for (const auto &[label, _] : *index) {
     res.emplace_back(label);
   }
   return LabelIndex::AbortProcessor{res};
 }
 
 void InMemoryLabelIndex::DropGraphClearIndices() {
-  index_.clear();
+  index_.Lock()->clear();
   stats_->clear();
 }
 
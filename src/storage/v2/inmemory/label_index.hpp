@@ -20,6 +20,7 @@
 #include "storage/v2/indices/label_index_stats.hpp"
 #include "storage/v2/vertex.hpp"
 #include "utils/rw_lock.hpp"
+#include "utils/rw_spin_lock.hpp"
 #include "utils/synchronized.hpp"
 
 namespace memgraph::storage {
@@ -29,12 +30,23 @@ class InMemoryLabelIndex : public LabelIndex {
     Vertex *vertex;
     uint64_t timestamp;
 
-    bool operator<(const Entry &rhs) { return std::tie(vertex, timestamp) < std::tie(rhs.vertex, rhs.timestamp); }
+    bool operator<(const Entry &rhs) const { return std::tie(vertex, timestamp) < std::tie(rhs.vertex, rhs.timestamp); }
     bool operator==(const Entry &rhs) const {
       return std::tie(vertex, timestamp) == std::tie(rhs.vertex, rhs.timestamp);
     }
   };
 
+  struct IndividualIndex {
+    utils::SkipList<Entry> skiplist;
+    // An index that is still being populated already captures new writes, but it isn't reported as existing until
+    // it has seen every vertex.
+    bool ready{false};
+    // Population built next to writers ran out of memory. Writers may still reach the index through their abort
+    // processors, so it stays registered until it is dropped under unique access; creating it again carries on
+    // populating it, since the entries it holds are valid.
+    bool failed{false};
+  };
+
  public:
   InMemoryLabelIndex() = default;
 
@@ -48,6 +60,15 @@ class InMemoryLabelIndex : public LabelIndex {
                    const std::optional<durability::ParallelizedSchemaCreationInfo> &parallel_exec_info,
                    std::optional<SnapshotObserverInfo> const &snapshot_info = std::nullopt);
 
+  /// Creates the index while other transactions keep writing. The index is registered before the vertices are
+  /// scanned, so labels added concurrently are captured by `UpdateOnAddLabel`, and the scan inserts every vertex
+  /// that has the label in any version still reachable from its delta chain. Only once the scan is done does the
+  /// index show up in `IndexExists`/`ListIndices` and become usable by the planner.
+  /// With `parallel_exec_info`, the scan runs on multiple threads; its batches must allow vertices to change.
+  /// @throw std::bad_alloc
+  bool CreateIndexConcurrently(LabelId label, utils::SkipList<Vertex>::Accessor vertices,
+                               const std::optional<durability::ParallelizedSchemaCreationInfo> &parallel_exec_info);
+
   /// Returns false if there was no index to drop
   bool DropIndex(LabelId label) override;
 
@@ -119,7 +140,14 @@ class InMemoryLabelIndex : public LabelIndex {
   void DropGraphClearIndices() override;
 
  private:
-  std::map<LabelId, utils::SkipList<Entry>> index_;
+  template <typename TFunc>
+  bool CreateIndexImpl(LabelId label, utils::SkipList<Vertex>::Accessor vertices, TFunc const &func,
+                       const std::optional<durability::ParallelizedSchemaCreationInfo> &parallel_exec_info,
+                       std::optional<SnapshotObserverInfo> const &snapshot_info, bool concurrent);
+
+  // Registration of new indices may run concurrently with writers, hence the lock. Entries are only ever erased
+  // under unique storage access, so references into the map stay valid after the lock is released.
+  utils::Synchronized<std::map<LabelId, IndividualIndex>, utils::RWSpinLock> index_;
   utils::Synchronized<std::map<LabelId, storage::LabelIndexStats>, utils::ReadPrioritizedRWLock> stats_;
 };
 
@@ -193,50 +193,139 @@ inline void TryInsertLabelPropertiesIndex(Vertex &vertex, LabelId label, Propert
   index_accessor.insert({props.ApplyPermutation(std::move(values)), &vertex, 0});
 }
 
-bool InMemoryLabelPropertyIndex::CreateIndex(
-    LabelId label, std::vector<PropertyId> const &properties, utils::SkipList<Vertex>::Accessor vertices,
-    const std::optional<durability::ParallelizedSchemaCreationInfo> &parallel_exec_info,
-    std::optional<SnapshotObserverInfo> const &snapshot_info) {
-  spdlog::trace("Vertices size when creating index: {}", vertices.size());
+/// Variant of `TryInsertLabelPropertiesIndex` used while other transactions may be modifying the vertex. Any version
+/// that is still reachable through the delta chain might be visible to some active transaction, so the values of
+/// every such version that has the label are inserted. Surplus entries are cleaned up by the index GC.
+inline void TryInsertLabelPropertiesIndexConcurrently(Vertex &vertex, LabelId label,
+                                                      PropertiesPermutationHelper const &props,
+                                                      auto &&index_accessor) {
+  bool deleted{false};
+  bool has_label{false};
+  std::vector<PropertyValue> values;
+  Delta const *delta{nullptr};
+  {
+    auto const guard = std::shared_lock{vertex.lock};
+    deleted = vertex.deleted;
+    has_label = utils::Contains(vertex.labels, label);
+    values = props.Extract(vertex.properties);
+    delta = vertex.delta;
+  }
 
-  auto [it1, _] = index_.try_emplace(label);
-  auto &properties_map = it1->second;
-  auto helper = PropertiesPermutationHelper{properties};
-  auto [it2, emplaced] = properties_map.try_emplace(properties, std::move(helper));
-  if (!emplaced) {
-    // Index already exists.
-    return false;
+  auto const insert_version = [&] {
+    if (deleted || !has_label) return;
+    if (r::all_of(values, [](auto const &each) { return each.IsNull(); })) return;
+    index_accessor.insert({props.ApplyPermutation(values), &vertex, 0});
+  };
+
+  insert_version();
+  // Deltas reachable from the vertex can't be freed while this transaction is active.
+  for (; delta != nullptr; delta = delta->next.load(std::memory_order_acquire)) {
+    switch (delta->action) {
+      case Delta::Action::ADD_LABEL:
+        if (delta->label.value != label) continue;
+        has_label = true;
+        break;
+      case Delta::Action::REMOVE_LABEL:
+        if (delta->label.value != label) continue;
+        has_label = false;
+        break;
+      case Delta::Action::SET_PROPERTY: {
+        auto const pos = props.ExtractedPosition(delta->property.key);
+        if (!pos) continue;
+        values[*pos] = *delta->property.value;
+        break;
+      }
+      case Delta::Action::RECREATE_OBJECT:
+        deleted = false;
+        break;
+      case Delta::Action::DELETE_DESERIALIZED_OBJECT:
+      case Delta::Action::DELETE_OBJECT:
+        deleted = true;
+        break;
+      case Delta::Action::ADD_IN_EDGE:
+      case Delta::Action::ADD_OUT_EDGE:
+      case Delta::Action::REMOVE_IN_EDGE:
+      case Delta::Action::REMOVE_OUT_EDGE:
+        continue;
+    }
+    insert_version();
   }
+}
 
-  auto const &properties_key = it2->first;
-  auto &index = it2->second;
+template <typename TFunc>
+bool InMemoryLabelPropertyIndex::CreateIndexImpl(
+    LabelId label, std::vector<PropertyId> const &properties, utils::SkipList<Vertex>::Accessor vertices,
+    TFunc const &func, const std::optional<durability::ParallelizedSchemaCreationInfo> &parallel_exec_info,
+    std::optional<SnapshotObserverInfo> const &snapshot_info, bool const concurrent) {
+  spdlog::trace("Vertices size when creating index: {}", vertices.size());
 
-  auto de = EntryDetail{&properties_key, &index};
-  for (auto prop : properties) {
-    indices_by_property_[prop].insert({label, de});
+  IndividualIndex *index = nullptr;
+  {
+    auto locked_indices = index_.Lock();
+    auto [it1, _] = locked_indices->by_label.try_emplace(label);
+    auto &properties_map = it1->second;
+    auto helper = PropertiesPermutationHelper{properties};
+    auto [it2, emplaced] = properties_map.try_emplace(properties, std::move(helper));
+    index = &it2->second;
+    if (!emplaced) {
+      if (!index->failed) {
+        // Index already exists.
+        return false;
+      }
+      index->failed = false;
+    } else {
+      auto de = EntryDetail{&it2->first, index};
+      for (auto prop : properties) {
+        locked_indices->by_property[prop].insert({label, de});
+      }
+    }
   }
 
   try {
-    auto &index_skip_list = it2->second.skiplist;
-    auto accessor_factory = [&] { return index_skip_list.access(); };
-    auto &props_permutation_helper = it2->second.permutations_helper;
+    auto accessor_factory = [&] { return index->skiplist.access(); };
+    auto const &props_permutation_helper = index->permutations_helper;
     auto const try_insert_into_index = [&](Vertex &vertex, auto &index_accessor) {
-      TryInsertLabelPropertiesIndex(vertex, label, props_permutation_helper, index_accessor);
+      func(vertex, props_permutation_helper, index_accessor);
     };
     PopulateIndex(vertices, accessor_factory, try_insert_into_index, parallel_exec_info, snapshot_info);
   } catch (const utils::OutOfMemoryException &) {
     utils::MemoryTracker::OutOfMemoryExceptionBlocker const oom_exception_blocker;
-    properties_map.erase(it2);
+    if (concurrent) {
+      index_.WithLock([index](auto & /*indices*/) { index->failed = true; });
+    } else {
+      DropIndexLocked(*index_.Lock(), label, properties);
+    }
     throw;
   }
 
+  index_.WithLock([index](auto & /*indices*/) { index->ready = true; });
   return true;
 }
 
+bool InMemoryLabelPropertyIndex::CreateIndex(
+    LabelId label, std::vector<PropertyId> const &properties, utils::SkipList<Vertex>::Accessor vertices,
+    const std::optional<durability::ParallelizedSchemaCreationInfo> &parallel_exec_info,
+    std::optional<SnapshotObserverInfo> const &snapshot_info) {
+  auto const func = [&](Vertex &vertex, PropertiesPermutationHelper const &helper, auto &index_accessor) {
+    TryInsertLabelPropertiesIndex(vertex, label, helper, index_accessor);
+  };
+  return CreateIndexImpl(label, properties, std::move(vertices), func, parallel_exec_info, snapshot_info, false);
+}
+
+bool InMemoryLabelPropertyIndex::CreateIndexConcurrently(
+    LabelId label, std::vector<PropertyId> const &properties, utils::SkipList<Vertex>::Accessor vertices,
+    const std::optional<durability::ParallelizedSchemaCreationInfo> &parallel_exec_info) {
+  auto const func = [&](Vertex &vertex, PropertiesPermutationHelper const &helper, auto &index_accessor) {
+    TryInsertLabelPropertiesIndexConcurrently(vertex, label, helper, index_accessor);
+  };
+  return CreateIndexImpl(label, properties, std::move(vertices), func, parallel_exec_info, std::nullopt, true);
+}
+
 void InMemoryLabelPropertyIndex::UpdateOnAddLabel(LabelId added_label, Vertex *vertex_after_update,
                                                   const Transaction &tx) {
-  auto const it = index_.find(added_label);
-  if (it == index_.end()) {
+  auto locked_indices = index_.MutableSharedLock();
+  auto const it = locked_indices->by_label.find(added_label);
+  if (it == locked_indices->by_label.end()) {
     return;
   }
 
@@ -260,8 +349,9 @@ void InMemoryLabelPropertyIndex::UpdateOnAddLabel(LabelId added_label, Vertex *v
 
 void InMemoryLabelPropertyIndex::UpdateOnSetProperty(PropertyId property, const PropertyValue &value, Vertex *vertex,
                                                      const Transaction &tx) {
-  auto const it = indices_by_property_.find(property);
-  if (it == indices_by_property_.end()) {
+  auto locked_indices = index_.MutableSharedLock();
+  auto const it = locked_indices->by_property.find(property);
+  if (it == locked_indices->by_property.end()) {
     return;
   }
 
@@ -282,9 +372,14 @@ void InMemoryLabelPropertyIndex::UpdateOnSetProperty(PropertyId property, const
 }
 
 bool InMemoryLabelPropertyIndex::DropIndex(LabelId label, std::vector<PropertyId> const &properties) {
+  return DropIndexLocked(*index_.Lock(), label, properties);
+}
+
+bool InMemoryLabelPropertyIndex::DropIndexLocked(Indices &indices, LabelId label,
+                                                 std::vector<PropertyId> const &properties) {
   // find the primary index
-  auto it1 = index_.find(label);
-  if (it1 == index_.end()) {
+  auto it1 = indices.by_label.find(label);
+  if (it1 == indices.by_label.end()) {
     return false;
   }
 
@@ -297,8 +392,8 @@ bool InMemoryLabelPropertyIndex::DropIndex(LabelId label, std::vector<PropertyId
   // cleanup the auxiliary indexes
   // MUST be done before removal of primary index entries
   for (auto prop : properties) {
-    auto it3 = indices_by_property_.find(prop);
-    if (it3 == indices_by_property_.end()) continue;
+    auto it3 = indices.by_property.find(prop);
+    if (it3 == indices.by_property.end()) continue;
 
     auto &label_map = it3->second;
     auto [b, e] = label_map.equal_range(label);
@@ -312,7 +407,7 @@ bool InMemoryLabelPropertyIndex::DropIndex(LabelId label, std::vector<PropertyId
       }
     }
     if (label_map.empty()) {
-      indices_by_property_.erase(it3);
+      indices.by_property.erase(it3);
     }
   }
 
@@ -373,16 +468,18 @@ bool InMemoryLabelPropertyIndex::DropIndex(LabelId label, std::vector<PropertyId
   // Do the actual removal from the primary index
   properties_map.erase(it2);
   if (properties_map.empty()) {
-    index_.erase(it1);
+    indices.by_label.erase(it1);
   }
 
   return true;
 }
 
 bool InMemoryLabelPropertyIndex::IndexExists(LabelId label, std::span<PropertyId const> properties) const {
-  auto it = index_.find(label);
-  if (it != index_.end()) {
-    return it->second.contains(properties);
+  auto const locked_indices = index_.ReadLock();
+  auto it = locked_indices->by_label.find(label);
+  if (it != locked_indices->by_label.end()) {
+    auto it2 = it->second.find(properties);
+    return it2 != it->second.end() && it2->second.ready;
   }
 
   return false;
@@ -421,11 +518,13 @@ auto InMemoryLabelPropertyIndex::RelevantLabelPropertiesIndicesInfo(std::span<La
   r::sort(rv::zip(properties_vec, ppos_indices), std::less{},
           [](auto const &val) -> PropertyId const & { return std::get<0>(val); });
 
+  auto const locked_indices = index_.ReadLock();
   for (auto [l_pos, label] : ranges::views::enumerate(labels)) {
-    auto it = index_.find(label);
-    if (it == index_.end()) continue;
+    auto it = locked_indices->by_label.find(label);
+    if (it == locked_indices->by_label.end()) continue;
 
-    for (auto const &props : it->second | std::ranges::views::keys) {
+    for (auto const &[props, index] : it->second) {
+      if (!index.ready) continue;
       bool has_matching_property = false;
       auto positions = std::vector<int64_t>();
       for (auto prop : props) {
@@ -451,13 +550,15 @@ auto InMemoryLabelPropertyIndex::RelevantLabelPropertiesIndicesInfo(std::span<La
 std::vector<std::pair<LabelId, std::vector<PropertyId>>> InMemoryLabelPropertyIndex::ListIndices() const {
   std::vector<std::pair<LabelId, std::vector<PropertyId>>> ret;
 
+  auto const locked_indices = index_.ReadLock();
   auto const num_indexes =
-      std::accumulate(index_.cbegin(), index_.cend(), size_t{},
+      std::accumulate(locked_indices->by_label.cbegin(), locked_indices->by_label.cend(), size_t{},
                       [](auto sum, auto const &label_map) { return sum + label_map.second.size(); });
 
   ret.reserve(num_indexes);
-  for (auto const &[label, indices] : index_) {
-    for (auto const &props : indices | std::views::keys) {
+  for (auto const &[label, indices] : locked_indices->by_label) {
+    for (auto const &[props, index] : indices) {
+      if (!index.ready) continue;
       ret.emplace_back(label, props);
     }
   }
@@ -467,7 +568,8 @@ std::vector<std::pair<LabelId, std::vector<PropertyId>>> InMemoryLabelPropertyIn
 void InMemoryLabelPropertyIndex::RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp, std::stop_token token) {
   auto maybe_stop = utils::ResettableCounter(2048);
 
-  for (auto &[label_id, by_properties] : index_) {
+  auto locked_indices = index_.MutableSharedLock();
+  for (auto &[label_id, by_properties] : locked_indices->by_label) {
     for (auto &[property_ids, index] : by_properties) {
       // before starting index, check if stop_requested
       if (token.stop_requested()) return;
@@ -745,8 +847,9 @@ InMemoryLabelPropertyIndex::Iterable::Iterator InMemoryLabelPropertyIndex::Itera
 
 uint64_t InMemoryLabelPropertyIndex::ApproximateVertexCount(LabelId label,
                                                             std::span<PropertyId const> properties) const {
-  auto it = index_.find(label);
-  MG_ASSERT(it != index_.end(), "Index for label {} and properties {} doesn't exist", label.AsUint(),
+  auto const locked_indices = index_.ReadLock();
+  auto it = locked_indices->by_label.find(label);
+  MG_ASSERT(it != locked_indices->by_label.end(), "Index for label {} and properties {} doesn't exist", label.AsUint(),
             JoinPropertiesAsString(properties));
   auto it2 = it->second.find(properties);
   MG_ASSERT(it2 != it->second.end(), "Index for label {} and properties {} doesn't exist", label.AsUint(),
@@ -756,8 +859,9 @@ uint64_t InMemoryLabelPropertyIndex::ApproximateVertexCount(LabelId label,
 
 uint64_t InMemoryLabelPropertyIndex::ApproximateVertexCount(LabelId label, std::span<PropertyId const> properties,
                                                             std::span<PropertyValue const> values) const {
-  auto const it = index_.find(label);
-  MG_ASSERT(it != index_.end(), "Index for label {} and properties {} doesn't exist", label.AsUint(),
+  auto const locked_indices = index_.ReadLock();
+  auto const it = locked_indices->by_label.find(label);
+  MG_ASSERT(it != locked_indices->by_label.end(), "Index for label {} and properties {} doesn't exist", label.AsUint(),
             JoinPropertiesAsString(properties));
 
   auto const it2 = it->second.find(properties);
@@ -783,8 +887,9 @@ uint64_t InMemoryLabelPropertyIndex::ApproximateVertexCount(LabelId label, std::
 
 uint64_t InMemoryLabelPropertyIndex::ApproximateVertexCount(LabelId label, std::span<PropertyId const> properties,
                                                             std::span<PropertyValueRange const> bounds) const {
-  auto const it = index_.find(label);
-  MG_ASSERT(it != index_.end(), "Index for label {} and properties {} doesn't exist", label.AsUint(),
+  auto const locked_indices = index_.ReadLock();
+  auto const it = locked_indices->by_label.find(label);
+  MG_ASSERT(it != locked_indices->by_label.end(), "Index for label {} and properties {} doesn't exist", label.AsUint(),
             JoinPropertiesAsString(properties));
 
   auto const it2 = it->second.find(properties);
@@ -864,7 +969,8 @@ std::optional<storage::LabelPropertyIndexStats> InMemoryLabelPropertyIndex::GetI
 }
 
 void InMemoryLabelPropertyIndex::RunGC() {
-  for (auto &per_label : index_ | std::views::values) {
+  auto locked_indices = index_.MutableSharedLock();
+  for (auto &per_label : locked_indices->by_label | std::views::values) {
     for (auto &per_properties : per_label | std::views::values) {
       per_properties.skiplist.run_gc();
     }
@@ -880,8 +986,9 @@ InMemoryLabelPropertyIndex::Iterable InMemoryLabelPropertyIndex::Vertices(LabelI
                  storage->storage_mode_ == StorageMode::IN_MEMORY_ANALYTICAL,
              "PropertyLabel index trying to access InMemory vertices from OnDisk!");
   auto vertices_acc = static_cast<InMemoryStorage const *>(storage)->vertices_.access();
-  auto it = index_.find(label);
-  DMG_ASSERT(it != index_.end(), "Index for label {} and properties {} doesn't exist", label.AsUint(),
+  auto locked_indices = index_.MutableSharedLock();
+  auto it = locked_indices->by_label.find(label);
+  DMG_ASSERT(it != locked_indices->by_label.end(), "Index for label {} and properties {} doesn't exist", label.AsUint(),
              JoinPropertiesAsString(properties));
   auto it2 = it->second.find(properties);
   DMG_ASSERT(it2 != it->second.end(), "Index for label {} and properties {} doesn't exist", label.AsUint(),
@@ -902,8 +1009,9 @@ InMemoryLabelPropertyIndex::Iterable InMemoryLabelPropertyIndex::Vertices(
     LabelId label, std::span<PropertyId const> properties, std::span<PropertyValueRange const> range,
     memgraph::utils::SkipList<memgraph::storage::Vertex>::ConstAccessor vertices_acc, View view, Storage *storage,
     Transaction *transaction) {
-  auto it = index_.find(label);
-  MG_ASSERT(it != index_.end(), "Index for label {} and properties {} doesn't exist", label.AsUint(),
+  auto locked_indices = index_.MutableSharedLock();
+  auto it = locked_indices->by_label.find(label);
+  MG_ASSERT(it != locked_indices->by_label.end(), "Index for label {} and properties {} doesn't exist", label.AsUint(),
             JoinPropertiesAsString(properties));
   auto it2 = it->second.find(properties);
   MG_ASSERT(it2 != it->second.end(), "Index for label {} and properties {} doesn't exist", label.AsUint(),
@@ -921,14 +1029,17 @@ InMemoryLabelPropertyIndex::Iterable InMemoryLabelPropertyIndex::Vertices(
 }
 
 void InMemoryLabelPropertyIndex::DropGraphClearIndices() {
-  index_.clear();
-  indices_by_property_.clear();
+  auto locked_indices = index_.Lock();
+  locked_indices->by_label.clear();
+  locked_indices->by_property.clear();
   stats_->clear();
 }
 
 auto InMemoryLabelPropertyIndex::GetAbortProcessor() const -> LabelPropertyIndex::AbortProcessor {
   AbortProcessor res{};
-  for (const auto &[label, per_properties] : index_) {
+  // Indices that are still being populated are included, they might hold entries inserted by this transaction.
+  auto const locked_indices = index_.ReadLock();
+  for (const auto &[label, per_properties] : locked_indices->by_label) {
     for (auto const &[props, index] : per_properties) {
       for (auto const &prop : props) {
         res.l2p[label][prop].emplace_back(&props, &index.permutations_helper);
@@ -940,9 +1051,10 @@ auto InMemoryLabelPropertyIndex::GetAbortProcessor() const -> LabelPropertyIndex
 }
 
 void InMemoryLabelPropertyIndex::AbortEntries(AbortableInfo const &info, uint64_t start_timestamp) {
+  auto locked_indices = index_.MutableSharedLock();
   for (auto const &[label, by_properties] : info) {
-    auto it = index_.find(label);
-    DMG_ASSERT(it != index_.end());
+    auto it = locked_indices->by_label.find(label);
+    DMG_ASSERT(it != locked_indices->by_label.end());
     for (auto const &[prop, to_remove] : by_properties) {
       auto it2 = it->second.find(*prop);
       DMG_ASSERT(it2 != it->second.end());
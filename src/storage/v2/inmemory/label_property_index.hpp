@@ -20,6 +20,7 @@
 #include "storage/v2/property_value.hpp"
 #include "storage/v2/snapshot_observer_info.hpp"
 #include "utils/rw_lock.hpp"
+#include "utils/rw_spin_lock.hpp"
 #include "utils/synchronized.hpp"
 
 namespace memgraph::storage {
@@ -46,6 +47,15 @@ class InMemoryLabelPropertyIndex : public storage::LabelPropertyIndex {
                    const std::optional<durability::ParallelizedSchemaCreationInfo> &it,
                    std::optional<SnapshotObserverInfo> const &snapshot_info = std::nullopt);
 
+  /// Creates the index while other transactions keep writing. Concurrent label and property changes are captured
+  /// from the moment the index is registered, the scan inserts the values of every vertex version still reachable
+  /// from its delta chain, and the index is only reported as existing once the scan is done.
+  /// With `parallel_exec_info`, the scan runs on multiple threads; its batches must allow vertices to change.
+  /// @throw std::bad_alloc
+  bool CreateIndexConcurrently(LabelId label, std::vector<PropertyId> const &properties,
+                               utils::SkipList<Vertex>::Accessor vertices,
+                               const std::optional<durability::ParallelizedSchemaCreationInfo> &parallel_exec_info);
+
   /// @throw std::bad_alloc
   void UpdateOnAddLabel(LabelId added_label, Vertex *vertex_after_update, const Transaction &tx) override;
 
@@ -153,9 +163,22 @@ class InMemoryLabelPropertyIndex : public storage::LabelPropertyIndex {
   struct IndividualIndex {
     PropertiesPermutationHelper permutations_helper;
     utils::SkipList<Entry> skiplist;
+    // An index that is still being populated already captures new writes, but it isn't reported as existing until
+    // it has seen every vertex.
+    bool ready{false};
+    // Population built next to writers ran out of memory. Writers may still reach the index through their abort
+    // processors, so it stays registered until it is dropped under unique access; creating it again carries on
+    // populating it, since the entries it holds are valid.
+    bool failed{false};
   };
 
  private:
+  template <typename TFunc>
+  bool CreateIndexImpl(LabelId label, std::vector<PropertyId> const &properties,
+                       utils::SkipList<Vertex>::Accessor vertices, TFunc const &func,
+                       const std::optional<durability::ParallelizedSchemaCreationInfo> &parallel_exec_info,
+                       std::optional<SnapshotObserverInfo> const &snapshot_info, bool concurrent);
+
   struct Compare {
     template <std::ranges::forward_range T, std::ranges::forward_range U>
     bool operator()(T const &lhs, U const &rhs) const {
@@ -166,11 +189,19 @@ class InMemoryLabelPropertyIndex : public storage::LabelPropertyIndex {
   };
 
   using PropertiesIndices = std::map<PropertiesIds, IndividualIndex, Compare>;
-  std::map<LabelId, PropertiesIndices, std::less<>> index_;
-
   using EntryDetail = std::tuple<PropertiesIds const *, IndividualIndex *>;
   using PropToIndexLookup = std::multimap<LabelId, EntryDetail>;
-  std::unordered_map<PropertyId, PropToIndexLookup> indices_by_property_;
+
+  struct Indices {
+    std::map<LabelId, PropertiesIndices, std::less<>> by_label;
+    std::unordered_map<PropertyId, PropToIndexLookup> by_property;
+  };
+
+  bool DropIndexLocked(Indices &indices, LabelId label, std::vector<PropertyId> const &properties);
+
+  // Registration of new indices may run concurrently with writers, hence the lock. Entries are only ever erased
+  // under unique storage access, so references into the maps stay valid after the lock is released.
+  utils::Synchronized<Indices, utils::RWSpinLock> index_;
 
   using PropertiesIndicesStats = std::map<PropertiesIds, storage::LabelPropertyIndexStats, Compare>;
   utils::Synchronized<std::map<LabelId, PropertiesIndicesStats>, utils::ReadPrioritizedRWLock> stats_;
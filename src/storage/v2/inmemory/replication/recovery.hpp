@@ -1,4 +1,4 @@
-// Copyright 2025 Memgraph Ltd.
+// Copyright 2026 Memgraph Ltd.
 //
 // Use of this software is governed by the Business Source License
 // included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -57,6 +57,9 @@ std::enable_if_t<std::is_same_v<T, std::vector<std::filesystem::path>>, bool> Wr
   return true;
 }
 
+// TODO: Resume an interrupted transfer from the last offset the replica acknowledged instead of sending the whole
+// files again. The replica would have to report its partially received files in a new handshake.
+// TODO: Send the chunks of large files over several RPC streams in parallel. rpc::Client has one stream per replica.
 template <rpc::IsRpc T, typename R, typename... Args>
 std::optional<typename T::Response> TransferDurabilityFiles(const R &files, rpc::Client &client,
                                                             replication_coordination_glue::ReplicationMode mode,
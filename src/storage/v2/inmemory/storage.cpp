@@ -32,6 +32,7 @@
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/indices/edge_property_index.hpp"
 #include "storage/v2/indices/edge_type_property_index.hpp"
+#include "storage/v2/indices/indices_utils.hpp"
 #include "storage/v2/indices/point_index.hpp"
 #include "storage/v2/inmemory/edge_property_index.hpp"
 #include "storage/v2/inmemory/edge_type_index.hpp"
@@ -51,6 +52,7 @@
 #include "storage/v2/storage_mode.hpp"
 #include "utils/atomic_memory_block.hpp"
 #include "utils/event_gauge.hpp"
+#include "utils/event_labeled_histogram.hpp"
 #include "utils/exceptions.hpp"
 #include "utils/file.hpp"
 #include "utils/on_scope_exit.hpp"
@@ -62,6 +64,7 @@
 
 namespace memgraph::metrics {
 extern const Event PeakMemoryRes;
+extern const Event GcLatency_us;
 }  // namespace memgraph::metrics
 
 namespace memgraph::storage {
@@ -712,6 +715,13 @@ utils::BasicResult<StorageManipulationError, void> InMemoryStorage::InMemoryAcce
     // Save these so we can mark them used in the commit log.
     uint64_t start_timestamp = transaction_.start_timestamp;
 
+    // Gathered outside of the engine lock, only handed over under it
+    std::optional<durability::SnapshotChanges::Modified> snapshot_changes;
+    if (mem_storage->config_.durability.snapshot_incremental_layers > 0 &&
+        (reparg.IsMain() || reparg.desired_commit_timestamp.has_value())) {
+      snapshot_changes.emplace(CollectSnapshotChanges(transaction_));
+    }
+
     {
       auto engine_guard = std::unique_lock{storage_->engine_lock_};
 
@@ -811,6 +821,11 @@ utils::BasicResult<StorageManipulationError, void> InMemoryStorage::InMemoryAcce
                                                          mem_storage->config_.salient.items.properties_on_edges);
           }
 
+          // Handed over before the engine lock is released, so a snapshot which sees this commit also sees the changes
+          if (snapshot_changes) {
+            mem_storage->pending_snapshot_changes_->emplace_back(*std::move(snapshot_changes), *commit_timestamp_);
+          }
+
           // TODO: release lock, and update all deltas to have a local copy of the commit timestamp
           MG_ASSERT(transaction_.commit_timestamp != nullptr, "Invalid database state!");
           transaction_.commit_timestamp->store(*commit_timestamp_, std::memory_order_release);
@@ -857,6 +872,11 @@ utils::BasicResult<StorageManipulationError, void> InMemoryStorage::InMemoryAcce
       return StorageManipulationError{*unique_constraint_violation};
     }
 
+    if (snapshot_changes && mem_storage->pending_snapshot_changes_->size() >= kMaxPendingSnapshotChanges) {
+      mem_storage->snapshot_changes_.WithLock(
+          [mem_storage](auto &changes) { mem_storage->AddPendingSnapshotChanges(&changes); });
+    }
+
     if (flags::AreExperimentsEnabled(flags::Experiments::TEXT_SEARCH)) {
       mem_storage->indices_.text_index_.Commit();
     }
@@ -968,7 +988,7 @@ void InMemoryStorage::InMemoryAccessor::GCRapidDeltaCleanup(std::list<Gid> &curr
   unlink_remove_clear(transaction_.deltas);
 }
 
-void InMemoryStorage::InMemoryAccessor::FastDiscardOfDeltas(std::unique_lock<std::mutex> /*gc_guard*/) {
+void InMemoryStorage::InMemoryAccessor::FastDiscardOfDeltas(std::unique_lock<gc_lock_t> /*gc_guard*/) {
   auto *mem_storage = static_cast<InMemoryStorage *>(storage_);
 
   // STEP 1 + STEP 2 - delta cleanup
@@ -1378,11 +1398,19 @@ void InMemoryStorage::InMemoryAccessor::FinalizeTransaction() {
 utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::InMemoryAccessor::CreateIndex(
     LabelId label, bool unique_access_needed) {
   if (unique_access_needed) {
-    MG_ASSERT(type() == UNIQUE, "Creating label index requires a unique access to the storage!");
+    MG_ASSERT(type() == UNIQUE || type() == READ,
+              "Creating label index requires a unique or read access to the storage!");
   }
   auto *in_memory = static_cast<InMemoryStorage *>(storage_);
   auto *mem_label_index = static_cast<InMemoryLabelIndex *>(in_memory->indices_.label_index_.get());
-  if (!mem_label_index->CreateIndex(label, in_memory->vertices_.access(), std::nullopt)) {
+  // Without unique access other transactions may be writing, the index has to be built online
+  auto const unique = type() == UNIQUE;
+  auto const parallel_exec_info = in_memory->GetIndexCreationExecInfo(!unique);
+  auto const created = unique
+                           ? mem_label_index->CreateIndex(label, in_memory->vertices_.access(), parallel_exec_info)
+                           : mem_label_index->CreateIndexConcurrently(label, in_memory->vertices_.access(),
+                                                                      parallel_exec_info);
+  if (!created) {
     return StorageIndexDefinitionError{IndexDefinitionError{}};
   }
   transaction_.md_deltas.emplace_back(MetadataDelta::label_index_create, label);
@@ -1393,11 +1421,19 @@ utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::InMemoryA
 
 utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::InMemoryAccessor::CreateIndex(
     LabelId label, std::vector<storage::PropertyId> &&properties) {
-  MG_ASSERT(type() == UNIQUE, "Creating label-property index requires a unique access to the storage!");
+  MG_ASSERT(type() == UNIQUE || type() == READ,
+            "Creating label-property index requires a unique or read access to the storage!");
   auto *in_memory = static_cast<InMemoryStorage *>(storage_);
   auto *mem_label_property_index =
       static_cast<InMemoryLabelPropertyIndex *>(in_memory->indices_.label_property_index_.get());
-  if (!mem_label_property_index->CreateIndex(label, properties, in_memory->vertices_.access(), std::nullopt)) {
+  // Without unique access other transactions may be writing, the index has to be built online
+  auto const unique = type() == UNIQUE;
+  auto const parallel_exec_info = in_memory->GetIndexCreationExecInfo(!unique);
+  auto const created = unique ? mem_label_property_index->CreateIndex(label, properties, in_memory->vertices_.access(),
+                                                                      parallel_exec_info)
+                              : mem_label_property_index->CreateIndexConcurrently(
+                                    label, properties, in_memory->vertices_.access(), parallel_exec_info);
+  if (!created) {
     return StorageIndexDefinitionError{IndexDefinitionError{}};
   }
   transaction_.md_deltas.emplace_back(MetadataDelta::label_property_index_create, label, std::move(properties));
@@ -1797,6 +1833,8 @@ void InMemoryStorage::SetStorageMode(StorageMode new_storage_mode) {
       snapshot_runner_.Resume();
     }
     storage_mode_ = new_storage_mode;
+    // Analytical mode doesn't produce deltas, so its changes can't be tracked
+    snapshot_changes_->MarkFullSnapshotNeeded();
     FreeMemory(std::move(main_guard), false);
   }
 }
@@ -1844,8 +1882,12 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ResourceLock> main_
 
   // Diagnostic trace
   spdlog::trace("Storage GC on '{}' started [{}]", name(), periodic ? "periodic" : "forced");
-  auto trace_on_exit = utils::OnScopeExit{
-      [&] { spdlog::trace("Storage GC on '{}' finished [{}]", name(), periodic ? "periodic" : "forced"); }};
+  const utils::Timer gc_timer;
+  auto trace_on_exit = utils::OnScopeExit{[&] {
+    metrics::MeasureLabeled(metrics::GcLatency_us, {name()},
+                            std::chrono::duration_cast<std::chrono::microseconds>(gc_timer.Elapsed()).count());
+    spdlog::trace("Storage GC on '{}' finished [{}]", name(), periodic ? "periodic" : "forced");
+  }};
 
   // Garbage collection must be performed in two phases. In the first phase,
   // deltas that won't be applied by any transaction anymore are unlinked from
@@ -2639,12 +2681,39 @@ utils::BasicResult<InMemoryStorage::CreateSnapshotError> InMemoryStorage::Create
     last_snapshot_digest_ = std::move(current_digest);
   }
 
-  // At the moment, the only way in which create snapshot can fail is if it got aborted
-  if (!durability::CreateSnapshot(this, transaction, recovery_.snapshot_directory_, recovery_.wal_directory_,
-                                  &vertices_, &edges_, storage_uuid, epoch, epochHistory, &file_retainer_,
-                                  &abort_snapshot_)) {
-    return CreateSnapshotError::AbortSnapshot;
+  // Changes committed before this transaction started are all visible to it; the rest are left for the next snapshot
+  auto changes = snapshot_changes_.WithLock([&](auto &tracked) {
+    AddPendingSnapshotChanges(&tracked);
+    auto visible = std::move(tracked);
+    tracked = visible.CommittedAfter(transaction->start_timestamp);
+    return visible;
+  });
+  auto restore_changes = utils::OnScopeExit([&] { snapshot_changes_->Merge(std::move(changes)); });
+
+  auto const durable_timestamp = *transaction->last_durable_ts_;
+  auto const incremental = transaction->storage_mode == StorageMode::IN_MEMORY_TRANSACTIONAL &&
+                           !changes.full_snapshot_needed && incremental_snapshot_chain_ &&
+                           incremental_snapshot_chain_->layers < config_.durability.snapshot_incremental_layers;
+  if (incremental) {
+    if (!durability::CreateIncrementalSnapshot(this, transaction, recovery_.snapshot_directory_, &vertices_, &edges_,
+                                               changes, incremental_snapshot_chain_->durable_timestamp, storage_uuid,
+                                               epoch, &abort_snapshot_)) {
+      return CreateSnapshotError::AbortSnapshot;
+    }
+    incremental_snapshot_chain_->durable_timestamp = durable_timestamp;
+    ++incremental_snapshot_chain_->layers;
+  } else {
+    // At the moment, the only way in which create snapshot can fail is if it got aborted
+    if (!durability::CreateSnapshot(this, transaction, recovery_.snapshot_directory_, recovery_.wal_directory_,
+                                    &vertices_, &edges_, storage_uuid, epoch, epochHistory, &file_retainer_,
+                                    &abort_snapshot_)) {
+      return CreateSnapshotError::AbortSnapshot;
+    }
+    // Layers on top of the previous full snapshot are obsolete now
+    durability::DeleteIncrementalSnapshots(recovery_.snapshot_directory_, &file_retainer_);
+    incremental_snapshot_chain_.emplace(IncrementalSnapshotChain{.durable_timestamp = durable_timestamp, .layers = 0});
   }
+  restore_changes.Disable();
 
   memgraph::metrics::Measure(memgraph::metrics::SnapshotCreationLatency_us,
                              std::chrono::duration_cast<std::chrono::microseconds>(timer.Elapsed()).count());
@@ -2821,6 +2890,7 @@ void InMemoryStorage::PrepareForNewEpoch() {
     wal_file_.reset();
   }
   repl_storage_state_.TrackLatestHistory();
+  snapshot_changes_->MarkFullSnapshotNeeded();
 }
 
 utils::FileRetainer::FileLockerAccessor::ret_type InMemoryStorage::IsPathLocked() {
@@ -2904,6 +2974,47 @@ void InMemoryStorage::CreateSnapshotHandler(
   });
 }
 
+std::optional<durability::ParallelizedSchemaCreationInfo> InMemoryStorage::GetIndexCreationExecInfo(
+    bool const vertices_may_change) {
+  if (!config_.durability.allow_parallel_schema_creation) {
+    return std::nullopt;
+  }
+  auto vertices_acc = vertices_.access();
+  return MakeParallelExecInfo(vertices_acc, config_.durability.items_per_batch,
+                              config_.durability.recovery_thread_count, vertices_may_change);
+}
+
+durability::SnapshotChanges::Modified InMemoryStorage::CollectSnapshotChanges(const Transaction &transaction) {
+  durability::SnapshotChanges::Modified modified;
+  if (!transaction.md_deltas.empty()) {
+    modified.metadata = true;
+    return modified;
+  }
+  for (const auto &delta : transaction.deltas) {
+    // The newest delta of each object is the one pointing back to the object itself
+    auto prev = delta.prev.Get();
+    switch (prev.type) {
+      case PreviousPtr::Type::VERTEX:
+        modified.vertices.push_back(prev.vertex->gid);
+        break;
+      case PreviousPtr::Type::EDGE:
+        modified.edges.push_back(prev.edge->gid);
+        break;
+      case PreviousPtr::Type::DELTA:
+      case PreviousPtr::Type::NULLPTR:
+        break;
+    }
+  }
+  return modified;
+}
+
+void InMemoryStorage::AddPendingSnapshotChanges(durability::SnapshotChanges *changes) {
+  auto pending = std::exchange(*pending_snapshot_changes_.Lock(), {});
+  for (auto const &[modified, commit_timestamp] : pending) {
+    changes->Add(modified, commit_timestamp);
+  }
+}
+
 std::optional<std::tuple<EdgeRef, EdgeTypeId, Vertex *, Vertex *>> InMemoryStorage::FindEdge(Gid gid) {
   using EdgeInfo = std::optional<std::tuple<EdgeRef, EdgeTypeId, Vertex *, Vertex *>>;
 
@@ -3006,6 +3117,8 @@ void InMemoryStorage::Clear() {
   repl_storage_state_.history.clear();
 
   last_snapshot_digest_ = std::nullopt;
+  *snapshot_changes_.Lock() = durability::SnapshotChanges{};
+  pending_snapshot_changes_->clear();
 }
 
 bool InMemoryStorage::InMemoryAccessor::PointIndexExists(LabelId label, PropertyId property) const {
@@ -3090,6 +3203,8 @@ void InMemoryStorage::InMemoryAccessor::DropGraph() {
   mem_storage->vertices_.clear();
   mem_storage->edges_.clear();
   mem_storage->edge_count_.store(0);
+  *mem_storage->snapshot_changes_.Lock() = durability::SnapshotChanges{};
+  mem_storage->pending_snapshot_changes_->clear();
 
   memory::PurgeUnusedMemory();
 }
@@ -15,6 +15,7 @@
 #include <memory>
 #include <utility>
 #include "flags/run_time_configurable.hpp"
+#include "storage/v2/durability/incremental_snapshot.hpp"
 #include "storage/v2/indices/label_index_stats.hpp"
 #include "storage/v2/inmemory/edge_type_index.hpp"
 #include "storage/v2/inmemory/label_index.hpp"
@@ -32,6 +33,7 @@
 #include "storage/v2/replication/rpc.hpp"
 #include "storage/v2/replication/serialization.hpp"
 #include "storage/v2/transaction.hpp"
+#include "utils/lock_contention.hpp"
 #include "utils/memory.hpp"
 #include "utils/observer.hpp"
 #include "utils/resource_lock.hpp"
@@ -106,6 +108,8 @@ class InMemoryStorage final : public Storage {
 
  public:
   using free_mem_fn = std::function<void(std::unique_lock<utils::ResourceLock>, bool)>;
+  // Spelled out once, so guards of `gc_lock_` also match it when the lock is profiled
+  using gc_lock_t = utils::ProfiledLock<std::mutex, utils::LockClass::GC>;
   enum class CreateSnapshotError : uint8_t {
     DisabledForReplica,
     ReachedMaxNumTries,
@@ -509,7 +513,7 @@ class InMemoryStorage final : public Storage {
 
     /// During commit, in some cases you do not need to hand over deltas to GC
     /// in those cases this method is a light weight way to unlink and discard our deltas
-    void FastDiscardOfDeltas(std::unique_lock<std::mutex> gc_guard);
+    void FastDiscardOfDeltas(std::unique_lock<gc_lock_t> gc_guard);
     void GCRapidDeltaCleanup(std::list<Gid> &current_deleted_edges, std::list<Gid> &current_deleted_vertices,
                              IndexPerformanceTracker &impact_tracker);
     SalientConfig::Items config_;
@@ -597,6 +601,17 @@ class InMemoryStorage final : public Storage {
 
   std::optional<std::tuple<EdgeRef, EdgeTypeId, Vertex *, Vertex *>> FindEdge(Gid gid);
 
+  /// Batches for populating a new index on multiple threads, if parallel schema creation is enabled. Without unique
+  /// access to the storage, `vertices_may_change` has to be set.
+  std::optional<durability::ParallelizedSchemaCreationInfo> GetIndexCreationExecInfo(bool vertices_may_change);
+
+  /// Gathers the objects modified by a transaction, so the next snapshot can be an incremental one. Must be called
+  /// before the commit timestamp is published, while no other transaction can prepend deltas to these objects.
+  static durability::SnapshotChanges::Modified CollectSnapshotChanges(const Transaction &transaction);
+
+  /// Adds the pending changes to `changes`, which has to be snapshot_changes_ locked by the caller
+  void AddPendingSnapshotChanges(durability::SnapshotChanges *changes);
+
   // Main object storage
   utils::SkipList<Vertex> vertices_;
   utils::SkipList<Edge> edges_;
@@ -613,6 +628,20 @@ class InMemoryStorage final : public Storage {
   std::atomic_bool snapshot_running_{false};
   std::atomic_bool abort_snapshot_{false};
 
+  // Objects modified since the last snapshot
+  utils::Synchronized<durability::SnapshotChanges, utils::SpinLock> snapshot_changes_;
+  // Changes handed over by commits under the engine lock and not yet added to snapshot_changes_. When both are
+  // locked, snapshot_changes_ is locked first.
+  utils::Synchronized<std::vector<std::pair<durability::SnapshotChanges::Modified, uint64_t>>, utils::SpinLock>
+      pending_snapshot_changes_;
+  static constexpr size_t kMaxPendingSnapshotChanges = 1024;
+  // Snapshot the next incremental snapshot is applied on top of; guarded by snapshot_lock_
+  struct IncrementalSnapshotChain {
+    uint64_t durable_timestamp;
+    uint64_t layers;
+  };
+  std::optional<IncrementalSnapshotChain> incremental_snapshot_chain_;
+
   std::shared_ptr<utils::Observer<utils::SchedulerInterval>> snapshot_periodic_observer_;
 
   // Sequence number used to keep track of the chain of WALs.
@@ -633,7 +662,7 @@ class InMemoryStorage final : public Storage {
   std::optional<CommitLog> commit_log_;
 
   utils::Scheduler gc_runner_;
-  std::mutex gc_lock_;
+  gc_lock_t gc_lock_;
 
   struct GCDeltas {
     GCDeltas(uint64_t mark_timestamp, delta_container deltas, std::unique_ptr<std::atomic<uint64_t>> commit_timestamp)
@@ -1,4 +1,4 @@
-// Copyright 2024 Memgraph Ltd.
+// Copyright 2025 Memgraph Ltd.
 //
 // Use of this software is governed by the Business Source License
 // included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -14,10 +14,13 @@
 #include <atomic>
 #include <cstdint>
 #include <optional>
+#include <type_traits>
 
 #include "storage/v2/property_value.hpp"
 #include "storage/v2/transaction.hpp"
+#include "storage/v2/vertex.hpp"
 #include "storage/v2/view.hpp"
+#include "utils/lock_contention.hpp"
 #include "utils/rocksdb_serialization.hpp"
 #include "utils/string.hpp"
 
@@ -101,6 +104,9 @@ inline bool PrepareForWrite(Transaction *transaction, TObj *object) {
   }
 
   transaction->must_abort = true;
+#ifdef MG_LOCK_CONTENTION_PROFILE
+  if constexpr (std::is_same_v<TObj, Vertex>) utils::RecordWriteConflict(object->gid.AsUint());
+#endif
   return false;
 }
 
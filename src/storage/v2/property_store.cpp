@@ -11,17 +11,24 @@
 
 #include "storage/v2/property_store.hpp"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <cstring>
 #include <limits>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <optional>
+#include <shared_mutex>
 #include <string>
 #include <string_view>
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/property_value.hpp"
@@ -29,11 +36,20 @@
 #include "utils/cast.hpp"
 #include "utils/compressor.hpp"
 #include "utils/logging.hpp"
+#include "utils/rw_spin_lock.hpp"
 #include "utils/temporal.hpp"
 
 // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_bool(storage_property_store_compression_enabled, false,
             "Controls whether the properties should be compressed in the storage.");
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(storage_property_store_compression_dictionary_enabled, false,
+            "Controls whether compressed properties should use a dictionary trained from the first compressed "
+            "properties, which compresses small records much better.");
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(storage_property_store_shapes_enabled, false,
+            "Controls whether the properties should be stored without their property IDs, which are kept in a shape "
+            "shared by all vertices and edges with the same set of properties.");
 
 namespace memgraph::storage {
 
@@ -348,8 +364,16 @@ class Writer {
 class Reader {
  public:
   Reader(const uint8_t *data, uint32_t size) : data_(data), size_(size) {}
-  Reader(Reader const &other, uint32_t offset, uint32_t size) : data_(other.data_ + offset), size_(size) {
+  // Reader of a SHAPED buffer, which takes the property IDs from the shape, see `kUseShapedBuffer`.
+  Reader(const uint8_t *data, uint32_t size, std::span<PropertyId const> shape)
+      : data_(data), size_(size), shape_(shape), shaped_(true) {}
+  Reader(Reader const &other, uint32_t offset, uint32_t size)
+      : data_(other.data_ + offset), size_(size), shape_(other.shape_), shaped_(other.shaped_) {
     DMG_ASSERT(other.size_ - offset >= size);
+    if (shaped_) {
+      DMG_ASSERT(offset == other.property_begin_, "Shaped readers can only start at the last read property");
+      shape_ = shape_.subspan(other.property_index_);
+    }
   }
 
   std::optional<Metadata> ReadMetadata() {
@@ -493,9 +517,24 @@ class Reader {
     return true;
   }
 
+  // Reads the ID of the property whose metadata was read last.
+  std::optional<uint64_t> ReadPropertyId(Size id_size) {
+    if (!shaped_) return ReadUint(id_size);
+    if (shape_index_ == shape_.size()) return std::nullopt;
+    property_begin_ = pos_ - 1;
+    property_index_ = shape_index_;
+    return shape_[shape_index_++].AsUint();
+  }
+
   uint32_t GetPosition() const { return pos_; }
 
-  void SetPosition(uint32_t pos) { pos_ = pos; }
+  void SetPosition(uint32_t pos) {
+    if (shaped_ && pos != pos_) {
+      DMG_ASSERT(pos == property_begin_, "Shaped readers can only be rewound to the last read property");
+      shape_index_ = property_index_;
+    }
+    pos_ = pos;
+  }
 
  private:
   template <typename T>
@@ -510,6 +549,12 @@ class Reader {
   const uint8_t *data_;
   uint32_t size_ = 0;
   uint32_t pos_ = 0;
+  std::span<PropertyId const> shape_;
+  bool shaped_{false};
+  size_t shape_index_{0};
+  // Position and shape index of the last read property, for rewinding
+  uint32_t property_begin_{0};
+  size_t property_index_{0};
 };
 
 auto CrsToSize(CoordinateReferenceSystem value) -> Size {
@@ -1331,7 +1376,7 @@ enum class ExpectedPropertyStatus {
   auto metadata = reader->ReadMetadata();
   if (!metadata) return ExpectedPropertyStatus::MISSING_DATA;
 
-  auto property_id = reader->ReadUint(metadata->id_size);
+  auto property_id = reader->ReadPropertyId(metadata->id_size);
   if (!property_id) return ExpectedPropertyStatus::MISSING_DATA;
 
   if (*property_id == expected_property.AsUint()) {
@@ -1359,7 +1404,7 @@ enum class ExpectedPropertyStatus {
   auto metadata = reader->ReadMetadata();
   if (!metadata) return {ExpectedPropertyStatus::MISSING_DATA, std::nullopt};
 
-  auto property_id = reader->ReadUint(metadata->id_size);
+  auto property_id = reader->ReadPropertyId(metadata->id_size);
   if (!property_id) return {ExpectedPropertyStatus::MISSING_DATA, std::nullopt};
 
   if (expected_property.AsUint() < property_id) {
@@ -1383,7 +1428,7 @@ enum class ExpectedPropertyStatus {
   auto metadata = reader->ReadMetadata();
   if (!metadata) return ExpectedPropertyStatus::MISSING_DATA;
 
-  auto property_id = reader->ReadUint(metadata->id_size);
+  auto property_id = reader->ReadPropertyId(metadata->id_size);
   if (!property_id) return ExpectedPropertyStatus::MISSING_DATA;
 
   if (*property_id == expected_property.AsUint()) {
@@ -1404,7 +1449,7 @@ enum class ExpectedPropertyStatus {
   auto metadata = reader->ReadMetadata();
   if (!metadata) return ExpectedPropertyStatus::MISSING_DATA;
 
-  auto property_id = reader->ReadUint(metadata->id_size);
+  auto property_id = reader->ReadPropertyId(metadata->id_size);
   if (!property_id) return ExpectedPropertyStatus::MISSING_DATA;
 
   switch (metadata->type) {
@@ -1500,7 +1545,7 @@ enum class ExpectedPropertyStatus {
   auto metadata = reader->ReadMetadata();
   if (!metadata) return ExpectedPropertyStatus::MISSING_DATA;
 
-  auto property_id = reader->ReadUint(metadata->id_size);
+  auto property_id = reader->ReadPropertyId(metadata->id_size);
   if (!property_id) return ExpectedPropertyStatus::MISSING_DATA;
 
   if (!SkipPropertyValue(reader, metadata->type, metadata->payload_size)) return ExpectedPropertyStatus::MISSING_DATA;
@@ -1518,7 +1563,7 @@ enum class ExpectedPropertyStatus {
   auto metadata = reader->ReadMetadata();
   if (!metadata) return std::nullopt;
 
-  auto property_id = reader->ReadUint(metadata->id_size);
+  auto property_id = reader->ReadPropertyId(metadata->id_size);
   if (!property_id) return std::nullopt;
 
   // Special case: TEMPORAL_DATA has a subtype we need to extract
@@ -1542,7 +1587,7 @@ enum class ExpectedPropertyStatus {
   auto metadata = reader->ReadMetadata();
   if (!metadata) return std::nullopt;
 
-  auto property_id = reader->ReadUint(metadata->id_size);
+  auto property_id = reader->ReadPropertyId(metadata->id_size);
   if (!property_id) return std::nullopt;
 
   if (!DecodePropertyValue(reader, metadata->type, metadata->payload_size, value)) return std::nullopt;
@@ -1554,7 +1599,7 @@ enum class ExpectedPropertyStatus {
   auto metadata = reader->ReadMetadata();
   if (!metadata) return std::nullopt;
 
-  auto property_id = reader->ReadUint(metadata->id_size);
+  auto property_id = reader->ReadPropertyId(metadata->id_size);
   if (!property_id) return std::nullopt;
 
   switch (metadata->type) {
@@ -1620,7 +1665,7 @@ enum class ExpectedPropertyStatus {
   auto metadata = reader->ReadMetadata();
   if (!metadata) return false;
 
-  auto property_id = reader->ReadUint(metadata->id_size);
+  auto property_id = reader->ReadPropertyId(metadata->id_size);
   if (!property_id) return false;
   if (*property_id != expected_property.AsUint()) return false;
 
@@ -1815,18 +1860,65 @@ uint32_t ToMultipleOf8(uint32_t size) {
 // of the two sets of data is currently active. Because the first byte of the
 // buffer is used to distinguish which of the two sets of data is used, we can
 // only use the leftover 15 bytes for raw data storage.
+//
+// Uncompressed buffers with at least `kPropertyDirectoryMinProperties`
+// properties are stored with a property directory (`kUseIndexedBuffer`), which
+// allows a single property to be found with a binary search instead of
+// decoding all of the properties before it:
+//
+// Memory (hex):
+// 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00
+// |-----------------|                             -> encoded properties
+//                     |---|                       -> tombstone & padding
+//                           |---------------|     -> uint16_t offset of each property
+//                                             |---| -> uint16_t number of properties
+//
+// The encoded properties are identical to a regular buffer, so everything
+// which reads all of the properties is unaffected by the directory.
+//
+// When `--storage-property-store-shapes-enabled` is set, uncompressed buffers
+// are stored without their property IDs (`kUseShapedBuffer`) whenever that
+// makes them smaller. The ordered list of property IDs, the shape, is interned
+// once and shared by all of the stores with the same set of properties, which
+// is the common case for vertices with the same label:
+//
+// Memory (hex):
+// 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00
+// |---|                                           -> uint16_t shape ID
+//       |-----------------------|                 -> metadata & value of each property, in shape order
+//                                 |---|           -> padding
+//                                       |-------| -> uint16_t offset of each property
+//
+// The property ID size of the metadata isn't used. The values are read in
+// place, with their property IDs taken from the shape. Like the property
+// directory, the offsets are only stored when there are at least
+// `kPropertyDirectoryMinProperties` properties. Shaped buffers are expanded
+// back into the regular encoding before they are modified.
 static_assert(std::endian::native == std::endian::little, "Our code assumes little endian");
 
 const uint8_t kUseLocalBuffer = 0x01;
 const uint8_t kUseCompressedBuffer = 0x02;
+const uint8_t kUseIndexedBuffer = 0x03;
+const uint8_t kUseShapedBuffer = 0x04;
 static_assert(kUseLocalBuffer % 8 != 0, "Special storage modes need to be not a multiple of 8");
 static_assert(kUseCompressedBuffer % 8 != 0, "Special storage modes need to be not a multiple of 8");
+static_assert(kUseIndexedBuffer % 8 != 0, "Special storage modes need to be not a multiple of 8");
+static_assert(kUseShapedBuffer % 8 != 0, "Special storage modes need to be not a multiple of 8");
+
+// Smaller buffers are decoded faster than the directory is searched.
+const uint32_t kPropertyDirectoryMinProperties = 16;
+
+// Shape IDs are encoded as `uint16_t`; new sets of properties aren't shaped once all of them are taken.
+const uint32_t kMaxPropertyShapes = std::numeric_limits<uint16_t>::max() + 1;
+const uint32_t kShapeIdSize = sizeof(uint16_t);
 
 enum class StorageMode : uint8_t {
   EMPTY,
   BUFFER,
   LOCAL,
   COMPRESSED,
+  INDEXED,
+  SHAPED,
 };
 
 struct DecodedBufferConst {
@@ -1851,6 +1943,8 @@ void FreeMemory(DecodedBuffer const &buffer_info) {
   switch (buffer_info.storage_mode) {
     case StorageMode::BUFFER:
     case StorageMode::COMPRESSED:
+    case StorageMode::INDEXED:
+    case StorageMode::SHAPED:
       delete[] buffer_info.view.data();
       break;
     case StorageMode::LOCAL:
@@ -1884,13 +1978,60 @@ DecodedBuffer SetupBuffer(uint8_t (&buffer)[12], uint32_t size) {
   return can_fit_in_local ? SetupLocalBuffer(buffer) : SetupExternalBuffer(size);
 }
 
+// Marks compressed buffers which were compressed with the `PropertyCompressionDictionary`. It is stored in the
+// size modifier byte, which only uses its lowest 3 bits.
+const uint8_t kCompressedWithDictionary = 0x80;
+const uint8_t kCompressedSizeModifierMask = 0x07;
+
+// Dictionary used to compress property buffers when `--storage-property-store-compression-dictionary-enabled` is
+// set. It is trained once, from the first `kTrainingSamples` buffers which are compressed, and then never changes, so
+// it can be used without taking a lock. Buffers compressed before it was trained are stored without it.
+class PropertyCompressionDictionary {
+ public:
+  static constexpr size_t kTrainingSamples = 1024;
+
+  static PropertyCompressionDictionary &Instance() {
+    static PropertyCompressionDictionary dictionary;
+    return dictionary;
+  }
+
+  // nullptr until the dictionary is trained
+  utils::CompressionDictionary const *Get() const { return dictionary_.load(std::memory_order_acquire); }
+
+  // Returns the dictionary to compress `buffer` with, or samples `buffer` for training the dictionary.
+  utils::CompressionDictionary const *GetOrSample(std::span<uint8_t const> buffer) {
+    if (auto const *dictionary = Get(); dictionary || training_done_.load(std::memory_order_acquire)) {
+      return dictionary;
+    }
+    auto guard = std::lock_guard{lock_};
+    if (training_done_.load(std::memory_order_relaxed)) return Get();
+    samples_.emplace_back(buffer.begin(), buffer.end());
+    if (samples_.size() < kTrainingSamples) return nullptr;
+
+    std::vector<std::span<uint8_t const>> samples(samples_.begin(), samples_.end());
+    trained_ = std::make_unique<utils::CompressionDictionary>(utils::CompressionDictionary::Train(samples));
+    samples_ = {};
+    // Samples without anything in common are compressed without a dictionary.
+    if (!trained_->view().empty()) dictionary_.store(trained_.get(), std::memory_order_release);
+    training_done_.store(true, std::memory_order_release);
+    return Get();
+  }
+
+ private:
+  std::mutex lock_;
+  std::vector<std::vector<uint8_t>> samples_;
+  std::unique_ptr<utils::CompressionDictionary> trained_;
+  std::atomic<utils::CompressionDictionary const *> dictionary_{nullptr};
+  std::atomic<bool> training_done_{false};
+};
+
 std::optional<utils::DecompressedBuffer> DecompressBuffer(DecodedBufferConst const &buffer_info) {
   if (buffer_info.storage_mode != StorageMode::COMPRESSED) return std::nullopt;
 
   // Memory (hex):
   // 00 00 00 00 00 00 00
   // |------------|         -> original size
-  //                ||      -> size modifier to get back to non multiple of 8
+  //                ||      -> size modifier to get back to non multiple of 8 & `kCompressedWithDictionary`
   //                   |--- -> compressed data
   // 0  1  2  3  4  5  6  (positions)
 
@@ -1899,14 +2040,20 @@ std::optional<utils::DecompressedBuffer> DecompressBuffer(DecodedBufferConst con
   memcpy(&original_size, data, sizeof(uint32_t));
 
   // we have to restore the original size of the compressed buffer + the size of the original buffer
-  auto modifier = data[sizeof(uint32_t)];
+  auto const header = data[sizeof(uint32_t)];
+  auto modifier = header & kCompressedSizeModifierMask;
   auto buffer_size = buffer_info.view.size_bytes();
   auto compressed_size = (modifier != 0) ? (buffer_size - 8 + modifier) : buffer_size;
 
   auto data_offset = sizeof(uint32_t) + 1;
   auto compressed_buffer = std::span(data + data_offset, compressed_size - data_offset);
   auto const *compressor = utils::Compressor::GetInstance();
-  auto decompressed_buffer = compressor->Decompress(compressed_buffer, original_size);
+  auto decompressed_buffer = std::invoke([&] {
+    if ((header & kCompressedWithDictionary) == 0) return compressor->Decompress(compressed_buffer, original_size);
+    auto const *dictionary = PropertyCompressionDictionary::Instance().Get();
+    MG_ASSERT(dictionary, "Property buffer compressed with a missing dictionary");
+    return compressor->Decompress(compressed_buffer, original_size, *dictionary);
+  });
 
   if (!decompressed_buffer) [[unlikely]] {
     throw PropertyValueException("Failed to decompress buffer");
@@ -1915,6 +2062,45 @@ std::optional<utils::DecompressedBuffer> DecompressBuffer(DecodedBufferConst con
   return decompressed_buffer;
 }
 
+// Buffers which were recently decompressed for reading by this thread, so that reading the properties of a hot vertex
+// or edge again doesn't decompress them again. An entry is matched by the compressed bytes themselves, which stays
+// correct when a compressed buffer is freed and its memory reused.
+class DecompressedBufferCache {
+ public:
+  static constexpr size_t kEntries = 64;
+  // Only small buffers are cached, which bounds the memory used by each thread.
+  static constexpr uint32_t kMaxBufferSize = 4096;
+
+  static DecompressedBufferCache &ThreadInstance() {
+    thread_local DecompressedBufferCache cache;
+    return cache;
+  }
+
+  std::shared_ptr<utils::DecompressedBuffer const> Get(DecodedBufferConst const &buffer_info) {
+    auto decompress = [&] {
+      return std::make_shared<utils::DecompressedBuffer const>(std::move(*DecompressBuffer(buffer_info)));
+    };
+    auto const compressed = buffer_info.view;
+    uint32_t original_size = 0;
+    memcpy(&original_size, compressed.data(), sizeof(uint32_t));
+    if (original_size > kMaxBufferSize) return decompress();
+
+    // Buffers are at least 8 byte aligned, so the lowest bits of their address aren't used as the index.
+    auto &entry = entries_[(reinterpret_cast<uintptr_t>(compressed.data()) >> 3) % kEntries];
+    if (entry.decompressed && std::ranges::equal(entry.compressed, compressed)) return entry.decompressed;
+    entry.decompressed = decompress();
+    entry.compressed.assign(compressed.begin(), compressed.end());
+    return entry.decompressed;
+  }
+
+ private:
+  struct Entry {
+    std::vector<uint8_t> compressed;
+    std::shared_ptr<utils::DecompressedBuffer const> decompressed;
+  };
+  std::array<Entry, kEntries> entries_;
+};
+
 void CompressBuffer(uint8_t (&buffer)[12], DecodedBuffer const &buffer_info) {
   if (buffer_info.storage_mode != StorageMode::BUFFER) {
     return;
@@ -1922,7 +2108,11 @@ void CompressBuffer(uint8_t (&buffer)[12], DecodedBuffer const &buffer_info) {
   auto uncompressed_size = buffer_info.view.size_bytes();
 
   auto const *compressor = utils::Compressor::GetInstance();
-  auto compressed_buffer = compressor->Compress(buffer_info.view);
+  auto const *dictionary = FLAGS_storage_property_store_compression_dictionary_enabled
+                               ? PropertyCompressionDictionary::Instance().GetOrSample(buffer_info.view)
+                               : nullptr;
+  auto compressed_buffer =
+      dictionary ? compressor->Compress(buffer_info.view, *dictionary) : compressor->Compress(buffer_info.view);
   if (!compressed_buffer) {
     throw PropertyValueException("Failed to compress buffer");
   }
@@ -1947,7 +2137,7 @@ void CompressBuffer(uint8_t (&buffer)[12], DecodedBuffer const &buffer_info) {
 
   // next byte is the mod before multiple of 8
   const uint8_t mod = size_needed % 8;
-  compressed_data[sizeof(uint32_t)] = mod;
+  compressed_data[sizeof(uint32_t)] = dictionary ? (mod | kCompressedWithDictionary) : mod;
 
   // the rest of the buffer is the compressed data
   memcpy(compressed_data.get() + metadata_size, compressed_view.data(), compressed_view.size_bytes());
@@ -1982,6 +2172,14 @@ auto GetDecodedBuffer(uint8_t (&buffer)[12]) -> DecodedBuffer {
       auto real_size = static_cast<uint32_t>(size & ~(sizeof(uint8_t) * CHAR_BIT - 1));
       return {std::span{data, real_size}, StorageMode::COMPRESSED};
     }
+    case kUseIndexedBuffer: {
+      auto real_size = static_cast<uint32_t>(size & ~(sizeof(uint8_t) * CHAR_BIT - 1));
+      return {std::span{data, real_size}, StorageMode::INDEXED};
+    }
+    case kUseShapedBuffer: {
+      auto real_size = static_cast<uint32_t>(size & ~(sizeof(uint8_t) * CHAR_BIT - 1));
+      return {std::span{data, real_size}, StorageMode::SHAPED};
+    }
     default: {
       MG_ASSERT(false, "Corrupt property storage");
     }
@@ -2013,12 +2211,284 @@ auto GetDecodedBuffer(uint8_t const (&buffer)[12]) -> DecodedBufferConst {
       auto real_size = static_cast<uint32_t>(size & ~(sizeof(uint8_t) * CHAR_BIT - 1));
       return {std::span{data, real_size}, StorageMode::COMPRESSED};
     }
+    case kUseIndexedBuffer: {
+      auto real_size = static_cast<uint32_t>(size & ~(sizeof(uint8_t) * CHAR_BIT - 1));
+      return {std::span{data, real_size}, StorageMode::INDEXED};
+    }
+    case kUseShapedBuffer: {
+      auto real_size = static_cast<uint32_t>(size & ~(sizeof(uint8_t) * CHAR_BIT - 1));
+      return {std::span{data, real_size}, StorageMode::SHAPED};
+    }
     default: {
       MG_ASSERT(false, "Corrupt property storage");
     }
   }
 }
 
+// Directory of an INDEXED buffer, see `kUseIndexedBuffer`.
+class PropertyDirectory {
+ public:
+  explicit PropertyDirectory(DecodedBufferConst const &buffer_info) : data_(buffer_info.view.data()) {
+    DMG_ASSERT(buffer_info.storage_mode == StorageMode::INDEXED);
+    auto const size = buffer_info.view.size_bytes();
+    memcpy(&count_, data_ + size - sizeof(uint16_t), sizeof(uint16_t));
+    offsets_begin_ = static_cast<uint32_t>(size - sizeof(uint16_t) * (count_ + 1));
+  }
+
+  // The encoded properties, without the directory
+  std::span<uint8_t const> Properties() const { return {data_, offsets_begin_}; }
+
+  // Reader positioned at `property`, or an empty reader if the buffer doesn't contain it. Readers are only valid
+  // for reading that single property.
+  Reader Seek(PropertyId property) const {
+    uint32_t low = 0;
+    uint32_t high = count_;
+    while (low < high) {
+      auto const mid = low + (high - low) / 2;
+      auto const offset = Offset(mid);
+      Reader reader(data_ + offset, offsets_begin_ - offset);
+      auto metadata = reader.ReadMetadata();
+      MG_ASSERT(metadata, "Corrupt property directory");
+      auto property_id = reader.ReadUint(metadata->id_size);
+      MG_ASSERT(property_id, "Corrupt property directory");
+      if (*property_id == property.AsUint()) {
+        return {data_ + offset, offsets_begin_ - offset};
+      }
+      if (*property_id < property.AsUint()) {
+        low = mid + 1;
+      } else {
+        high = mid;
+      }
+    }
+    return {data_, 0};
+  }
+
+ private:
+  uint32_t Offset(uint32_t index) const {
+    uint16_t offset = 0;
+    memcpy(&offset, data_ + offsets_begin_ + index * sizeof(uint16_t), sizeof(uint16_t));
+    return offset;
+  }
+
+  uint8_t const *data_;
+  uint32_t offsets_begin_;
+  uint16_t count_{0};
+};
+
+// Turns an INDEXED buffer back into a regular buffer, before it is modified.
+DecodedBuffer DropPropertyDirectory(uint8_t (&buffer)[12], DecodedBuffer const &buffer_info) {
+  if (buffer_info.storage_mode != StorageMode::INDEXED) return buffer_info;
+  auto const properties_size =
+      PropertyDirectory({.view = buffer_info.view, .storage_mode = buffer_info.storage_mode}).Properties().size_bytes();
+  // Zeroes are a tombstone, so the directory becomes padding of the regular buffer.
+  memset(buffer_info.view.data() + properties_size, 0, buffer_info.view.size_bytes() - properties_size);
+  SetSizeData(buffer, buffer_info.view.size_bytes(), buffer_info.view.data());
+  return {buffer_info.view, StorageMode::BUFFER};
+}
+
+// Adds a property directory to regular buffers with enough properties.
+void AddPropertyDirectory(uint8_t (&buffer)[12]) {
+  auto buffer_info = GetDecodedBuffer(buffer);
+  if (buffer_info.storage_mode != StorageMode::BUFFER) return;
+
+  std::vector<uint16_t> offsets;
+  Reader reader(buffer_info.view.data(), buffer_info.view.size_bytes());
+  uint32_t properties_end = 0;
+  while (HasExpectedProperty(&reader, PropertyId::FromUint(std::numeric_limits<uint64_t>::max())) ==
+         ExpectedPropertyStatus::SMALLER) {
+    // Offsets are 16 bits, so only buffers smaller than 64KB are indexed.
+    if (properties_end > std::numeric_limits<uint16_t>::max()) return;
+    offsets.push_back(static_cast<uint16_t>(properties_end));
+    properties_end = reader.GetPosition();
+  }
+  if (offsets.size() < kPropertyDirectoryMinProperties) return;
+
+  auto const directory_size = static_cast<uint32_t>(sizeof(uint16_t) * (offsets.size() + 1));
+  auto size = ToMultipleOf8(properties_end + directory_size);
+  auto *data = buffer_info.view.data();
+  if (buffer_info.view.size_bytes() >= size) {
+    // Reuse the buffer, e.g. when a property of an INDEXED buffer was updated.
+    size = buffer_info.view.size_bytes();
+  } else {
+    data = new uint8_t[size];
+    memcpy(data, buffer_info.view.data(), properties_end);
+    FreeMemory(buffer_info);
+  }
+  auto const offsets_begin = size - directory_size;
+  memset(data + properties_end, 0, offsets_begin - properties_end);
+  memcpy(data + offsets_begin, offsets.data(), sizeof(uint16_t) * offsets.size());
+  auto const count = static_cast<uint16_t>(offsets.size());
+  memcpy(data + size - sizeof(uint16_t), &count, sizeof(uint16_t));
+  SetSizeData(buffer, size + kUseIndexedBuffer, data);
+}
+
+// Shapes of SHAPED buffers, see `kUseShapedBuffer`. Shapes are never removed, so a shape ID stays valid for the
+// lifetime of the process and shapes can be read without taking a lock.
+class PropertyShapes {
+ public:
+  static PropertyShapes &Instance() {
+    static PropertyShapes shapes;
+    return shapes;
+  }
+
+  std::optional<uint16_t> Intern(std::vector<PropertyId> properties) {
+    {
+      auto guard = std::shared_lock{lock_};
+      if (auto it = ids_.find(properties); it != ids_.end()) return it->second;
+    }
+    auto guard = std::unique_lock{lock_};
+    if (auto it = ids_.find(properties); it != ids_.end()) return it->second;
+    if (ids_.size() == kMaxPropertyShapes) return std::nullopt;
+    auto const id = static_cast<uint16_t>(ids_.size());
+    auto it = ids_.emplace(std::move(properties), id).first;
+    // Map nodes are never moved, so their keys can be shared.
+    shapes_[id].store(&it->first, std::memory_order_release);
+    return id;
+  }
+
+  std::span<PropertyId const> Properties(uint16_t id) const {
+    auto const *properties = shapes_[id].load(std::memory_order_acquire);
+    MG_ASSERT(properties, "Corrupt property shape");
+    return *properties;
+  }
+
+ private:
+  utils::RWSpinLock lock_;
+  std::map<std::vector<PropertyId>, uint16_t> ids_;
+  std::unique_ptr<std::atomic<std::vector<PropertyId> const *>[]> shapes_{
+      std::make_unique<std::atomic<std::vector<PropertyId> const *>[]>(kMaxPropertyShapes)};
+};
+
+// SHAPED buffers with enough properties have a directory of their offsets, like INDEXED buffers. The values differ
+// in size between the stores with the same shape, so the offsets are kept in each store.
+bool HasShapedDirectory(size_t properties) { return properties >= kPropertyDirectoryMinProperties; }
+
+// Reads a SHAPED buffer in place.
+class ShapedBuffer {
+ public:
+  explicit ShapedBuffer(std::span<uint8_t const> view) : data_(view.data() + kShapeIdSize) {
+    uint16_t shape = 0;
+    memcpy(&shape, view.data(), sizeof(shape));
+    properties_ = PropertyShapes::Instance().Properties(shape);
+    values_size_ = static_cast<uint32_t>(view.size_bytes() - kShapeIdSize);
+    if (HasShapedDirectory(properties_.size())) {
+      values_size_ -= static_cast<uint32_t>(sizeof(uint16_t) * properties_.size());
+    }
+  }
+
+  Reader Properties() const { return {data_, values_size_, properties_}; }
+
+  // Reader positioned at `property`, or an empty reader if the buffer doesn't contain it. Without a directory the
+  // reader starts at the first property, which is faster to read through than a directory is to build and search.
+  Reader Seek(PropertyId property) const {
+    auto it = std::ranges::lower_bound(properties_, property);
+    if (it == properties_.end() || *it != property) return {data_, 0};
+    if (!HasShapedDirectory(properties_.size())) return Properties();
+    auto const index = static_cast<size_t>(std::distance(properties_.begin(), it));
+    uint16_t offset = 0;
+    memcpy(&offset, data_ + values_size_ + index * sizeof(uint16_t), sizeof(uint16_t));
+    return {data_ + offset, values_size_ - offset, properties_.subspan(index)};
+  }
+
+  bool HasDirectory() const { return HasShapedDirectory(properties_.size()); }
+
+  // Writes the properties in the regular encoding; a writer without a buffer only computes their size.
+  void Expand(Writer &writer) const {
+    Reader reader(data_, values_size_);
+    for (auto property : properties_) {
+      auto metadata = reader.ReadMetadata();
+      MG_ASSERT(metadata, "Corrupt shaped property store");
+      auto const payload_begin = reader.GetPosition();
+      MG_ASSERT(SkipPropertyValue(&reader, metadata->type, metadata->payload_size), "Corrupt shaped property store");
+      auto handle = writer.WriteMetadata();
+      auto id_size = writer.WriteUint(property.AsUint());
+      MG_ASSERT(handle && id_size, "Invalid database state!");
+      MG_ASSERT(writer.WriteBytes(data_ + payload_begin, reader.GetPosition() - payload_begin),
+                "Invalid database state!");
+      handle->Set({metadata->type, *id_size, metadata->payload_size});
+    }
+  }
+
+ private:
+  uint8_t const *data_;
+  uint32_t values_size_;
+  std::span<PropertyId const> properties_;
+};
+
+// Turns a SHAPED buffer back into a regular buffer, before it is modified.
+DecodedBuffer DropPropertyShape(uint8_t (&buffer)[12], DecodedBuffer const &buffer_info) {
+  if (buffer_info.storage_mode != StorageMode::SHAPED) return buffer_info;
+  auto const shaped = ShapedBuffer(buffer_info.view);
+  Writer size_writer;
+  shaped.Expand(size_writer);
+  auto new_buffer_info = SetupExternalBuffer(size_writer.Written());
+  auto new_view = new_buffer_info.view;
+  Writer writer(new_view.data(), static_cast<uint32_t>(new_view.size_bytes()));
+  shaped.Expand(writer);
+  // Zeroes are a tombstone
+  memset(new_view.data() + writer.Written(), 0, new_view.size_bytes() - writer.Written());
+  FreeMemory(buffer_info);
+  SetSizeData(buffer, new_view.size_bytes(), new_view.data());
+  return new_buffer_info;
+}
+
+// Stores a regular buffer without its property IDs, if that makes it smaller.
+void AddPropertyShape(uint8_t (&buffer)[12]) {
+  auto buffer_info = GetDecodedBuffer(buffer);
+  if (buffer_info.storage_mode != StorageMode::BUFFER) return;
+
+  struct Value {
+    uint8_t metadata;
+    std::span<uint8_t const> payload;
+  };
+  std::vector<PropertyId> properties;
+  std::vector<Value> values;
+  std::vector<uint16_t> offsets;
+  uint32_t shaped_size = kShapeIdSize;
+  Reader reader(buffer_info.view.data(), buffer_info.view.size_bytes());
+  while (true) {
+    auto const metadata_position = reader.GetPosition();
+    auto metadata = reader.ReadMetadata();
+    if (!metadata || metadata->type == Type::EMPTY) break;
+    auto property_id = reader.ReadUint(metadata->id_size);
+    MG_ASSERT(property_id, "Invalid database state!");
+    auto const payload_begin = reader.GetPosition();
+    MG_ASSERT(SkipPropertyValue(&reader, metadata->type, metadata->payload_size), "Invalid database state!");
+    auto payload = buffer_info.view.subspan(payload_begin, reader.GetPosition() - payload_begin);
+    // The property ID size is left as it was, it isn't used when reading shaped buffers
+    properties.push_back(PropertyId::FromUint(*property_id));
+    values.push_back({buffer_info.view[metadata_position], payload});
+    // Offsets are 16 bits, so buffers of 64KB or more aren't shaped.
+    if (shaped_size - kShapeIdSize > std::numeric_limits<uint16_t>::max()) return;
+    offsets.push_back(static_cast<uint16_t>(shaped_size - kShapeIdSize));
+    shaped_size += 1 + payload.size_bytes();
+  }
+  // The regular buffer gets a directory as well
+  auto regular_size = buffer_info.view.size_bytes();
+  if (HasShapedDirectory(properties.size())) {
+    shaped_size += static_cast<uint32_t>(sizeof(uint16_t) * offsets.size());
+    regular_size += sizeof(uint16_t) * (offsets.size() + 1);
+  }
+  auto const size = ToMultipleOf8(shaped_size);
+  if (properties.empty() || size >= regular_size) return;
+  auto const shape = PropertyShapes::Instance().Intern(std::move(properties));
+  if (!shape) return;
+
+  auto *data = new uint8_t[size];
+  memcpy(data, &*shape, kShapeIdSize);
+  auto position = kShapeIdSize;
+  for (auto const &[metadata, payload] : values) {
+    data[position++] = metadata;
+    memcpy(data + position, payload.data(), payload.size_bytes());
+    position += payload.size_bytes();
+  }
+  auto const directory_size = HasShapedDirectory(offsets.size()) ? sizeof(uint16_t) * offsets.size() : 0;
+  memset(data + position, 0, size - directory_size - position);
+  memcpy(data + size - directory_size, offsets.data(), directory_size);
+  FreeMemory(buffer_info);
+  SetSizeData(buffer, size + kUseShapedBuffer, data);
+}
+
 }  // namespace
 
 PropertyStore::PropertyStore() { memset(buffer_, 0, sizeof(buffer_)); }
@@ -2051,15 +2521,56 @@ template <typename Func>
 auto PropertyStore::WithReader(Func &&func) const {
   auto buffer_info = GetDecodedBuffer(buffer_);
   if (buffer_info.storage_mode == StorageMode::COMPRESSED) {
-    auto decompressed_buffer = DecompressBuffer(buffer_info);
+    auto const decompressed_buffer = DecompressedBufferCache::ThreadInstance().Get(buffer_info);
     auto view = decompressed_buffer->view();
     Reader reader(view.data(), view.size_bytes());
     return std::forward<Func>(func)(reader);
   }
+  if (buffer_info.storage_mode == StorageMode::INDEXED) {
+    auto view = PropertyDirectory(buffer_info).Properties();
+    Reader reader(view.data(), view.size_bytes());
+    return std::forward<Func>(func)(reader);
+  }
+  if (buffer_info.storage_mode == StorageMode::SHAPED) {
+    auto reader = ShapedBuffer(buffer_info.view).Properties();
+    return std::forward<Func>(func)(reader);
+  }
   Reader reader(buffer_info.view.data(), buffer_info.view.size_bytes());
   return std::forward<Func>(func)(reader);
 }
 
+template <typename Func>
+auto PropertyStore::WithPropertyReader(PropertyId property, Func &&func) const {
+  auto buffer_info = GetDecodedBuffer(buffer_);
+  if (buffer_info.storage_mode == StorageMode::INDEXED) {
+    auto reader = PropertyDirectory(buffer_info).Seek(property);
+    return std::forward<Func>(func)(reader);
+  }
+  if (buffer_info.storage_mode == StorageMode::SHAPED) {
+    auto reader = ShapedBuffer(buffer_info.view).Seek(property);
+    return std::forward<Func>(func)(reader);
+  }
+  return WithReader(std::forward<Func>(func));
+}
+
+template <typename Func>
+auto PropertyStore::WithPropertyReaders(Func &&func) const {
+  auto buffer_info = GetDecodedBuffer(buffer_);
+  if (buffer_info.storage_mode == StorageMode::INDEXED) {
+    auto directory = PropertyDirectory(buffer_info);
+    return std::forward<Func>(func)([&directory](PropertyId property) { return directory.Seek(property); });
+  }
+  if (buffer_info.storage_mode == StorageMode::SHAPED) {
+    if (auto shaped = ShapedBuffer(buffer_info.view); shaped.HasDirectory()) {
+      return std::forward<Func>(func)([&shaped](PropertyId property) { return shaped.Seek(property); });
+    }
+  }
+  return WithReader([&](Reader &reader) {
+    // The properties are sorted, so each one is searched for from where the previous one was found.
+    return std::forward<Func>(func)([&reader](PropertyId /*property*/) -> Reader & { return reader; });
+  });
+}
+
 /// When reading from the reader, once you have hit MISSING_DATA its no longer safe to keep reading
 /// example: reader could be in local buffer with junk data after the EMPTY marker, hence not safe to read that junk
 template <typename GetFunc, typename ApplyFunc, typename MissingValue>
@@ -2102,7 +2613,7 @@ PropertyValue PropertyStore::GetProperty(PropertyId property) const {
     if (FindSpecificProperty(&reader, property, value) != ExpectedPropertyStatus::EQUAL) return {};
     return value;
   };
-  return WithReader(get_property);
+  return WithPropertyReader(property, get_property);
 }
 
 ExtendedPropertyType PropertyStore::GetExtendedPropertyType(PropertyId property) const {
@@ -2111,7 +2622,7 @@ ExtendedPropertyType PropertyStore::GetExtendedPropertyType(PropertyId property)
     if (FindSpecificExtendedPropertyType(&reader, property, type) != ExpectedPropertyStatus::EQUAL) return {};
     return type;
   };
-  return WithReader(get_property_type);
+  return WithPropertyReader(property, get_property_type);
 }
 
 uint32_t PropertyStore::PropertySize(PropertyId property) const {
@@ -2120,14 +2631,14 @@ uint32_t PropertyStore::PropertySize(PropertyId property) const {
     if (FindSpecificPropertySize(&reader, property, property_size) != ExpectedPropertyStatus::EQUAL) return 0;
     return property_size;
   };
-  return WithReader(get_property_size);
+  return WithPropertyReader(property, get_property_size);
 }
 
 bool PropertyStore::HasProperty(PropertyId property) const {
   auto property_exists = [&](Reader &reader) -> uint32_t {
     return ExistsSpecificProperty(&reader, property) == ExpectedPropertyStatus::EQUAL;
   };
-  return WithReader(property_exists);
+  return WithPropertyReader(property, property_exists);
 }
 
 bool PropertyStore::HasAllProperties(const std::set<PropertyId> &properties) const {
@@ -2148,21 +2659,39 @@ bool PropertyStore::HasAllPropertyValues(const std::vector<PropertyValue> &prope
 
 std::optional<std::vector<PropertyValue>> PropertyStore::ExtractPropertyValues(
     const std::set<PropertyId> &properties) const {
-  auto get_property = [&](Reader &reader) -> std::optional<std::vector<PropertyValue>> {
+  auto get_property = [&](auto &&reader_for) -> std::optional<std::vector<PropertyValue>> {
     PropertyValue value;
     auto values = std::vector<PropertyValue>{};
     values.reserve(properties.size());
     for (auto property : properties) {
+      auto &&reader = reader_for(property);
       if (FindSpecificProperty(&reader, property, value) != ExpectedPropertyStatus::EQUAL) return std::nullopt;
       values.emplace_back(std::move(value));
     }
     return values;
   };
-  return WithReader(get_property);
+  return WithPropertyReaders(get_property);
 }
 
 std::vector<PropertyValue> PropertyStore::ExtractPropertyValuesMissingAsNull(
     std::span<PropertyId const> ordered_properties) const {
+  auto const seek_properties = [&](auto const &directory) {
+    auto values = std::vector<PropertyValue>{};
+    values.reserve(ordered_properties.size());
+    for (auto property : ordered_properties) {
+      auto reader = directory.Seek(property);
+      auto &value = values.emplace_back();
+      [[maybe_unused]] auto status = FindSpecificProperty(&reader, property, value);
+    }
+    return values;
+  };
+  auto buffer_info = GetDecodedBuffer(buffer_);
+  if (buffer_info.storage_mode == StorageMode::INDEXED) {
+    return seek_properties(PropertyDirectory(buffer_info));
+  }
+  if (buffer_info.storage_mode == StorageMode::SHAPED) {
+    if (auto shaped = ShapedBuffer(buffer_info.view); shaped.HasDirectory()) return seek_properties(shaped);
+  }
   auto get_properties = [&](Reader &reader) -> std::vector<PropertyValue> {
     auto values = std::vector<PropertyValue>{};
     values.reserve(ordered_properties.size());
@@ -2187,15 +2716,14 @@ std::vector<PropertyValue> PropertyStore::ExtractPropertyValuesMissingAsNull(
 
 bool PropertyStore::IsPropertyEqual(PropertyId property, const PropertyValue &value) const {
   auto property_equal = [&](Reader &reader) -> bool {
-    auto const orig_reader = reader;
     auto info = FindSpecificPropertyAndBufferInfoMinimal(&reader, property);
     auto property_size = info.property_size();
     if (property_size == 0) return value.IsNull();
-    auto prop_reader = Reader(orig_reader, info.property_begin, property_size);
+    auto prop_reader = Reader(reader, info.property_begin, property_size);
     if (!CompareExpectedProperty(&prop_reader, property, value)) return false;
     return prop_reader.GetPosition() == property_size;
   };
-  return WithReader(property_equal);
+  return WithPropertyReader(property, property_equal);
 }
 
 auto PropertyStore::ArePropertiesEqual(std::span<PropertyId const> ordered_properties,
@@ -2205,11 +2733,10 @@ auto PropertyStore::ArePropertiesEqual(std::span<PropertyId const> ordered_prope
     auto result = std::vector<bool>(ordered_properties.size(), false);
 
     auto const get_result = [&](Reader &reader, PropertyId property, PropertyValue const &cmp_val) {
-      auto const orig_reader = reader;
       auto info = FindSpecificPropertyAndBufferInfoMinimal(&reader, property);
       auto property_size = info.property_size();
       if (property_size != 0) {
-        auto prop_reader = Reader(orig_reader, info.property_begin, property_size);
+        auto prop_reader = Reader(reader, info.property_begin, property_size);
         auto cmp_res = CompareExpectedProperty(&prop_reader, property, cmp_val);
         return std::pair{info.status, std::optional{cmp_res}};
       } else {
@@ -2281,7 +2808,8 @@ bool PropertyStore::SetProperty(PropertyId property, const PropertyValue &value)
     property_size = writer.Written();
   }
 
-  auto buffer_info = GetDecodedBuffer(buffer_);
+  auto buffer_info = DropPropertyShape(buffer_, GetDecodedBuffer(buffer_));
+  buffer_info = DropPropertyDirectory(buffer_, buffer_info);
 
   bool existed = false;
   if (buffer_info.storage_mode == StorageMode::EMPTY) {
@@ -2398,6 +2926,10 @@ bool PropertyStore::SetProperty(PropertyId property, const PropertyValue &value)
   if (FLAGS_storage_property_store_compression_enabled) {
     CompressBuffer(buffer_, buffer_info);
   }
+  if (FLAGS_storage_property_store_shapes_enabled) {
+    AddPropertyShape(buffer_);
+  }
+  AddPropertyDirectory(buffer_);
 
   return !existed;
 }
@@ -2450,6 +2982,10 @@ bool PropertyStore::DoInitProperties(const TContainer &properties) {
   if (FLAGS_storage_property_store_compression_enabled) {
     CompressBuffer(buffer_, buffer_info);
   }
+  if (FLAGS_storage_property_store_shapes_enabled) {
+    AddPropertyShape(buffer_);
+  }
+  AddPropertyDirectory(buffer_);
 
   return true;
 }
@@ -2506,6 +3042,27 @@ bool PropertyStore::ClearProperties() {
 
 std::string PropertyStore::StringBuffer() const {
   auto buffer_info = GetDecodedBuffer(buffer_);
+  if (buffer_info.storage_mode == StorageMode::INDEXED) {
+    // The directory is rebuilt when needed, so it isn't a part of the encoded properties
+    auto view = PropertyDirectory(buffer_info).Properties();
+    return {view.begin(), view.end()};
+  }
+  if (buffer_info.storage_mode == StorageMode::COMPRESSED) {
+    // `SetBuffer` expects the regular encoding, and the compression dictionary only lives in memory
+    auto const decompressed_buffer = DecompressBuffer(buffer_info);
+    auto view = decompressed_buffer->view();
+    return {view.begin(), view.end()};
+  }
+  if (buffer_info.storage_mode == StorageMode::SHAPED) {
+    // Shapes only live in memory, so the regular encoding is stored
+    auto const shaped = ShapedBuffer(buffer_info.view);
+    Writer size_writer;
+    shaped.Expand(size_writer);
+    std::string properties(size_writer.Written(), '\0');
+    Writer writer(reinterpret_cast<uint8_t *>(properties.data()), static_cast<uint32_t>(properties.size()));
+    shaped.Expand(writer);
+    return properties;
+  }
   return {buffer_info.view.begin(), buffer_info.view.end()};
 }
 
@@ -2535,7 +3092,7 @@ std::vector<PropertyId> PropertyStore::PropertiesOfTypes(std::span<Type const> t
       auto metadata = reader.ReadMetadata();
       if (!metadata || metadata->type == Type::EMPTY) break;
 
-      auto property_id = reader.ReadUint(metadata->id_size);
+      auto property_id = reader.ReadPropertyId(metadata->id_size);
       if (!property_id) break;
 
       if (utils::Contains(types, metadata->type)) {
@@ -2558,7 +3115,7 @@ std::optional<PropertyValue> PropertyStore::GetPropertyOfTypes(PropertyId proper
         return std::nullopt;
       }
 
-      auto property_id = reader.ReadUint(metadata->id_size);
+      auto property_id = reader.ReadPropertyId(metadata->id_size);
       if (!property_id) {
         return std::nullopt;
       }
@@ -2584,7 +3141,7 @@ std::optional<PropertyValue> PropertyStore::GetPropertyOfTypes(PropertyId proper
     return std::nullopt;
   };
 
-  return WithReader(get_properties);
+  return WithPropertyReader(property, get_properties);
 }
 
 auto PropertyStore::PropertiesMatchTypes(TypeConstraintsValidator const &constraint) const
@@ -26,6 +26,10 @@
 
 // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
 DECLARE_bool(storage_property_store_compression_enabled);
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DECLARE_bool(storage_property_store_compression_dictionary_enabled);
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DECLARE_bool(storage_property_store_shapes_enabled);
 
 namespace memgraph::storage {
 
@@ -51,7 +55,8 @@ class PropertyStore {
 
   /// Returns the currently stored value for property `property`. If the
   /// property doesn't exist a Null value is returned. The time complexity of
-  /// this function is O(n).
+  /// this function is O(n), or O(log(n)) for stores large enough to have a
+  /// property directory.
   /// @throw std::bad_alloc
   PropertyValue GetProperty(PropertyId property) const;
 
@@ -63,7 +68,8 @@ class PropertyStore {
   uint32_t PropertySize(PropertyId property) const;
 
   /// Checks whether the property `property` exists in the store. The time
-  /// complexity of this function is O(n).
+  /// complexity of this function is O(n), or O(log(n)) for stores large
+  /// enough to have a property directory.
   bool HasProperty(PropertyId property) const;
 
   /// Checks whether all properties in the set `properties` exist in the store. The time
@@ -75,11 +81,12 @@ class PropertyStore {
   bool HasAllPropertyValues(const std::vector<PropertyValue> &property_values) const;
 
   /// Extracts property values for all property ids in the set `properties`. The time
-  /// complexity of this function is O(n).
+  /// complexity of this function is O(n), or O(m*log(n)) for stores large enough to have a property directory.
   std::optional<std::vector<PropertyValue>> ExtractPropertyValues(const std::set<PropertyId> &properties) const;
 
   /// Extracts property values for all property ids in the span `ordered_properties`. Any missing properties will be
-  /// represented by Null. The time complexity of this function is O(n).
+  /// represented by Null. The time complexity of this function is O(n), or O(m*log(n)) for stores large enough to
+  /// have a property directory.
   /// @param ordered_properties: a pre-sorted collection of `PropertyId`
   std::vector<PropertyValue> ExtractPropertyValuesMissingAsNull(std::span<PropertyId const> ordered_properties) const;
 
@@ -164,6 +171,14 @@ class PropertyStore {
   template <typename Func>
   auto WithReader(Func &&func) const;
 
+  // Like WithReader, but the reader might start at `property` and be unusable for reading other properties.
+  template <typename Func>
+  auto WithPropertyReader(PropertyId property, Func &&func) const;
+
+  // Calls `func` with a function returning a reader for each property, which must be requested in ascending order.
+  template <typename Func>
+  auto WithPropertyReaders(Func &&func) const;
+
   uint8_t buffer_[sizeof(uint32_t) + sizeof(uint8_t *)];
 };
 
@@ -11,7 +11,42 @@
 
 #include "storage/v2/replication/serialization.hpp"
 
+#include <future>
+#include <vector>
+
+#include "utils/compressor.hpp"
+#include "utils/on_scope_exit.hpp"
+#include "utils/thread_pool.hpp"
+
 namespace memgraph::storage::replication {
+
+namespace {
+// Part of a durability file as it's sent to the replica. Chunks are compressed independently, so the next chunk can be
+// read and compressed while the current one is being sent.
+struct FileChunk {
+  std::vector<uint8_t> data;
+  std::optional<utils::CompressedBuffer> compressed;
+};
+
+FileChunk ReadFileChunk(utils::InputFile *file, uint64_t size) {
+  auto chunk = FileChunk{.data = std::vector<uint8_t>(size)};
+  file->Read(chunk.data.data(), size);
+  chunk.compressed = utils::Compressor::GetInstance()->Compress(chunk.data);
+  // Already compressed data (e.g. property buffers) may not get any smaller
+  if (chunk.compressed && chunk.compressed->view().size() >= size) chunk.compressed.reset();
+  return chunk;
+}
+
+// Chunks are prepared by a small shared pool instead of a new thread per chunk. Each file being sent keeps at most
+// one chunk in flight, so the pool only bounds how many files are compressed at the same time.
+constexpr size_t kFileChunkWorkers = 4;
+
+utils::ThreadPool &FileChunkPool() {
+  static utils::ThreadPool pool{kFileChunkWorkers};
+  return pool;
+}
+}  // namespace
+
 ////// Encoder //////
 void Encoder::WriteMarker(durability::Marker marker) { slk::Save(marker, builder_); }
 
@@ -59,12 +94,32 @@ void Encoder::WriteBuffer(const uint8_t *buffer, const size_t buffer_size) { bui
 
 void Encoder::WriteFileData(utils::InputFile *file) {
   auto file_size = file->GetSize();
-  uint8_t buffer[utils::kFileBufferSize];
-  while (file_size > 0) {
+  std::future<FileChunk> next_chunk;
+  auto prepare_next_chunk = [&] {
+    if (file_size == 0) return;
     const auto chunk_size = std::min(file_size, utils::kFileBufferSize);
-    file->Read(buffer, chunk_size);
-    WriteBuffer(buffer, chunk_size);
     file_size -= chunk_size;
+    auto task = std::packaged_task<FileChunk()>{[file, chunk_size] { return ReadFileChunk(file, chunk_size); }};
+    next_chunk = task.get_future();
+    FileChunkPool().AddTask([task = utils::CopyMovableFunctionWrapper{std::move(task)}]() mutable { task(); });
+  };
+  // The chunk being prepared reads from the file, so it has to finish even if writing the current one throws
+  utils::OnScopeExit wait_for_next_chunk{[&] {
+    if (next_chunk.valid()) next_chunk.wait();
+  }};
+
+  prepare_next_chunk();
+  while (next_chunk.valid()) {
+    auto chunk = next_chunk.get();
+    prepare_next_chunk();
+    WriteBool(chunk.compressed.has_value());
+    if (chunk.compressed) {
+      const auto compressed = chunk.compressed->view();
+      WriteUint(compressed.size());
+      WriteBuffer(compressed.data(), compressed.size());
+    } else {
+      WriteBuffer(chunk.data.data(), chunk.data.size());
+    }
   }
 }
 
@@ -178,11 +233,26 @@ std::optional<std::filesystem::path> Decoder::ReadFile(const std::filesystem::pa
   std::optional<size_t> maybe_file_size = ReadUint();
   MG_ASSERT(maybe_file_size, "File size missing");
   auto file_size = *maybe_file_size;
-  uint8_t buffer[utils::kFileBufferSize];
+  auto const *compressor = utils::Compressor::GetInstance();
+  std::vector<uint8_t> buffer(utils::kFileBufferSize);
   while (file_size > 0) {
     const auto chunk_size = std::min(file_size, utils::kFileBufferSize);
-    reader_->Load(buffer, chunk_size);
-    file.Write(buffer, chunk_size);
+    const auto compressed = ReadBool();
+    MG_ASSERT(compressed, "Chunk compression missing for the file {}", filename);
+    if (*compressed) {
+      const auto compressed_size = ReadUint();
+      MG_ASSERT(compressed_size, "Compressed chunk size missing for the file {}", filename);
+      buffer.resize(std::max(buffer.size(), *compressed_size));
+      reader_->Load(buffer.data(), *compressed_size);
+      const auto decompressed =
+          compressor->Decompress(std::span{buffer.data(), *compressed_size}, static_cast<uint32_t>(chunk_size));
+      MG_ASSERT(decompressed && decompressed->view().size() == chunk_size, "Couldn't decompress a chunk of the file {}",
+                filename);
+      file.Write(decompressed->view().data(), chunk_size);
+    } else {
+      reader_->Load(buffer.data(), chunk_size);
+      file.Write(buffer.data(), chunk_size);
+    }
     file_size -= chunk_size;
   }
   file.Close();
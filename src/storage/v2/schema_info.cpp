@@ -633,7 +633,7 @@ void SchemaTracking<TContainer>::RecoverEdge(EdgeTypeId edge_type, EdgeRef edge,
 // Calling this after change has been applied
 // Special case for when the vertex has edges
 void SchemaInfo::TransactionalEdgeModifyingAccessor::AddLabel(Vertex *vertex, LabelId label,
-                                                              std::unique_lock<utils::RWSpinLock> v_lock) {
+                                                              std::unique_lock<decltype(Vertex::lock)> v_lock) {
   DMG_ASSERT(vertex->lock.is_locked(), "Trying to read from an unlocked vertex; LINE {}", __LINE__);
   auto old_labels = vertex->labels;
   auto itr = std::find(old_labels.begin(), old_labels.end(), label);
@@ -649,7 +649,7 @@ void SchemaInfo::TransactionalEdgeModifyingAccessor::AddLabel(Vertex *vertex, La
 // Calling this after change has been applied
 // Special case for when the vertex has edges
 void SchemaInfo::TransactionalEdgeModifyingAccessor::RemoveLabel(Vertex *vertex, LabelId label,
-                                                                 std::unique_lock<utils::RWSpinLock> v_lock) {
+                                                                 std::unique_lock<decltype(Vertex::lock)> v_lock) {
   DMG_ASSERT(vertex->lock.is_locked(), "Trying to read from an unlocked vertex; LINE {}", __LINE__);
   // Move all stats and edges to new label
   auto old_labels = vertex->labels;
@@ -661,7 +661,7 @@ void SchemaInfo::TransactionalEdgeModifyingAccessor::RemoveLabel(Vertex *vertex,
 }
 
 void SchemaInfo::TransactionalEdgeModifyingAccessor::UpdateTransactionalEdges(
-    Vertex *vertex, const utils::small_vector<LabelId> &old_labels, std::unique_lock<utils::RWSpinLock> v_lock) {
+    Vertex *vertex, const utils::small_vector<LabelId> &old_labels, std::unique_lock<decltype(Vertex::lock)> v_lock) {
   DMG_ASSERT(post_process_, "Missing post process in transactional accessor");
   static constexpr bool InEdge = true;
   static constexpr bool OutEdge = !InEdge;
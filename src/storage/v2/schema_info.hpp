@@ -185,13 +185,13 @@ struct SchemaInfo {
           start_ts_{start_ts},
           commit_ts_{commit_ts} {}
 
-    void AddLabel(Vertex *vertex, LabelId label, std::unique_lock<utils::RWSpinLock> v_lock);
+    void AddLabel(Vertex *vertex, LabelId label, std::unique_lock<decltype(Vertex::lock)> v_lock);
 
-    void RemoveLabel(Vertex *vertex, LabelId label, std::unique_lock<utils::RWSpinLock> v_lock);
+    void RemoveLabel(Vertex *vertex, LabelId label, std::unique_lock<decltype(Vertex::lock)> v_lock);
 
    private:
     void UpdateTransactionalEdges(Vertex *vertex, const utils::small_vector<LabelId> &old_labels,
-                                  std::unique_lock<utils::RWSpinLock> v_lock);
+                                  std::unique_lock<decltype(Vertex::lock)> v_lock);
 
     LocalSchemaTracking *tracking_{};
     bool properties_on_edges_{};  //!< As defined by the storage configuration
@@ -293,13 +293,13 @@ struct SchemaInfo {
     return TransactionalEdgeModifyingAccessor{tracking, post_process, start_ts, commit_ts, prop_on_edges};
   }
 
-  static std::optional<std::pair<std::shared_lock<utils::RWSpinLock>, std::shared_lock<utils::RWSpinLock>>>
+  static std::optional<std::pair<std::shared_lock<decltype(Vertex::lock)>, std::shared_lock<decltype(Vertex::lock)>>>
   ReadLockFromTo(auto &schema_acc, StorageMode mode, Vertex *from, Vertex *to) {
     if (!schema_acc) return {};
     return ReadLockFromTo(from, to);
   }
 
-  static std::pair<std::shared_lock<utils::RWSpinLock>, std::shared_lock<utils::RWSpinLock>> ReadLockFromTo(
+  static std::pair<std::shared_lock<decltype(Vertex::lock)>, std::shared_lock<decltype(Vertex::lock)>> ReadLockFromTo(
       Vertex *from, Vertex *to) {
     // Direct modification in both analytical and transactional
     auto from_lock = std::shared_lock{from->lock, std::defer_lock};
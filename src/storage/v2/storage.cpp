@@ -29,6 +29,7 @@
 #include "utils/event_counter.hpp"
 #include "utils/event_gauge.hpp"
 #include "utils/event_histogram.hpp"
+#include "utils/lock_contention.hpp"
 #include "utils/logging.hpp"
 #include "utils/resource_lock.hpp"
 #include "utils/small_vector.hpp"
@@ -39,6 +40,10 @@ class InMemoryStorage;
 
 namespace {
 void TryLock(auto &guard, auto timeout) {
+#ifdef MG_LOCK_CONTENTION_PROFILE
+  if (guard.try_lock()) return;
+  const utils::LockWaitTimer wait_timer{utils::LockClass::MAIN};
+#endif
   if (timeout) {  // With timeout
     if (!guard.try_lock_for(*timeout)) {
       if constexpr (std::is_same_v<decltype(guard), utils::SharedResourceLockGuard &>) {
@@ -163,7 +168,7 @@ std::vector<EventInfo> Storage::GetMetrics() noexcept {
 
   for (auto i = 0; i < metrics::CounterEnd(); i++) {
     result.emplace_back(metrics::GetCounterName(i), metrics::GetCounterType(i), kCounterName,
-                        metrics::global_counters[i]);
+                        metrics::GetCounterValue(i));
   }
 
   for (auto i = 0; i < metrics::GaugeEnd(); i++) {
@@ -492,7 +497,7 @@ Result<std::optional<std::vector<EdgeAccessor>>> Storage::Accessor::ClearEdgesOn
       auto const &[edge_type, opposing_vertex, edge_ref] = *attached_edges_to_vertex->rbegin();
 
       /// TODO: (andi) Again here, no need to lock the edge if using on disk storage.
-      std::unique_lock<utils::RWSpinLock> guard;
+      std::unique_lock<decltype(Edge::lock)> guard;
       if (storage_->config_.salient.items.properties_on_edges) {
         auto edge_ptr = edge_ref.ptr;
         guard = std::unique_lock{edge_ptr->lock};
@@ -584,7 +589,7 @@ Result<std::optional<std::vector<EdgeAccessor>>> Storage::Accessor::DetachRemain
                               vertex_ptr, deletion_delta, reverse_vertex_order, &schema_acc]() {
       for (auto it = mid; it != edges_attached_to_vertex->end(); it++) {
         auto const &[edge_type, opposing_vertex, edge_ref] = *it;
-        std::unique_lock<utils::RWSpinLock> guard;
+        std::unique_lock<decltype(Edge::lock)> guard;
         if (storage_->config_.salient.items.properties_on_edges) {
           auto edge_ptr = edge_ref.ptr;
           guard = std::unique_lock{edge_ptr->lock};
@@ -27,7 +27,9 @@
 #include "storage/v2/vertex_accessor.hpp"
 #include "storage/v2/vertices_iterable.hpp"
 #include "utils/event_counter.hpp"
+#include "utils/lock_contention.hpp"
 #include "utils/resource_lock.hpp"
+#include "utils/spin_lock.hpp"
 #include "utils/synchronized_metadata_store.hpp"
 
 namespace memgraph::metrics {
@@ -658,7 +660,7 @@ class Storage {
   Config config_;
 
   // Transaction engine
-  mutable utils::SpinLock engine_lock_;
+  mutable utils::ProfiledLock<utils::SpinLock, utils::LockClass::ENGINE> engine_lock_;
   uint64_t timestamp_{kTimestampInitialId};
   uint64_t transaction_id_{kTransactionInitialId};
 
@@ -1,4 +1,4 @@
-// Copyright 2024 Memgraph Ltd.
+// Copyright 2025 Memgraph Ltd.
 //
 // Use of this software is governed by the Business Source License
 // included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -22,6 +22,7 @@
 #include "storage/v2/edge_ref.hpp"
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/property_store.hpp"
+#include "utils/lock_contention.hpp"
 #include "utils/rw_spin_lock.hpp"
 #include "utils/small_vector.hpp"
 
@@ -42,7 +43,7 @@ struct Vertex {
   utils::small_vector<std::tuple<EdgeTypeId, Vertex *, EdgeRef>> out_edges;
 
   PropertyStore properties;
-  mutable utils::RWSpinLock lock;
+  mutable utils::ProfiledLock<utils::RWSpinLock, utils::LockClass::VERTEX> lock;
   bool deleted;
   // uint8_t PAD;
   // uint16_t PAD;
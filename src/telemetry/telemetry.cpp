@@ -160,7 +160,7 @@ void Telemetry::AddEventsCollector() {
   AddCollector("event_counters", []() -> nlohmann::json {
     nlohmann::json ret;
     for (size_t i = 0; i < memgraph::metrics::CounterEnd(); ++i) {
-      ret[memgraph::metrics::GetCounterName(i)] = memgraph::metrics::global_counters[i].load(std::memory_order_relaxed);
+      ret[memgraph::metrics::GetCounterName(i)] = memgraph::metrics::GetCounterValue(i);
     }
     return ret;
   });
@@ -10,11 +10,19 @@
 // licenses/APL.txt.
 
 #include <zlib.h>
+#include <algorithm>
 #include <cstdint>
+#include <limits>
 #include <memory>
+#include <ranges>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "utils/compressor.hpp"
 #include "utils/flag_validation.hpp"
+#include "utils/on_scope_exit.hpp"
 
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables, misc-unused-parameters)
 DEFINE_VALIDATED_string(storage_property_store_compression_level, "mid",
@@ -54,6 +62,13 @@ utils::CompressionLevel ParseCompressionLevel() {
 
 namespace memgraph::utils {
 
+namespace {
+// zlib doesn't support smaller windows for compression.
+constexpr int kMinWindowBits = 10;
+// The default memory level of 8 goes with the default window of 15 bits, smaller windows get smaller hash tables.
+constexpr int kMemoryLevelBelowWindowBits = 7;
+}  // namespace
+
 int CompressionLevelToZlibCompressionLevel(CompressionLevel level) {
   switch (level) {
     case CompressionLevel::LOW:
@@ -134,6 +149,130 @@ auto ZlibCompressor::Decompress(std::span<uint8_t const> compressed_data, uint32
   return DecompressedBuffer{std::move(uncompressed_data), original_size};
 }
 
+auto CompressionDictionary::Train(std::span<std::span<uint8_t const> const> samples) -> CompressionDictionary {
+  // Substrings are counted as grams of a fixed size, each gram only once per sample.
+  constexpr size_t kGramSize = 8;
+  auto const as_string_view = [](uint8_t const *data, size_t size) {
+    return std::string_view{reinterpret_cast<char const *>(data), size};
+  };
+  std::unordered_map<std::string_view, uint32_t> sample_counts;
+  for (auto const sample : samples) {
+    std::unordered_set<std::string_view> sample_grams;
+    for (size_t i = 0; i + kGramSize <= sample.size(); ++i) {
+      auto const gram = as_string_view(sample.data() + i, kGramSize);
+      if (sample_grams.insert(gram).second) ++sample_counts[gram];
+    }
+  }
+
+  std::vector<std::pair<std::string_view, uint32_t>> grams;
+  for (auto const &[gram, count] : sample_counts) {
+    if (count > 1) grams.emplace_back(gram, count);
+  }
+  std::ranges::sort(grams, [](auto const &lhs, auto const &rhs) {
+    return std::tie(rhs.second, lhs.first) < std::tie(lhs.second, rhs.first);
+  });
+  if (grams.size() > kMaxSize / kGramSize) grams.resize(kMaxSize / kGramSize);
+
+  // zlib prefers references to the end of the dictionary, so the most common grams go last. A gram which overlaps
+  // with the end of the dictionary only adds its last byte.
+  CompressionDictionary dictionary;
+  auto &data = dictionary.data_;
+  std::unordered_set<std::string_view> added;
+  std::string added_grams;
+  for (auto const &[gram, _] : grams | std::views::reverse) {
+    if (added.contains(gram)) continue;
+    auto const overlaps = data.size() >= kGramSize - 1 &&
+                          as_string_view(data.data() + data.size() - (kGramSize - 1), kGramSize - 1) ==
+                              gram.substr(0, kGramSize - 1);
+    if (overlaps) {
+      data.push_back(static_cast<uint8_t>(gram.back()));
+    } else {
+      data.insert(data.end(), gram.begin(), gram.end());
+    }
+    added.insert(gram);
+  }
+  return dictionary;
+}
+
+auto ZlibCompressor::Compress(std::span<uint8_t const> uncompressed_data, CompressionDictionary const &dictionary) const
+    -> std::optional<CompressedBuffer> {
+  if (uncompressed_data.empty()) {
+    return CompressedBuffer{nullptr, 0, 0};
+  }
+  if (std::numeric_limits<uint32_t>::max() < uncompressed_data.size_bytes()) {
+    return std::nullopt;
+  }
+  auto original_size = static_cast<uint32_t>(uncompressed_data.size_bytes());
+
+  z_stream stream{};
+  auto compression_level = CompressionLevelToZlibCompressionLevel(memgraph::flags::ParseCompressionLevel());
+  // The window only needs to cover the dictionary and the data. The default one allocates and clears over 256KB for
+  // each stream, which dominates the compression of small buffers.
+  auto const dictionary_view = dictionary.view();
+  int window_bits = kMinWindowBits;
+  while (window_bits < MAX_WBITS && (size_t{1} << window_bits) < dictionary_view.size_bytes() + original_size) {
+    ++window_bits;
+  }
+  auto const memory_level = std::max(1, window_bits - kMemoryLevelBelowWindowBits);
+  if (deflateInit2(&stream, compression_level, Z_DEFLATED, window_bits, memory_level, Z_DEFAULT_STRATEGY) != Z_OK) {
+    return std::nullopt;
+  }
+  OnScopeExit const end_stream{[&stream] { deflateEnd(&stream); }};
+  // zlib rejects empty dictionaries
+  if (!dictionary_view.empty() &&
+      deflateSetDictionary(&stream, dictionary_view.data(), static_cast<uInt>(dictionary_view.size_bytes())) != Z_OK) {
+    return std::nullopt;
+  }
+
+  auto const buffer_size = static_cast<uint32_t>(deflateBound(&stream, original_size));
+  auto compressed_data = std::make_unique<uint8_t[]>(buffer_size);
+  // zlib doesn't modify the input, its API just isn't const correct
+  stream.next_in = const_cast<Bytef *>(uncompressed_data.data());
+  stream.avail_in = original_size;
+  stream.next_out = compressed_data.get();
+  stream.avail_out = buffer_size;
+  if (deflate(&stream, Z_FINISH) != Z_STREAM_END) {
+    return std::nullopt;
+  }
+
+  auto new_buffer_size = static_cast<uint32_t>(stream.total_out);
+  auto result_compressed_data = std::make_unique<uint8_t[]>(new_buffer_size);
+  std::copy_n(compressed_data.get(), new_buffer_size, result_compressed_data.get());
+  return CompressedBuffer{std::move(result_compressed_data), new_buffer_size, original_size};
+}
+
+auto ZlibCompressor::Decompress(std::span<uint8_t const> compressed_data, uint32_t original_size,
+                                CompressionDictionary const &dictionary) const -> std::optional<DecompressedBuffer> {
+  if (compressed_data.empty() || original_size == 0) {
+    return DecompressedBuffer{nullptr, 0};
+  }
+
+  z_stream stream{};
+  if (inflateInit(&stream) != Z_OK) {
+    return std::nullopt;
+  }
+  OnScopeExit const end_stream{[&stream] { inflateEnd(&stream); }};
+
+  auto uncompressed_data = std::make_unique<uint8_t[]>(original_size);
+  // zlib doesn't modify the input, its API just isn't const correct
+  stream.next_in = const_cast<Bytef *>(compressed_data.data());
+  stream.avail_in = static_cast<uInt>(compressed_data.size_bytes());
+  stream.next_out = uncompressed_data.get();
+  stream.avail_out = original_size;
+  auto result = inflate(&stream, Z_FINISH);
+  if (result == Z_NEED_DICT) {
+    auto const dictionary_view = dictionary.view();
+    if (inflateSetDictionary(&stream, dictionary_view.data(), static_cast<uInt>(dictionary_view.size_bytes())) !=
+        Z_OK) {
+      return std::nullopt;
+    }
+    result = inflate(&stream, Z_FINISH);
+  }
+  if (result != Z_STREAM_END || stream.total_out != original_size) return std::nullopt;
+
+  return DecompressedBuffer{std::move(uncompressed_data), original_size};
+}
+
 auto Compressor::GetInstance() -> Compressor const * {
   static std::unique_ptr<Compressor> const instance = std::make_unique<ZlibCompressor>();
   return instance.get();
@@ -1,4 +1,4 @@
-// Copyright 2024 Memgraph Ltd.
+// Copyright 2025 Memgraph Ltd.
 //
 // Use of this software is governed by the Business Source License
 // included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -17,7 +17,9 @@
 #include <zlib.h>
 #include <array>
 #include <memory>
+#include <span>
 #include <string_view>
+#include <vector>
 #include "utils/enum.hpp"
 
 namespace memgraph::utils {
@@ -85,6 +87,22 @@ struct DecompressedBuffer {
   uint32_t original_size_ = 0;
 };
 
+/// Preset dictionary which improves the compression of many small buffers with similar content, e.g. the properties
+/// of vertices. Buffers compressed with a dictionary can only be decompressed with the same dictionary.
+struct CompressionDictionary {
+  /// zlib hashes the whole dictionary into every new stream, which costs more than compressing a small buffer, and
+  /// the most common substrings are at its end anyway.
+  static constexpr uint32_t kMaxSize = 4 * 1024;
+
+  /// Picks the substrings which occur in the most samples. Empty if the samples have nothing in common.
+  static auto Train(std::span<std::span<uint8_t const> const> samples) -> CompressionDictionary;
+
+  auto view() const -> std::span<uint8_t const> { return data_; }
+
+ private:
+  std::vector<uint8_t> data_;
+};
+
 struct Compressor {
   static auto GetInstance() -> Compressor const *;
 
@@ -95,6 +113,12 @@ struct Compressor {
 
   virtual auto Decompress(std::span<uint8_t const> compressed_data, uint32_t original_size) const
       -> std::optional<DecompressedBuffer> = 0;
+
+  virtual auto Compress(std::span<uint8_t const> uncompressed_data, CompressionDictionary const &dictionary) const
+      -> std::optional<CompressedBuffer> = 0;
+
+  virtual auto Decompress(std::span<uint8_t const> compressed_data, uint32_t original_size,
+                          CompressionDictionary const &dictionary) const -> std::optional<DecompressedBuffer> = 0;
 };
 
 struct ZlibCompressor : public Compressor {
@@ -104,6 +128,12 @@ struct ZlibCompressor : public Compressor {
 
   auto Decompress(std::span<uint8_t const> compressed_data, uint32_t original_size) const
       -> std::optional<DecompressedBuffer> override;
+
+  auto Compress(std::span<uint8_t const> uncompressed_data, CompressionDictionary const &dictionary) const
+      -> std::optional<CompressedBuffer> override;
+
+  auto Decompress(std::span<uint8_t const> compressed_data, uint32_t original_size,
+                  CompressionDictionary const &dictionary) const -> std::optional<DecompressedBuffer> override;
 };
 
 }  // namespace memgraph::utils
@@ -11,6 +11,11 @@
 
 #include "utils/event_counter.hpp"
 
+#include <algorithm>
+#include <array>
+
+#include "utils/logging.hpp"
+
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
 #define GenerateHARpcCounters(NAME)                                                     \
   M(NAME##Success, HighAvailability, "Number of times " #NAME " finished successfully") \
@@ -113,6 +118,13 @@
                                                                                                                        \
   M(ShowSchema, SchemaInfo, "Number of times the user called \"SHOW SCHEMA INFO\" query")                              \
                                                                                                                        \
+  M(VertexLockContended, LockContention, "Number of times a vertex lock was acquired after waiting.")                  \
+  M(EdgeLockContended, LockContention, "Number of times an edge lock was acquired after waiting.")                     \
+  M(EngineLockContended, LockContention, "Number of times the storage engine lock was acquired after waiting.")        \
+  M(GcLockContended, LockContention, "Number of times the garbage collector lock was acquired after waiting.")         \
+  M(SkipListGcLockContended, LockContention, "Number of times a skip list GC lock was acquired after waiting.")        \
+  M(MainLockContended, LockContention, "Number of times the storage main lock was acquired after waiting.")            \
+                                                                                                                       \
   M(SuccessfulFailovers, HighAvailability, "Number of successful failovers performed on the coordinator.")             \
   M(RaftFailedFailovers, HighAvailability, "Number of failed failovers because of Raft on the coordinator.")           \
   M(NoAliveInstanceFailedFailovers, HighAvailability, "Number of failed failovers, no data instance was alive.")       \
@@ -145,27 +157,80 @@ APPLY_FOR_COUNTERS(M)
 
 inline constexpr Event END = __COUNTER__;
 
+// Each shard starts on its own cache line
+inline constexpr Event kCountersPerCacheLine = 64 / sizeof(Counter);
+inline constexpr Event kStride = (END + kCountersPerCacheLine - 1) / kCountersPerCacheLine * kCountersPerCacheLine;
+
 // Initialize array for the global counter with all values set to 0
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
-Counter global_counters_array[END]{};
+alignas(64) Counter global_counters_array[EventCounters::kShards * kStride]{};
 
 // Initialize global counters
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
-EventCounters global_counters(global_counters_array);
+EventCounters global_counters(global_counters_array, kStride);
+
+namespace {
+size_t ThisThreadShard() {
+  static std::atomic<size_t> next_shard{0};
+  thread_local const size_t shard = next_shard.fetch_add(1, std::memory_order_relaxed) % EventCounters::kShards;
+  return shard;
+}
+}  // namespace
 
 const Event EventCounters::num_counters = END;
 
 void EventCounters::Increment(const Event event, Count const amount) {
-  counters_[event].fetch_add(amount, std::memory_order_relaxed);
+  counters_[ThisThreadShard() * stride_ + event].fetch_add(amount, std::memory_order_relaxed);
 }
 
 void EventCounters::Decrement(const Event event, Count const amount) {
-  counters_[event].fetch_sub(amount, std::memory_order_relaxed);
+  counters_[ThisThreadShard() * stride_ + event].fetch_sub(amount, std::memory_order_relaxed);
+}
+
+// A shard can go below 0 when a thread decrements what another one incremented; the unsigned sum still wraps around
+// to the right count
+Count EventCounters::GetCount(const Event event) const {
+  Count count = 0;
+  for (size_t shard = 0; shard < kShards; ++shard) {
+    count += counters_[shard * stride_ + event].load(std::memory_order_acquire);
+  }
+  return count;
+}
+
+Count EventCounters::Reset(const Event event) {
+  Count count = 0;
+  for (size_t shard = 0; shard < kShards; ++shard) {
+    count += counters_[shard * stride_ + event].exchange(0, std::memory_order_acq_rel);
+  }
+  return count;
+}
+
+// Counters which are also decremented hold a current value instead of a running total
+bool IsCounterGauge(const Event event) {
+  static constexpr std::array kGaugeCounters{
+      ActiveSessions,
+      ActiveBoltSessions,
+      ActiveTCPSessions,
+      ActiveSSLSessions,
+      ActiveWebSocketSessions,
+      ActiveTransactions,
+      ActiveLabelIndices,
+      ActiveLabelPropertyIndices,
+      ActivePointIndices,
+      ActiveTextIndices,
+      ActiveVectorIndices,
+      UnreleasedDeltaObjects,
+  };
+  return std::ranges::find(kGaugeCounters, event) != kGaugeCounters.end();
 }
 
 void IncrementCounter(const Event event, Count const amount) { global_counters.Increment(event, amount); }
-void DecrementCounter(const Event event, Count const amount) { global_counters.Decrement(event, amount); }
+void DecrementCounter(const Event event, Count const amount) {
+  DMG_ASSERT(IsCounterGauge(event), "Only counters listed in IsCounterGauge can be decremented");
+  global_counters.Decrement(event, amount);
+}
 Count GetCounterValue(const Event event) { return global_counters.GetCount(event); }
+Count ResetCounterValue(const Event event) { return global_counters.Reset(event); }
 
 const char *GetCounterName(const Event event) {
   static const char *strings[] = {
@@ -19,24 +19,29 @@ using Event = uint64_t;
 using Count = uint64_t;
 using Counter = std::atomic<Count>;
 
+// Every thread counts into its own shard, so threads counting the same event don't contend on one cache line.
+// Reading a counter sums its shards.
 class EventCounters {
  public:
-  explicit EventCounters(Counter *allocated_counters) noexcept : counters_(allocated_counters) {}
+  static constexpr size_t kShards = 16;
 
-  auto &operator[](const Event event) { return counters_[event]; }
-
-  const auto &operator[](const Event event) const { return counters_[event]; }
+  // `allocated_counters` holds `kShards` runs of `stride` counters
+  EventCounters(Counter *allocated_counters, Event stride) noexcept : counters_(allocated_counters), stride_(stride) {}
 
   void Increment(Event event, Count amount = 1);
 
   void Decrement(Event event, Count amount = 1);
 
-  Count GetCount(const Event event) const { return counters_[event].load(std::memory_order_acquire); }
+  Count GetCount(Event event) const;
+
+  // Returns the count and sets it to 0
+  Count Reset(Event event);
 
   static const Event num_counters;
 
  private:
   Counter *counters_;
+  Event stride_;
 };
 
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
@@ -45,10 +50,13 @@ extern EventCounters global_counters;
 void IncrementCounter(Event event, Count amount = 1);
 void DecrementCounter(Event event, Count amount = 1);
 Count GetCounterValue(const Event event);
+Count ResetCounterValue(Event event);
 
 const char *GetCounterName(Event event);
 const char *GetCounterDocumentation(Event event);
 const char *GetCounterType(Event event);
+// True for counters which can also be decremented, exported as gauges
+bool IsCounterGauge(Event event);
 
 Event CounterEnd();
 }  // namespace memgraph::metrics
@@ -21,6 +21,8 @@
   M(QueryExecutionLatency_us, Query, "Query execution latency in microseconds", 50, 90, 99)                       \
   M(SnapshotCreationLatency_us, Snapshot, "Snapshot creation latency in microseconds", 50, 90, 99)                \
   M(SnapshotRecoveryLatency_us, Snapshot, "Snapshot recovery latency in microseconds", 50, 90, 99)                \
+  M(WalFsyncLatency_us, Durability, "Latency of syncing a WAL file to disk in microseconds", 50, 90, 99)          \
+  M(BoltQueueingDelay_us, Session, "Time a session's work waits for a worker in microseconds", 50, 90, 99)        \
   M(InstanceSuccCallback_us, HighAvailability, "Instance success callback in microseconds", 50, 90, 99)           \
   M(InstanceFailCallback_us, HighAvailability, "Instance failure callback in microseconds", 50, 90, 99)           \
   M(ChooseMostUpToDateInstance_us, HighAvailability, "Latency of choosing next main in microseconds", 50, 90, 99) \
@@ -29,6 +31,13 @@
   M(DataFailover_us, HighAvailability, "Latency of the failover procedure in microseconds", 50, 90, 99)           \
   M(StartTxnReplication_us, HighAvailability, "Latency of starting txn replication in us", 50, 90, 99)            \
   M(FinalizeTxnReplication_us, HighAvailability, "Latency of finishing txn replication in us", 50, 90, 99)        \
+  M(ExpiryLag_us, TTL, "Delay of deleting the oldest object expired at a TTL run in us", 50, 90, 99)              \
+  M(VertexLockWait_ns, LockContention, "Wait time of contended vertex locks in ns", 50, 90, 99)                   \
+  M(EdgeLockWait_ns, LockContention, "Wait time of contended edge locks in ns", 50, 90, 99)                       \
+  M(EngineLockWait_ns, LockContention, "Wait time of the contended storage engine lock in ns", 50, 90, 99)        \
+  M(GcLockWait_ns, LockContention, "Wait time of the contended garbage collector lock in ns", 50, 90, 99)         \
+  M(SkipListGcLockWait_ns, LockContention, "Wait time of contended skip list GC locks in ns", 50, 90, 99)         \
+  M(MainLockWait_ns, LockContention, "Wait time of the contended storage main lock in ns", 50, 90, 99)            \
   GenerateRpcTimer(PromoteToMainRpc)                                                                              \
   GenerateRpcTimer(DemoteMainToReplicaRpc)                                                                        \
   GenerateRpcTimer(RegisterReplicaOnMainRpc)                                                                      \
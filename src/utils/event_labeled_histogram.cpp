@@ -0,0 +1,125 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "utils/event_labeled_histogram.hpp"
+
+// clang-format off
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define APPLY_FOR_LABELED_HISTOGRAMS(M)                                                                                \
+  M(QueryLatency_us, Query, "Query execution latency in microseconds", "database", "query_type")                       \
+  M(OperatorTime_us, Operator, "Time spent in an operator of a sampled query in microseconds", "database", "operator") \
+  M(OperatorRows, Operator, "Rows produced by an operator of a sampled query", "database", "operator")                 \
+  M(GcLatency_us, Memory, "Garbage collection latency in microseconds", "database")                                    \
+  M(SnapshotPhaseLatency_us, Snapshot, "Latency of a snapshot creation phase in microseconds", "phase")
+// clang-format on
+
+namespace memgraph::metrics {
+
+// define every Event as an index in the array of labeled histograms
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define M(NAME, TYPE, DOCUMENTATION, ...) extern const Event NAME = __COUNTER__;
+APPLY_FOR_LABELED_HISTOGRAMS(M)
+#undef M
+
+inline constexpr Event END = __COUNTER__;
+
+namespace {
+// Initialize array for the global labeled histograms, all with the same percentiles
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+LabeledHistogram global_labeled_histograms[END]{
+
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define M(NAME, TYPE, DOCUMENTATION, ...) LabeledHistogram({50, 90, 99}),
+    APPLY_FOR_LABELED_HISTOGRAMS(M)
+#undef M
+};
+}  // namespace
+
+void LabeledHistogram::Measure(std::initializer_list<std::string_view> label_values, Value const value) {
+  {
+    auto series = series_.ReadLock();
+    if (auto it = series->find(label_values); it != series->end()) {
+      it->second->Measure(value);
+      return;
+    }
+  }
+  auto series = series_.Lock();
+  auto it = series->find(label_values);
+  if (it == series->end()) {
+    if (series->size() >= kMaxSeries) return;
+    it = series
+             ->emplace(std::vector<std::string>(label_values.begin(), label_values.end()),
+                       std::make_unique<Histogram>(percentiles_))
+             .first;
+  }
+  it->second->Measure(value);
+}
+
+void LabeledHistogram::ForEach(
+    const std::function<void(const std::vector<std::string> &, const Histogram &)> &f) const {
+  auto series = series_.ReadLock();
+  for (const auto &[label_values, histogram] : *series) {
+    f(label_values, *histogram);
+  }
+}
+
+void MeasureLabeled(const Event event, std::initializer_list<std::string_view> label_values, Value const value) {
+  global_labeled_histograms[event].Measure(label_values, value);
+}
+
+const LabeledHistogram &GetLabeledHistogram(const Event event) { return global_labeled_histograms[event]; }
+
+const char *GetLabeledHistogramName(const Event event) {
+  static const char *strings[] = {
+  // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define M(NAME, TYPE, DOCUMENTATION, ...) #NAME,
+      APPLY_FOR_LABELED_HISTOGRAMS(M)
+#undef M
+  };
+
+  return strings[event];
+}
+
+const char *GetLabeledHistogramDocumentation(const Event event) {
+  static const char *strings[] = {
+  // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define M(NAME, TYPE, DOCUMENTATION, ...) DOCUMENTATION,
+      APPLY_FOR_LABELED_HISTOGRAMS(M)
+#undef M
+  };
+
+  return strings[event];
+}
+
+const char *GetLabeledHistogramType(const Event event) {
+  static const char *strings[] = {
+  // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define M(NAME, TYPE, DOCUMENTATION, ...) #TYPE,
+      APPLY_FOR_LABELED_HISTOGRAMS(M)
+#undef M
+  };
+
+  return strings[event];
+}
+
+const std::vector<std::string_view> &GetLabeledHistogramLabels(const Event event) {
+  static const std::vector<std::string_view> labels[] = {
+  // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define M(NAME, TYPE, DOCUMENTATION, ...) {__VA_ARGS__},
+      APPLY_FOR_LABELED_HISTOGRAMS(M)
+#undef M
+  };
+
+  return labels[event];
+}
+
+Event LabeledHistogramEnd() { return END; }
+}  // namespace memgraph::metrics
@@ -0,0 +1,69 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "utils/event_histogram.hpp"
+#include "utils/rw_spin_lock.hpp"
+#include "utils/synchronized.hpp"
+
+namespace memgraph::metrics {
+
+// A family of histograms told apart by the values of their labels, e.g. query latency by database and query type.
+// The histogram of a combination of label values is created the first time it is measured. A family holds at most
+// kMaxSeries histograms and drops the measurements of any further combinations, so that a label with unbounded
+// values can't take all the memory.
+class LabeledHistogram {
+ public:
+  static constexpr size_t kMaxSeries = 1000;
+
+  explicit LabeledHistogram(std::vector<uint8_t> percentiles) : percentiles_(std::move(percentiles)) {}
+
+  void Measure(std::initializer_list<std::string_view> label_values, Value value);
+
+  // Calls `f` with the label values and the histogram of every combination measured so far
+  void ForEach(const std::function<void(const std::vector<std::string> &, const Histogram &)> &f) const;
+
+ private:
+  struct LabelValuesLess {
+    using is_transparent = void;
+
+    bool operator()(const auto &lhs, const auto &rhs) const {
+      return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+  };
+
+  using Series = std::map<std::vector<std::string>, std::unique_ptr<Histogram>, LabelValuesLess>;
+
+  std::vector<uint8_t> percentiles_;
+  utils::Synchronized<Series, utils::RWSpinLock> series_;
+};
+
+void MeasureLabeled(Event event, std::initializer_list<std::string_view> label_values, Value value);
+
+const LabeledHistogram &GetLabeledHistogram(Event event);
+const char *GetLabeledHistogramName(Event event);
+const char *GetLabeledHistogramDocumentation(Event event);
+const char *GetLabeledHistogramType(Event event);
+const std::vector<std::string_view> &GetLabeledHistogramLabels(Event event);
+
+Event LabeledHistogramEnd();
+}  // namespace memgraph::metrics
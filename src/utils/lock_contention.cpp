@@ -0,0 +1,112 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "utils/lock_contention.hpp"
+
+#include <algorithm>
+#include <array>
+#include <mutex>
+
+#include "utils/event_counter.hpp"
+#include "utils/event_histogram.hpp"
+#include "utils/logging.hpp"
+#include "utils/spin_lock.hpp"
+
+namespace memgraph::metrics {
+extern const Event VertexLockContended;
+extern const Event EdgeLockContended;
+extern const Event EngineLockContended;
+extern const Event GcLockContended;
+extern const Event SkipListGcLockContended;
+extern const Event MainLockContended;
+
+extern const Event VertexLockWait_ns;
+extern const Event EdgeLockWait_ns;
+extern const Event EngineLockWait_ns;
+extern const Event GcLockWait_ns;
+extern const Event SkipListGcLockWait_ns;
+extern const Event MainLockWait_ns;
+}  // namespace memgraph::metrics
+
+namespace memgraph::utils {
+
+namespace {
+std::pair<metrics::Event, metrics::Event> LockClassEvents(LockClass lock_class) {
+  switch (lock_class) {
+    case LockClass::VERTEX:
+      return {metrics::VertexLockContended, metrics::VertexLockWait_ns};
+    case LockClass::EDGE:
+      return {metrics::EdgeLockContended, metrics::EdgeLockWait_ns};
+    case LockClass::ENGINE:
+      return {metrics::EngineLockContended, metrics::EngineLockWait_ns};
+    case LockClass::GC:
+      return {metrics::GcLockContended, metrics::GcLockWait_ns};
+    case LockClass::SKIP_LIST_GC:
+      return {metrics::SkipListGcLockContended, metrics::SkipListGcLockWait_ns};
+    case LockClass::MAIN:
+      return {metrics::MainLockContended, metrics::MainLockWait_ns};
+  }
+  LOG_FATAL("Unexpected LockClass");
+}
+
+// Space-saving top-k: a conflict on an untracked object replaces the least
+// conflicted one and inherits its count, so frequent objects can't be pushed
+// out by a stream of rare ones.
+class WriteConflicts {
+ public:
+  static constexpr size_t kTracked = 16;
+
+  void Record(uint64_t gid) {
+    auto guard = std::lock_guard{lock_};
+    auto *min = &entries_[0];
+    for (auto &entry : entries_) {
+      if (entry.second != 0 && entry.first == gid) {
+        ++entry.second;
+        return;
+      }
+      if (entry.second < min->second) min = &entry;
+    }
+    *min = {gid, min->second + 1};
+  }
+
+  std::vector<std::pair<uint64_t, uint64_t>> Top() {
+    std::vector<std::pair<uint64_t, uint64_t>> top;
+    {
+      auto guard = std::lock_guard{lock_};
+      std::copy_if(entries_.begin(), entries_.end(), std::back_inserter(top),
+                   [](const auto &entry) { return entry.second != 0; });
+    }
+    std::sort(top.begin(), top.end(), [](const auto &lhs, const auto &rhs) { return lhs.second > rhs.second; });
+    return top;
+  }
+
+ private:
+  SpinLock lock_;
+  std::array<std::pair<uint64_t, uint64_t>, kTracked> entries_{};
+};
+
+WriteConflicts &GetWriteConflicts() {
+  static WriteConflicts write_conflicts;
+  return write_conflicts;
+}
+}  // namespace
+
+void RecordLockWait(LockClass lock_class, std::chrono::nanoseconds wait) {
+  const auto [counter, histogram] = LockClassEvents(lock_class);
+  metrics::IncrementCounter(counter);
+  metrics::Measure(histogram, wait.count());
+}
+
+void RecordWriteConflict(uint64_t gid) { GetWriteConflicts().Record(gid); }
+
+std::vector<std::pair<uint64_t, uint64_t>> TopWriteConflicts() { return GetWriteConflicts().Top(); }
+
+}  // namespace memgraph::utils
@@ -0,0 +1,95 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace memgraph::utils {
+
+// Storage locks whose contention is profiled when built with MG_LOCK_CONTENTION_PROFILE.
+enum class LockClass : uint8_t {
+  VERTEX,
+  EDGE,
+  ENGINE,
+  GC,
+  SKIP_LIST_GC,
+  MAIN,
+};
+
+// Counts a contended acquisition of a lock of the given class and measures how long it waited.
+void RecordLockWait(LockClass lock_class, std::chrono::nanoseconds wait);
+
+// Counts a write-write conflict on the object with the given gid. Only the most conflicted
+// objects are kept, so the top of the list points at supernodes that serialize writers.
+void RecordWriteConflict(uint64_t gid);
+
+// The most conflicted objects as (gid, conflicts), sorted by the number of conflicts.
+std::vector<std::pair<uint64_t, uint64_t>> TopWriteConflicts();
+
+// Measures the time until it's destroyed as a wait on a lock of the given class.
+class LockWaitTimer {
+ public:
+  explicit LockWaitTimer(LockClass lock_class)
+      : lock_class_(lock_class), start_(std::chrono::steady_clock::now()) {}
+
+  ~LockWaitTimer() { RecordLockWait(lock_class_, std::chrono::steady_clock::now() - start_); }
+
+  LockWaitTimer(const LockWaitTimer &) = delete;
+  LockWaitTimer &operator=(const LockWaitTimer &) = delete;
+  LockWaitTimer(LockWaitTimer &&) = delete;
+  LockWaitTimer &operator=(LockWaitTimer &&) = delete;
+
+ private:
+  LockClass lock_class_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+/**
+ * A lock that first tries to acquire the underlying lock and, only if that
+ * fails, times the blocking acquisition. The uncontended path costs a single
+ * extra try, the clock is read only once threads actually wait.
+ **/
+template <typename TLock, LockClass kClass>
+struct ContentionProfiledLock : TLock {
+  using TLock::TLock;
+
+  void lock() {
+    if (TLock::try_lock()) [[likely]]
+      return;
+    const LockWaitTimer timer{kClass};
+    TLock::lock();
+  }
+
+  void lock_shared()
+    requires requires(TLock &lock) { lock.try_lock_shared(); }
+  {
+    if (TLock::try_lock_shared()) [[likely]]
+      return;
+    const LockWaitTimer timer{kClass};
+    TLock::lock_shared();
+  }
+};
+
+// The lock type to use for a profiled lock class. Without MG_LOCK_CONTENTION_PROFILE it is the
+// underlying lock itself, so the profiling has no cost unless it is compiled in.
+#ifdef MG_LOCK_CONTENTION_PROFILE
+template <typename TLock, LockClass kClass>
+using ProfiledLock = ContentionProfiledLock<TLock, kClass>;
+#else
+template <typename TLock, LockClass kClass>
+using ProfiledLock = TLock;
+#endif
+
+}  // namespace memgraph::utils
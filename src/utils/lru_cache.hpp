@@ -1,4 +1,4 @@
-// Copyright 2023 Memgraph Ltd.
+// Copyright 2025 Memgraph Ltd.
 //
 // Use of this software is governed by the Business Source License
 // included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include <cstddef>
+#include <limits>
 #include <list>
 #include <optional>
 #include <unordered_map>
@@ -20,20 +22,28 @@ namespace memgraph::utils {
 
 /// A simple LRU cache implementation.
 /// It is not thread-safe.
+/// Besides the number of items, the cache can be limited by the total size of
+/// its items, as given to `put`. The least recently used items are evicted
+/// until both limits are met.
 
 template <class TKey, class TVal>
 class LRUCache {
  public:
-  explicit LRUCache(int cache_size_) : cache_size(cache_size_){};
+  explicit LRUCache(int cache_size_, std::size_t max_bytes_ = std::numeric_limits<std::size_t>::max())
+      : cache_size(cache_size_), max_bytes(max_bytes_){};
 
-  void put(const TKey &key, const TVal &val) {
+  void put(const TKey &key, const TVal &val, std::size_t bytes = 0) {
     auto it = item_map.find(key);
     if (it != item_map.end()) {
+      total_bytes -= it->second->bytes;
       item_list.erase(it->second);
       item_map.erase(it);
     }
-    item_list.push_front(std::make_pair(key, val));
+    // Caching an item over the whole budget would only evict everything else
+    if (bytes > max_bytes) return;
+    item_list.push_front(Item{key, val, bytes});
     item_map.insert(std::make_pair(key, item_list.begin()));
+    total_bytes += bytes;
     try_clean();
   };
   std::optional<TVal> get(const TKey &key) {
@@ -42,27 +52,47 @@ class LRUCache {
     }
     auto it = item_map.find(key);
     item_list.splice(item_list.begin(), item_list, it->second);
-    return it->second->second;
+    return it->second->val;
   }
   void reset() {
     item_list.clear();
     item_map.clear();
+    total_bytes = 0;
   };
   std::size_t size() { return item_map.size(); };
+  /// Total size of the cached items, as given to `put`.
+  std::size_t bytes() const { return total_bytes; };
+
+  /// Calls `func` with each key and value, from the most to the least recently used.
+  template <typename TFunc>
+  void for_each(TFunc &&func) const {
+    for (const auto &item : item_list) {
+      func(item.key, item.val);
+    }
+  }
 
  private:
+  struct Item {
+    TKey key;
+    TVal val;
+    std::size_t bytes;
+  };
+
   void try_clean() {
-    while (item_map.size() > cache_size) {
+    while (item_map.size() > cache_size || total_bytes > max_bytes) {
       auto last_it_elem_it = item_list.end();
       last_it_elem_it--;
-      item_map.erase(last_it_elem_it->first);
+      total_bytes -= last_it_elem_it->bytes;
+      item_map.erase(last_it_elem_it->key);
       item_list.pop_back();
     }
   };
   bool exists(const TKey &key) { return (item_map.count(key) > 0); };
 
-  std::list<std::pair<TKey, TVal>> item_list;
+  std::list<Item> item_list;
   std::unordered_map<TKey, decltype(item_list.begin())> item_map;
   std::size_t cache_size;
+  std::size_t max_bytes;
+  std::size_t total_bytes{0};
 };
 }  // namespace memgraph::utils
@@ -1,4 +1,4 @@
-// Copyright 2024 Memgraph Ltd.
+// Copyright 2025 Memgraph Ltd.
 //
 // Use of this software is governed by the Business Source License
 // included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -17,12 +17,24 @@
 
 namespace memgraph::utils {
 
+QueryMemoryTracker::~QueryMemoryTracker() {
+  if (database_tracker_) database_tracker_->Free(database_amount_.load(std::memory_order_acquire));
+}
+
 bool QueryMemoryTracker::TrackAlloc(size_t size) {
   if (query_tracker_.has_value()) [[likely]] {
     bool ok = query_tracker_->Alloc(static_cast<int64_t>(size));
     if (!ok) return false;
   }
 
+  if (database_tracker_) {
+    if (!database_tracker_->Alloc(static_cast<int64_t>(size))) {
+      if (query_tracker_.has_value()) query_tracker_->Free(static_cast<int64_t>(size));
+      return false;
+    }
+    database_amount_.fetch_add(static_cast<int64_t>(size), std::memory_order_relaxed);
+  }
+
   auto *proc_tracker = GetActiveProc();
 
   if (proc_tracker == nullptr) {
@@ -36,6 +48,11 @@ void QueryMemoryTracker::TrackFree(size_t size) {
     query_tracker_->Free(static_cast<int64_t>(size));
   }
 
+  if (database_tracker_) {
+    database_tracker_->Free(static_cast<int64_t>(size));
+    database_amount_.fetch_sub(static_cast<int64_t>(size), std::memory_order_relaxed);
+  }
+
   auto *proc_tracker = GetActiveProc();
 
   if (proc_tracker == nullptr) {
@@ -75,6 +92,13 @@ void QueryMemoryTracker::TryCreateProcTracker(int64_t procedure_id, size_t limit
   it->second.SetHardLimit(static_cast<int64_t>(limit));
 }
 
+std::optional<int64_t> QueryMemoryTracker::QueryPeak() const {
+  if (!query_tracker_) return std::nullopt;
+  return query_tracker_->Peak();
+}
+
+void QueryMemoryTracker::SetDatabaseTracker(MemoryTracker *database_tracker) { database_tracker_ = database_tracker; }
+
 void QueryMemoryTracker::InitializeQueryTracker() { query_tracker_.emplace(); }
 
 }  // namespace memgraph::utils
@@ -10,6 +10,7 @@
 // licenses/APL.txt.
 #pragma once
 
+#include <atomic>
 #include <optional>
 #include <unordered_map>
 #include <utility>
@@ -31,7 +32,9 @@ class QueryMemoryTracker {
   QueryMemoryTracker(QueryMemoryTracker &&other) noexcept
       : query_tracker_(std::move(other.query_tracker_)),
         proc_memory_trackers_(std::move(other.proc_memory_trackers_)),
-        active_proc_id(other.active_proc_id) {
+        active_proc_id(other.active_proc_id),
+        database_tracker_(std::exchange(other.database_tracker_, nullptr)),
+        database_amount_(other.database_amount_.exchange(0, std::memory_order_acq_rel)) {
     other.active_proc_id = NO_PROCEDURE;
   }
 
@@ -40,7 +43,7 @@ class QueryMemoryTracker {
   QueryMemoryTracker &operator=(QueryMemoryTracker &&other) = delete;
   QueryMemoryTracker &operator=(const QueryMemoryTracker &other) = delete;
 
-  ~QueryMemoryTracker() = default;
+  ~QueryMemoryTracker();
 
   // Track allocation on query and procedure if active
   bool TrackAlloc(size_t size);
@@ -60,6 +63,13 @@ class QueryMemoryTracker {
   // Stop procedure tracking
   void StopProcTracking();
 
+  // Peak memory of the query, if the query is tracked
+  std::optional<int64_t> QueryPeak() const;
+
+  // Also track the query on a tracker shared by all queries of its database.
+  // Whatever the query still holds is given back to it on destruction.
+  void SetDatabaseTracker(MemoryTracker *database_tracker);
+
  private:
   static constexpr int64_t NO_PROCEDURE{-1};
   void InitializeQueryTracker();
@@ -72,6 +82,10 @@ class QueryMemoryTracker {
   int64_t active_proc_id{NO_PROCEDURE};
 
   memgraph::utils::MemoryTracker *GetActiveProc();
+
+  memgraph::utils::MemoryTracker *database_tracker_{nullptr};
+  // Amount the query has charged to the database tracker
+  std::atomic<int64_t> database_amount_{0};
 };
 
 }  // namespace memgraph::utils
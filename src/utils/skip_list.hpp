@@ -13,6 +13,7 @@
 
 #include "utils/bound.hpp"
 #include "utils/counter.hpp"
+#include "utils/lock_contention.hpp"
 #include "utils/math.hpp"
 #include "utils/memory.hpp"
 #include "utils/rw_spin_lock.hpp"
@@ -397,7 +398,7 @@ class SkipListGc final {
 
  private:
   MemoryResource *memory_;
-  RWSpinLock lock_;
+  ProfiledLock<RWSpinLock, LockClass::SKIP_LIST_GC> lock_;
   std::atomic<uint64_t> accessor_id_{0};
   std::atomic<Block *> head_{nullptr};
   std::atomic<Block *> tail_{nullptr};
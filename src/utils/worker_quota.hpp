@@ -0,0 +1,86 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+
+namespace memgraph::utils {
+
+/**
+ * Limits how many workers of a shared pool can be running tasks of one group
+ * (e.g. one database) at the same time. A task that doesn't get a slot isn't
+ * blocked; it leaves a callback which is invoked once a slot is released so the
+ * task can be scheduled on the pool again. Workers are therefore never held by
+ * a group that is over its quota and stay free for the other groups.
+ *
+ * A limit of 0 means no limit.
+ **/
+class WorkerQuota {
+ public:
+  using Resume = std::function<void()>;
+
+  explicit WorkerQuota(uint32_t limit) : limit_{limit} {}
+
+  WorkerQuota(const WorkerQuota &) = delete;
+  WorkerQuota &operator=(const WorkerQuota &) = delete;
+  WorkerQuota(WorkerQuota &&) = delete;
+  WorkerQuota &operator=(WorkerQuota &&) = delete;
+  ~WorkerQuota() = default;
+
+  // Takes a slot if one is free. Otherwise keeps `resume` to be called when
+  // the next slot is released and returns false.
+  bool TryAcquire(Resume resume) {
+    auto guard = std::lock_guard{mtx_};
+    if (limit_ == 0 || running_ < limit_) {
+      ++running_;
+      return true;
+    }
+    parked_.emplace_back(std::move(resume));
+    return false;
+  }
+
+  // Releases a slot taken by TryAcquire and resumes the oldest parked task.
+  void Release() {
+    std::optional<Resume> resume;
+    {
+      auto guard = std::lock_guard{mtx_};
+      --running_;
+      if (!parked_.empty()) {
+        resume.emplace(std::move(parked_.front()));
+        parked_.pop_front();
+      }
+    }
+    if (resume) (*resume)();
+  }
+
+  uint32_t Running() const {
+    auto guard = std::lock_guard{mtx_};
+    return running_;
+  }
+
+  size_t Parked() const {
+    auto guard = std::lock_guard{mtx_};
+    return parked_.size();
+  }
+
+ private:
+  mutable std::mutex mtx_;
+  const uint32_t limit_;
+  uint32_t running_{0};
+  std::deque<Resume> parked_;
+};
+
+}  // namespace memgraph::utils
@@ -0,0 +1,79 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <cstdint>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "utils/compressor.hpp"
+
+namespace {
+// Buffers which look like encoded properties of similar vertices, drawn from a vocabulary large enough to fill the
+// dictionary
+std::vector<uint8_t> MakeBuffer(size_t size, uint32_t seed) {
+  constexpr uint32_t kVocabularySize = 4096;
+  std::mt19937 gen(seed);
+  std::vector<uint8_t> buffer;
+  buffer.reserve(size);
+  while (buffer.size() < size) {
+    auto const word = "property_" + std::to_string(gen() % kVocabularySize) + ";";
+    buffer.insert(buffer.end(), word.begin(), word.begin() + std::min(word.size(), size - buffer.size()));
+  }
+  return buffer;
+}
+
+memgraph::utils::CompressionDictionary MakeDictionary() {
+  std::vector<std::vector<uint8_t>> samples;
+  for (uint32_t i = 0; i < 1000; ++i) samples.push_back(MakeBuffer(256, i));
+  std::vector<std::span<uint8_t const>> sample_views(samples.begin(), samples.end());
+  return memgraph::utils::CompressionDictionary::Train(sample_views);
+}
+}  // namespace
+
+// NOLINTNEXTLINE(google-runtime-references)
+static void CompressWithDictionary(benchmark::State &state) {
+  auto const dictionary = MakeDictionary();
+  auto const buffer = MakeBuffer(state.range(0), 1234);
+  auto const *compressor = memgraph::utils::Compressor::GetInstance();
+  uint64_t compressed_size = 0;
+  for (auto _ : state) {
+    auto compressed = compressor->Compress(buffer, dictionary);
+    compressed_size = compressed->view().size();
+    benchmark::DoNotOptimize(compressed);
+  }
+  state.counters["compressed_size"] = static_cast<double>(compressed_size);
+  state.counters["dictionary_size"] = static_cast<double>(dictionary.view().size());
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * buffer.size()));
+}
+
+BENCHMARK(CompressWithDictionary)->RangeMultiplier(4)->Range(64, 16384)->Unit(benchmark::kNanosecond);
+
+// NOLINTNEXTLINE(google-runtime-references)
+static void CompressWithoutDictionary(benchmark::State &state) {
+  auto const buffer = MakeBuffer(state.range(0), 1234);
+  auto const *compressor = memgraph::utils::Compressor::GetInstance();
+  uint64_t compressed_size = 0;
+  for (auto _ : state) {
+    auto compressed = compressor->Compress(buffer);
+    compressed_size = compressed->view().size();
+    benchmark::DoNotOptimize(compressed);
+  }
+  state.counters["compressed_size"] = static_cast<double>(compressed_size);
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * buffer.size()));
+}
+
+BENCHMARK(CompressWithoutDictionary)->RangeMultiplier(4)->Range(64, 16384)->Unit(benchmark::kNanosecond);
+
+BENCHMARK_MAIN();
@@ -54,6 +54,11 @@ startup_config_dict = {
         "12",
         "Number of workers used by the Bolt server. By default, this will be the number of processing units available on the machine.",
     ),
+    "bolt_num_workers_per_database": (
+        "0",
+        "0",
+        "Maximum number of Bolt workers that can execute Cypher queries of a single database at the same time. Sessions over the limit wait for one of their database's workers instead of taking workers from other databases. Set to 0 to not limit it.",
+    ),
     "bolt_port": ("7687", "7687", "Port on which the Bolt server should listen."),
     "bolt_server_name_for_init": (
         "Neo4j/v5.11.0 compatible graph database server - Memgraph",
@@ -100,6 +105,11 @@ startup_config_dict = {
         "0",
         "Total memory limit in MiB. Set to 0 to use the default values which are 100% of the phyisical memory if the swap is enabled and 90% of the physical memory otherwise.",
     ),
+    "memory_limit_per_database": (
+        "0",
+        "0",
+        "Memory limit in MiB shared by all queries running on a single database at the same time, on top of the limits of the queries themselves. When set, every query's allocations are tracked, not only those of queries with their own limit. Set to 0 to not limit it.",
+    ),
     "memory_warning_threshold": (
         "1024",
         "1024",
@@ -157,11 +167,21 @@ startup_config_dict = {
         "false",
         "Controls whether the properties should be compressed in the storage.",
     ),
+    "storage_property_store_compression_dictionary_enabled": (
+        "false",
+        "false",
+        "Controls whether compressed properties should use a dictionary trained from the first compressed properties, which compresses small records much better.",
+    ),
     "storage_property_store_compression_level": (
         "mid",
         "mid",
         "Compression level for storing properties. Allowed values: low, mid, high.",
     ),
+    "storage_property_store_shapes_enabled": (
+        "false",
+        "false",
+        "Controls whether the properties should be stored without their property IDs, which are kept in a shape shared by all vertices and edges with the same set of properties.",
+    ),
     "password_encryption_algorithm": ("bcrypt", "bcrypt", "The password encryption algorithm used for authentication."),
     "pulsar_service_url": ("", "", "Default URL used while connecting to Pulsar brokers."),
     "query_execution_timeout_sec": (
@@ -223,6 +243,11 @@ startup_config_dict = {
         "Default storage mode Memgraph uses. Allowed values: IN_MEMORY_TRANSACTIONAL, IN_MEMORY_ANALYTICAL, ON_DISK_TRANSACTIONAL",
     ),
     "storage_wal_file_size_kib": ("20480", "20480", "Minimum file size of each WAL file."),
+    "stream_batch_queries": (
+        "false",
+        "false",
+        "Set to true to execute consecutive queries with the same text returned by a stream transformation as a single UNWIND over their parameters. The batched queries don't see each other's changes, except through MERGE.",
+    ),
     "stream_transaction_conflict_retries": (
         "30",
         "30",
@@ -243,8 +268,39 @@ startup_config_dict = {
         "UTC",
         "Define instance's timezone (IANA format).",
     ),
+    "trigger_after_commit_batch_size": (
+        "1",
+        "1",
+        "Maximum number of committed transactions whose changes are passed to a single run of the AFTER COMMIT triggers. Transactions that commit while the triggers are running are coalesced into the next run. 1 runs the triggers once per transaction.",
+    ),
+    "query_ast_cache_max_size": ("10000", "10000", "Maximum number of parsed queries to cache."),
     "query_cost_planner": ("true", "true", "Use the cost-estimating query planner."),
+    "query_plan_cache_max_bytes": (
+        "134217728",
+        "134217728",
+        "Maximum estimated memory in bytes taken by the cached query plans of a database. The least recently used plans are evicted over it. 0 means no limit.",
+    ),
     "query_plan_cache_max_size": ("1000", "1000", "Maximum number of query plans to cache."),
+    "query_plan_cache_replan_ratio": (
+        "100",
+        "100",
+        "Plan a cached query again once the rows it returns differ from the plan's estimate by at least this factor. 0 disables re-planning.",
+    ),
+    "query_profile_sample_rate": (
+        "0",
+        "0",
+        "Fraction of cached query executions that are profiled per operator. The statistics are summed per cached plan and listed by SHOW QUERY STATISTICS. 0 disables sampling.",
+    ),
+    "query_log_slow_threshold_ms": (
+        "0",
+        "0",
+        "Queries whose execution takes at least this many milliseconds are written to the slow query log in the data directory, together with their plan. 0 disables the latency threshold.",
+    ),
+    "query_log_slow_memory_threshold_mb": (
+        "0",
+        "0",
+        "Queries that allocate at least this many MiB are written to the slow query log. Only queries run with a memory limit track their allocations. 0 disables the memory threshold.",
+    ),
     "query_vertex_count_to_expand_existing": (
         "10",
         "10",
@@ -17,6 +17,9 @@ from common import memgraph
 
 def test_all_show_metrics_info_values_are_present(memgraph):
     expected_metrics = [
+        {"name": "WalFsyncLatency_us_50p", "type": "Durability", "metric type": "Histogram"},
+        {"name": "WalFsyncLatency_us_90p", "type": "Durability", "metric type": "Histogram"},
+        {"name": "WalFsyncLatency_us_99p", "type": "Durability", "metric type": "Histogram"},
         {"name": "AverageDegree", "type": "General", "metric type": "Gauge"},
         {"name": "EdgeCount", "type": "General", "metric type": "Gauge"},
         {"name": "VertexCount", "type": "General", "metric type": "Gauge"},
@@ -120,6 +123,30 @@ def test_all_show_metrics_info_values_are_present(memgraph):
         {"name": "ActivePointIndices", "type": "Index", "metric type": "Counter"},
         {"name": "ActiveTextIndices", "type": "Index", "metric type": "Counter"},
         {"name": "ActiveVectorIndices", "type": "Index", "metric type": "Counter"},
+        {"name": "EdgeLockContended", "type": "LockContention", "metric type": "Counter"},
+        {"name": "EngineLockContended", "type": "LockContention", "metric type": "Counter"},
+        {"name": "GcLockContended", "type": "LockContention", "metric type": "Counter"},
+        {"name": "MainLockContended", "type": "LockContention", "metric type": "Counter"},
+        {"name": "SkipListGcLockContended", "type": "LockContention", "metric type": "Counter"},
+        {"name": "VertexLockContended", "type": "LockContention", "metric type": "Counter"},
+        {"name": "EdgeLockWait_ns_50p", "type": "LockContention", "metric type": "Histogram"},
+        {"name": "EdgeLockWait_ns_90p", "type": "LockContention", "metric type": "Histogram"},
+        {"name": "EdgeLockWait_ns_99p", "type": "LockContention", "metric type": "Histogram"},
+        {"name": "EngineLockWait_ns_50p", "type": "LockContention", "metric type": "Histogram"},
+        {"name": "EngineLockWait_ns_90p", "type": "LockContention", "metric type": "Histogram"},
+        {"name": "EngineLockWait_ns_99p", "type": "LockContention", "metric type": "Histogram"},
+        {"name": "GcLockWait_ns_50p", "type": "LockContention", "metric type": "Histogram"},
+        {"name": "GcLockWait_ns_90p", "type": "LockContention", "metric type": "Histogram"},
+        {"name": "GcLockWait_ns_99p", "type": "LockContention", "metric type": "Histogram"},
+        {"name": "MainLockWait_ns_50p", "type": "LockContention", "metric type": "Histogram"},
+        {"name": "MainLockWait_ns_90p", "type": "LockContention", "metric type": "Histogram"},
+        {"name": "MainLockWait_ns_99p", "type": "LockContention", "metric type": "Histogram"},
+        {"name": "SkipListGcLockWait_ns_50p", "type": "LockContention", "metric type": "Histogram"},
+        {"name": "SkipListGcLockWait_ns_90p", "type": "LockContention", "metric type": "Histogram"},
+        {"name": "SkipListGcLockWait_ns_99p", "type": "LockContention", "metric type": "Histogram"},
+        {"name": "VertexLockWait_ns_50p", "type": "LockContention", "metric type": "Histogram"},
+        {"name": "VertexLockWait_ns_90p", "type": "LockContention", "metric type": "Histogram"},
+        {"name": "VertexLockWait_ns_99p", "type": "LockContention", "metric type": "Histogram"},
         {"name": "UnreleasedDeltaObjects", "type": "Memory", "metric type": "Counter"},
         {"name": "DiskUsage", "type": "Memory", "metric type": "Gauge"},
         {"name": "MemoryRes", "type": "Memory", "metric type": "Gauge"},
@@ -188,6 +215,9 @@ def test_all_show_metrics_info_values_are_present(memgraph):
         {"name": "ActiveTCPSessions", "type": "Session", "metric type": "Counter"},
         {"name": "ActiveWebSocketSessions", "type": "Session", "metric type": "Counter"},
         {"name": "BoltMessages", "type": "Session", "metric type": "Counter"},
+        {"name": "BoltQueueingDelay_us_50p", "type": "Session", "metric type": "Histogram"},
+        {"name": "BoltQueueingDelay_us_90p", "type": "Session", "metric type": "Histogram"},
+        {"name": "BoltQueueingDelay_us_99p", "type": "Session", "metric type": "Histogram"},
         {"name": "SnapshotCreationLatency_us_50p", "type": "Snapshot", "metric type": "Histogram"},
         {"name": "SnapshotCreationLatency_us_90p", "type": "Snapshot", "metric type": "Histogram"},
         {"name": "SnapshotCreationLatency_us_99p", "type": "Snapshot", "metric type": "Histogram"},
@@ -198,6 +228,9 @@ def test_all_show_metrics_info_values_are_present(memgraph):
         {"name": "StreamsCreated", "type": "Stream", "metric type": "Counter"},
         {"name": "DeletedEdges", "type": "TTL", "metric type": "Counter"},
         {"name": "DeletedNodes", "type": "TTL", "metric type": "Counter"},
+        {"name": "ExpiryLag_us_50p", "type": "TTL", "metric type": "Histogram"},
+        {"name": "ExpiryLag_us_90p", "type": "TTL", "metric type": "Histogram"},
+        {"name": "ExpiryLag_us_99p", "type": "TTL", "metric type": "Histogram"},
         {"name": "ActiveTransactions", "type": "Transaction", "metric type": "Counter"},
         {"name": "CommitedTransactions", "type": "Transaction", "metric type": "Counter"},
         {"name": "FailedPrepare", "type": "Transaction", "metric type": "Counter"},
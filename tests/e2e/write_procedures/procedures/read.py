@@ -9,6 +9,8 @@
 # by the Apache License, Version 2.0, included in the file
 # licenses/APL.txt.
 
+import array
+
 import mgp
 
 
@@ -81,6 +83,15 @@ def subgraph_get_path_vertices_in_subgraph(ctx: mgp.ProcCtx, path: mgp.Path) ->
     return records
 
 
+@mgp.read_proc
+def subgraph_export_out_degrees(ctx: mgp.ProcCtx) -> mgp.Record(node=mgp.Vertex, id=float, out_degree=int):
+    arrays = ctx.graph.export_arrays(vertex_properties=["id"])
+    out_degrees = array.array("q", [0]) * len(arrays.vertex_ids)
+    for source in arrays.sources:
+        out_degrees[source] += 1
+    return mgp.Columns(node=mgp.VertexIds(arrays.vertex_ids), id=arrays.vertex_properties["id"], out_degree=out_degrees)
+
+
 @mgp.read_proc
 def log_message(ctx: mgp.ProcCtx, message: str) -> mgp.Record(success=bool):
     logger = mgp.Logger()
@@ -343,5 +343,23 @@ def test_subgraph_remove_vertex_and_out_edges_get_vertices(multi_db):
     )
 
 
+@pytest.mark.parametrize("multi_db", [False, True], indirect=True)
+def test_subgraph_export_arrays(multi_db):
+    cursor = multi_db.cursor()
+    execute_and_fetch_all(cursor, "MATCH (n) DETACH DELETE n;")
+    create_subgraph(cursor)
+
+    result = execute_and_fetch_all(
+        cursor,
+        f"MATCH p=(n:Person)-[:SUPPORTS]->(m:Team) WITH project(p) AS graph CALL read.subgraph_export_out_degrees(graph) YIELD node, id, out_degree RETURN node.id, id, out_degree ORDER BY id;",
+    )
+    assert result == [(1, 1.0, 2), (2, 2.0, 1), (5, 5.0, 0), (6, 6.0, 0)]
+
+    execute_and_fetch_all(
+        cursor,
+        f"MATCH (n) DETACH DELETE n;",
+    )
+
+
 if __name__ == "__main__":
     sys.exit(pytest.main([__file__, "-rA"]))
@@ -19,6 +19,7 @@
 #include "communication/bolt/v1/codes.hpp"
 #include "communication/bolt/v1/encoder/encoder.hpp"
 #include "disk_test_utils.hpp"
+#include "glue/bolt_value_encoder.hpp"
 #include "glue/communication.hpp"
 #include "storage/v2/disk/storage.hpp"
 #include "storage/v2/inmemory/storage.hpp"
@@ -250,6 +251,58 @@ TEST_F(BoltEncoder, VertexAndEdgeOnDiskStorage) {
   disk_test_utils::RemoveRocksDbDirs(testSuite);
 }
 
+TEST_F(BoltEncoder, TypedValueEncodedDirectly) {
+  std::unique_ptr<memgraph::storage::Storage> db{new memgraph::storage::InMemoryStorage()};
+  auto dba = db->Access();
+  auto va1 = dba->CreateVertex();
+  auto va2 = dba->CreateVertex();
+  ASSERT_TRUE(va1.AddLabel(dba->NameToLabel("label2")).HasValue());
+  ASSERT_TRUE(va1.AddLabel(dba->NameToLabel("label1")).HasValue());
+  // Property ids are in the opposite order of property names
+  auto p_zeta = dba->NameToProperty("zeta");
+  auto p_alpha = dba->NameToProperty("alpha");
+  ASSERT_TRUE(va1.SetProperty(p_zeta, memgraph::storage::PropertyValue("last")).HasValue());
+  ASSERT_TRUE(va1.SetProperty(p_alpha, memgraph::storage::PropertyValue(1.5)).HasValue());
+  memgraph::storage::PropertyValue::map_t nested{{p_zeta, memgraph::storage::PropertyValue(true)},
+                                                 {p_alpha, memgraph::storage::PropertyValue(42)}};
+  ASSERT_TRUE(va2.SetProperty(p_zeta, memgraph::storage::PropertyValue(std::move(nested))).HasValue());
+  auto ea = dba->CreateEdge(&va1, &va2, dba->NameToEdgeType("edgetype")).GetValue();
+  ASSERT_TRUE(ea.SetProperty(p_zeta, memgraph::storage::PropertyValue(12)).HasValue());
+  memgraph::storage::PropertyValue::list_t list{memgraph::storage::PropertyValue(1),
+                                                memgraph::storage::PropertyValue()};
+  ASSERT_TRUE(ea.SetProperty(p_alpha, memgraph::storage::PropertyValue(std::move(list))).HasValue());
+
+  using memgraph::query::TypedValue;
+  const memgraph::query::VertexAccessor v1(va1);
+  const memgraph::query::VertexAccessor v2(va2);
+  const memgraph::query::EdgeAccessor e(ea);
+  std::vector<TypedValue> values;
+  values.emplace_back(v1);
+  values.emplace_back(e);
+  // Goes over the same edge back and forth, so it has repeating vertices, edges and both index signs
+  values.emplace_back(memgraph::query::Path(v1, e, v2, e, v1));
+  values.emplace_back(std::vector<TypedValue>{TypedValue(v2), TypedValue("string"), TypedValue()});
+  values.emplace_back(std::map<std::string, TypedValue>{{"vertex", TypedValue(v1)}, {"edge", TypedValue(e)}});
+
+  std::vector<Value> bolt_values;
+  for (const auto &value : values) {
+    bolt_values.push_back(*memgraph::glue::ToBoltValue(value, db.get(), memgraph::storage::View::NEW));
+  }
+  bolt_encoder.MessageRecord(bolt_values);
+  const auto expected = output;
+  output.clear();
+
+  bolt_encoder.MessageRecordHeader(values.size());
+  for (const auto &value : values) {
+    auto res = bolt_encoder.MessageRecordAppend([&](auto &encoder) {
+      return memgraph::glue::BoltValueEncoder{encoder, db.get(), memgraph::storage::View::NEW}.Write(value);
+    });
+    ASSERT_FALSE(res.HasError());
+  }
+  ASSERT_TRUE(bolt_encoder.MessageRecordFinalize());
+  EXPECT_EQ(output, expected);
+}
+
 TEST_F(BoltEncoder, BoltV1ExampleMessages) {
   // this test checks example messages from: http://boltprotocol.org/v1/
 
@@ -2992,6 +2992,20 @@ TEST_P(CypherMainVisitorTest, TestShowIndexInfo) {
   EXPECT_EQ(query->info_type_, DatabaseInfoQuery::InfoType::INDEX);
 }
 
+TEST_P(CypherMainVisitorTest, TestShowPlanCache) {
+  auto &ast_generator = *GetParam();
+  auto *query = dynamic_cast<DatabaseInfoQuery *>(ast_generator.ParseQuery("SHOW PLAN CACHE"));
+  ASSERT_TRUE(query);
+  EXPECT_EQ(query->info_type_, DatabaseInfoQuery::InfoType::PLAN_CACHE);
+}
+
+TEST_P(CypherMainVisitorTest, TestShowQueryStatistics) {
+  auto &ast_generator = *GetParam();
+  auto *query = dynamic_cast<DatabaseInfoQuery *>(ast_generator.ParseQuery("SHOW QUERY STATISTICS"));
+  ASSERT_TRUE(query);
+  EXPECT_EQ(query->info_type_, DatabaseInfoQuery::InfoType::QUERY_STATISTICS);
+}
+
 TEST_P(CypherMainVisitorTest, TestShowConstraintInfo) {
   auto &ast_generator = *GetParam();
   auto *query = dynamic_cast<DatabaseInfoQuery *>(ast_generator.ParseQuery("SHOW CONSTRAINT INFO"));
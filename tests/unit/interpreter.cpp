@@ -38,6 +38,7 @@
 #include "storage/v2/storage_mode.hpp"
 #include "utils/logging.hpp"
 #include "utils/lru_cache.hpp"
+#include "utils/on_scope_exit.hpp"
 #include "utils/synchronized.hpp"
 
 namespace {
@@ -785,6 +786,104 @@ TYPED_TEST(InterpreterTest, ExplainQueryWithParams) {
   EXPECT_EQ(this->interpreter_context.ast_cache.size(), 2U);
 }
 
+TYPED_TEST(InterpreterTest, PlanCacheByParameterKinds) {
+  auto plan_cache_size = [this] { return this->db->plan_cache()->WithLock([&](auto &cache) { return cache.size(); }); };
+  this->Interpret("RETURN $x;", {{"x", memgraph::storage::ExternalPropertyValue(42)}});
+  EXPECT_EQ(plan_cache_size(), 1U);
+  // A different scalar type reuses the plan.
+  this->Interpret("RETURN $x;", {{"x", memgraph::storage::ExternalPropertyValue("string")}});
+  EXPECT_EQ(plan_cache_size(), 1U);
+  // A list gets a plan of its own.
+  this->Interpret("RETURN $x;", {{"x", memgraph::storage::ExternalPropertyValue(
+                                           std::vector{memgraph::storage::ExternalPropertyValue(42)})}});
+  EXPECT_EQ(plan_cache_size(), 2U);
+  // The AST is still shared.
+  EXPECT_EQ(this->interpreter_context.ast_cache.size(), 1U);
+
+  auto stream = this->Interpret("SHOW PLAN CACHE");
+  std::vector<std::string> expected_header{"query", "parameter types", "cost", "estimated rows", "hits", "replans"};
+  EXPECT_EQ(stream.GetHeader(), expected_header);
+  ASSERT_EQ(stream.GetResults().size(), 2U);
+  // Most recently used first
+  EXPECT_EQ(stream.GetResults()[0][1].ValueString(), "list");
+  EXPECT_EQ(stream.GetResults()[0][4].ValueInt(), 0);
+  EXPECT_EQ(stream.GetResults()[1][1].ValueString(), "scalar");
+  EXPECT_EQ(stream.GetResults()[1][4].ValueInt(), 1);
+  EXPECT_EQ(stream.GetResults()[0][0].ValueString(), stream.GetResults()[1][0].ValueString());
+}
+
+TYPED_TEST(InterpreterTest, PlanCacheReplansMisestimatedPlan) {
+  auto match_replans = [this] {
+    auto stream = this->Interpret("SHOW PLAN CACHE");
+    for (const auto &row : stream.GetResults()) {
+      if (row[0].ValueString().starts_with("MATCH")) return row[5].ValueInt();
+    }
+    return int64_t{-1};
+  };
+  // Planned and cached while the graph is empty.
+  this->Interpret("MATCH (n) RETURN n;");
+  EXPECT_EQ(match_replans(), 0);
+  this->Interpret("UNWIND range(1, 2000) AS i CREATE ();");
+  // The cached plan is reused, and returns far more rows than it was estimated to.
+  this->Interpret("MATCH (n) RETURN n;");
+  EXPECT_EQ(match_replans(), 0);
+  // So the query is planned again.
+  this->Interpret("MATCH (n) RETURN n;");
+  EXPECT_EQ(match_replans(), 1);
+  // The new plan's estimate is right, it is kept.
+  this->Interpret("MATCH (n) RETURN n;");
+  EXPECT_EQ(match_replans(), 1);
+}
+
+TYPED_TEST(InterpreterTest, PlanCacheKeepsPlanWhenEstimateIsUnchanged) {
+  auto unwind_replans = [this] {
+    auto stream = this->Interpret("SHOW PLAN CACHE");
+    for (const auto &row : stream.GetResults()) {
+      if (row[0].ValueString().starts_with("UNWIND")) return row[5].ValueInt();
+    }
+    return int64_t{-1};
+  };
+  // UNWIND of a function call is estimated to yield a fixed number of rows, far below the ones returned, but
+  // planning again would estimate the same and produce the same plan.
+  for (int i = 0; i < 3; ++i) {
+    this->Interpret("UNWIND range(1, 2000) AS i RETURN i;");
+    EXPECT_EQ(unwind_replans(), 0);
+  }
+}
+
+TYPED_TEST(InterpreterTest, QueryStatisticsFromSampledProfiles) {
+  const auto default_rate = FLAGS_query_profile_sample_rate;
+  memgraph::utils::OnScopeExit restore_rate{[&] { FLAGS_query_profile_sample_rate = default_rate; }};
+
+  this->Interpret("UNWIND range(1, 3) AS i CREATE ();");
+  // Nothing is sampled by default.
+  this->Interpret("MATCH (n) RETURN n;");
+  EXPECT_TRUE(this->Interpret("SHOW QUERY STATISTICS").GetResults().empty());
+
+  FLAGS_query_profile_sample_rate = 1.0;
+  this->Interpret("MATCH (n) RETURN n;");
+  this->Interpret("MATCH (n) RETURN n;");
+
+  auto stream = this->Interpret("SHOW QUERY STATISTICS");
+  std::vector<std::string> expected_header{"query", "parameter types", "hits", "samples", "mean time ms", "operators"};
+  EXPECT_EQ(stream.GetHeader(), expected_header);
+  ASSERT_EQ(stream.GetResults().size(), 1U);
+  const auto &row = stream.GetResults()[0];
+  EXPECT_TRUE(row[0].ValueString().starts_with("MATCH"));
+  EXPECT_EQ(row[2].ValueInt(), 2);
+  EXPECT_EQ(row[3].ValueInt(), 2);
+
+  std::vector<std::string> expected_operators{"Produce {n}", "ScanAll (n)", "Once"};
+  const auto &operators = row[5].ValueList();
+  ASSERT_EQ(operators.size(), expected_operators.size());
+  for (size_t i = 0; i < operators.size(); ++i) {
+    const auto &op = operators[i].ValueMap();
+    EXPECT_EQ(op.at("operator").ValueString(), expected_operators[i]);
+  }
+  // ScanAll is pulled once per vertex and once more to find there are no more.
+  EXPECT_EQ(operators[1].ValueMap().at("mean hits").ValueDouble(), 4.0);
+}
+
 TYPED_TEST(InterpreterTest, ProfileQuery) {
   EXPECT_EQ(this->db->plan_cache()->WithLock([&](auto &cache) { return cache.size(); }), 0U);
   EXPECT_EQ(this->interpreter_context.ast_cache.size(), 0U);
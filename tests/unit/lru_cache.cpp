@@ -1,4 +1,4 @@
-// Copyright 2023 Memgraph Ltd.
+// Copyright 2025 Memgraph Ltd.
 //
 // Use of this software is governed by the Business Source License
 // included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -109,3 +109,33 @@ TEST(LRUCacheTest, LargeCacheTest) {
     EXPECT_EQ(value.value(), i);
   }
 }
+
+TEST(LRUCacheTest, ByteBudgetTest) {
+  memgraph::utils::LRUCache<int, int> cache(10, 100);
+  cache.put(1, 1, 40);
+  cache.put(2, 2, 40);
+  EXPECT_EQ(cache.bytes(), 80);
+
+  // Touch 1 so that 2 is the least recently used
+  EXPECT_TRUE(cache.get(1).has_value());
+  cache.put(3, 3, 40);
+  EXPECT_FALSE(cache.get(2).has_value());
+  EXPECT_TRUE(cache.get(1).has_value());
+  EXPECT_TRUE(cache.get(3).has_value());
+  EXPECT_EQ(cache.bytes(), 80);
+
+  // Replacing an item replaces its size
+  cache.put(1, 10, 10);
+  EXPECT_EQ(cache.bytes(), 50);
+  EXPECT_EQ(cache.size(), 2);
+
+  // An item over the whole budget isn't kept and doesn't evict the others
+  cache.put(4, 4, 200);
+  EXPECT_FALSE(cache.get(4).has_value());
+  EXPECT_EQ(cache.size(), 2);
+  EXPECT_EQ(cache.bytes(), 50);
+
+  cache.put(5, 5, 10);
+  cache.reset();
+  EXPECT_EQ(cache.bytes(), 0);
+}
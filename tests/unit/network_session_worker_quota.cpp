@@ -0,0 +1,151 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <optional>
+#include <thread>
+
+#include <gtest/gtest.h>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/write.hpp>
+
+#include "communication/v2/server.hpp"
+#include "communication/v2/session.hpp"
+#include "utils/priority_thread_pool.hpp"
+#include "utils/worker_quota.hpp"
+
+using namespace std::chrono_literals;
+using tcp = boost::asio::ip::tcp;
+
+namespace {
+
+// Each byte sent to a session is one query. 'a' runs on the quota limited database and blocks until released, 'A'
+// runs there without blocking, 'b' runs on a database without a quota.
+struct TestContext {
+  memgraph::utils::PriorityThreadPool *worker_pool;
+  std::shared_ptr<memgraph::utils::WorkerQuota> quota;
+  std::promise<void> blocked_started;
+  std::shared_future<void> release_blocked;
+
+  auto AddTask(auto &&task, memgraph::utils::Priority priority) {
+    return worker_pool->ScheduledAddTask(std::forward<decltype(task)>(task), priority);
+  }
+};
+
+class TestSession {
+ public:
+  TestSession(TestContext &context, memgraph::communication::v2::InputStream *input_stream,
+              memgraph::communication::v2::OutputStream *output_stream)
+      : context_(&context), input_stream_(input_stream), output_stream_(output_stream) {}
+
+  bool Execute() {
+    if (input_stream_->size() == 0) return false;
+    const auto query = static_cast<char>(input_stream_->data()[0]);
+    input_stream_->Shift(1);
+    if (query == 'a') {
+      context_->blocked_started.set_value();
+      context_->release_blocked.wait();
+    }
+    output_stream_->Write(reinterpret_cast<const uint8_t *>(&query), 1);
+    return true;
+  }
+
+  memgraph::utils::Priority ApproximateQueryPriority() const { return memgraph::utils::Priority::LOW; }
+
+  std::shared_ptr<memgraph::utils::WorkerQuota> GetWorkerQuota() const {
+    if (input_stream_->size() == 0 || input_stream_->data()[0] == 'b') return {};
+    return context_->quota;
+  }
+
+  void HandleError() {}
+
+ private:
+  TestContext *context_;
+  memgraph::communication::v2::InputStream *input_stream_;
+  memgraph::communication::v2::OutputStream *output_stream_;
+};
+
+class Client {
+ public:
+  explicit Client(const tcp::endpoint &endpoint) { socket_.connect(endpoint); }
+
+  void Send(char query) { boost::asio::write(socket_, boost::asio::buffer(&query, 1)); }
+
+  // The reply to the last query, if it arrives in time
+  std::optional<char> Receive(std::chrono::milliseconds timeout = 5s) {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (socket_.available() == 0) {
+      if (std::chrono::steady_clock::now() > deadline) return std::nullopt;
+      std::this_thread::sleep_for(1ms);
+    }
+    char reply{};
+    socket_.read_some(boost::asio::buffer(&reply, 1));
+    return reply;
+  }
+
+ private:
+  boost::asio::io_context io_context_;
+  tcp::socket socket_{io_context_};
+};
+
+tcp::endpoint FreeEndpoint() {
+  boost::asio::io_context io_context;
+  tcp::acceptor acceptor{io_context, tcp::endpoint{boost::asio::ip::make_address("127.0.0.1"), 0}};
+  return acceptor.local_endpoint();
+}
+
+}  // namespace
+
+TEST(SessionWorkerQuota, ParkedSessionDoesNotHoldWorker) {
+  // Two workers; the quota lets only one of them run the limited database's queries
+  memgraph::utils::PriorityThreadPool worker_pool{2, 1};
+  std::promise<void> release;
+  TestContext context{.worker_pool = &worker_pool,
+                      .quota = std::make_shared<memgraph::utils::WorkerQuota>(1),
+                      .release_blocked = release.get_future().share()};
+  auto endpoint = FreeEndpoint();
+  memgraph::communication::ServerContext server_context;
+  memgraph::communication::v2::Server<TestSession, TestContext> server{endpoint, &context, &server_context, "Test", 1};
+  ASSERT_TRUE(server.Start());
+
+  Client blocking{endpoint};
+  Client parked{endpoint};
+  Client other_database{endpoint};
+
+  // The first session takes the database's only slot and one of the workers
+  blocking.Send('a');
+  ASSERT_EQ(context.blocked_started.get_future().wait_for(5s), std::future_status::ready);
+
+  // The second session is over the quota and is parked
+  parked.Send('A');
+  const auto deadline = std::chrono::steady_clock::now() + 5s;
+  while (context.quota->Parked() == 0 && std::chrono::steady_clock::now() < deadline) std::this_thread::sleep_for(1ms);
+  ASSERT_EQ(context.quota->Parked(), 1);
+  EXPECT_EQ(parked.Receive(100ms), std::nullopt);
+
+  // The parked session doesn't hold the other worker, so another database's query runs
+  other_database.Send('b');
+  EXPECT_EQ(other_database.Receive(), 'b');
+
+  // Once the slot is released, the parked session is resumed
+  release.set_value();
+  EXPECT_EQ(blocking.Receive(), 'a');
+  EXPECT_EQ(parked.Receive(), 'A');
+  EXPECT_EQ(context.quota->Parked(), 0);
+
+  server.Shutdown();
+  server.AwaitShutdown();
+  worker_pool.ShutDown();
+  worker_pool.AwaitShutdown();
+}
@@ -26,6 +26,7 @@
 #include "query/frontend/ast/ast.hpp"
 #include "query/frontend/opencypher/parser.hpp"
 #include "query/interpret/awesome_memgraph_functions.hpp"
+#include "query/interpret/compiled_predicate.hpp"
 #include "query/interpret/eval.hpp"
 #include "query/interpret/frame.hpp"
 #include "query/path.hpp"
@@ -1295,6 +1296,27 @@ TYPED_TEST(ExpressionEvaluatorTest, RegexMatch) {
   EXPECT_TRUE(this->Eval(this->storage.template Create<RegexMatch>(LITERAL("text"), LITERAL(".+[ext]"))).ValueBool());
 }
 
+TYPED_TEST(ExpressionEvaluatorTest, RegexMatchLiteralPatterns) {
+  auto regex_match = [this](const char *target, const char *pattern) {
+    return this->Eval(this->storage.template Create<RegexMatch>(LITERAL(target), LITERAL(pattern))).ValueBool();
+  };
+  EXPECT_TRUE(regex_match("text", "text"));
+  EXPECT_FALSE(regex_match("text", "tex"));
+  EXPECT_TRUE(regex_match("text", "te.*"));
+  EXPECT_FALSE(regex_match("text", "ex.*"));
+  EXPECT_TRUE(regex_match("text", ".*xt"));
+  EXPECT_TRUE(regex_match("text", ".*ex.*"));
+  EXPECT_FALSE(regex_match("text", ".*tt.*"));
+  EXPECT_TRUE(regex_match("", ".*"));
+  // `.` doesn't match line terminators
+  EXPECT_FALSE(regex_match("te\nxt", "te.*"));
+  EXPECT_FALSE(regex_match("te\nxt", ".*xt"));
+  EXPECT_FALSE(regex_match("t\next", ".*ex.*"));
+  EXPECT_TRUE(regex_match("te\nxt", "te\nxt"));
+  // Patterns are compiled once per query
+  EXPECT_EQ(this->ctx.regex_cache.size(), 9);
+}
+
 template <typename StorageType>
 class ExpressionEvaluatorPropertyLookup : public ExpressionEvaluatorTest<StorageType> {
  protected:
@@ -1324,6 +1346,79 @@ TYPED_TEST(ExpressionEvaluatorPropertyLookup, Vertex) {
   EXPECT_TRUE(this->Value(this->prop_height).IsNull());
 }
 
+TYPED_TEST(ExpressionEvaluatorPropertyLookup, CompiledPredicate) {
+  auto v1 = this->dba.InsertVertex();
+  ASSERT_TRUE(v1.SetProperty(this->prop_age.second, memgraph::storage::PropertyValue(10)).HasValue());
+  ASSERT_TRUE(v1.SetProperty(this->prop_height.second, memgraph::storage::PropertyValue("tall")).HasValue());
+  this->dba.AdvanceCommand();
+  this->frame[this->symbol] = TypedValue(v1);
+  this->ctx.parameters.Add(0, memgraph::storage::ExternalPropertyValue(10.0));
+  this->ctx.properties = NamesToProperties(this->storage.properties_, &this->dba);
+
+  auto &storage = this->storage;
+  auto age = [&] { return storage.template Create<PropertyLookup>(this->identifier, storage.GetPropertyIx("age")); };
+  auto height = [&] {
+    return storage.template Create<PropertyLookup>(this->identifier, storage.GetPropertyIx("height"));
+  };
+  auto missing = [&] {
+    return storage.template Create<PropertyLookup>(this->identifier, storage.GetPropertyIx("missing"));
+  };
+  auto literal = [&](auto value) { return storage.template Create<PrimitiveLiteral>(value); };
+  auto param = [&] { return storage.template Create<ParameterLookup>(0); };
+
+  // The compiled predicate has to give the same result (or error) as the evaluator
+  auto check = [&](Expression *expression) {
+    auto compiled = CompiledPredicate::Compile(expression);
+    ASSERT_TRUE(compiled);
+    CompiledPredicate::Constants constants(compiled->ConstantsCount());
+    std::optional<bool> expected;
+    try {
+      auto value = expression->Accept(this->eval);
+      expected = value.IsBool() && value.ValueBool();
+    } catch (const QueryRuntimeException &) {
+    }
+    if (expected) {
+      EXPECT_EQ(compiled->Evaluate(this->eval, constants), *expected);
+      // Constants are evaluated once and reused
+      EXPECT_EQ(compiled->Evaluate(this->eval, constants), *expected);
+    } else {
+      EXPECT_THROW(compiled->Evaluate(this->eval, constants), QueryRuntimeException);
+    }
+  };
+
+  check(storage.template Create<EqualOperator>(age(), literal(10)));
+  check(storage.template Create<EqualOperator>(age(), param()));
+  check(storage.template Create<NotEqualOperator>(age(), param()));
+  check(storage.template Create<LessOperator>(literal(5), age()));
+  auto *five_plus_param = storage.template Create<AdditionOperator>(literal(5), param());
+  check(storage.template Create<GreaterOperator>(age(), five_plus_param));
+  check(storage.template Create<LessEqualOperator>(age(), literal(9.5)));
+  check(storage.template Create<GreaterEqualOperator>(height(), literal("short")));
+  check(storage.template Create<EqualOperator>(height(), literal(10)));
+  check(storage.template Create<LessOperator>(height(), literal(10)));
+  check(storage.template Create<LessOperator>(missing(), literal(10)));
+  check(storage.template Create<IsNullOperator>(missing()));
+  // Ordering a boolean is an error even against null, equality isn't
+  check(storage.template Create<LessOperator>(missing(), literal(true)));
+  check(storage.template Create<GreaterEqualOperator>(literal(false), missing()));
+  check(storage.template Create<EqualOperator>(missing(), literal(true)));
+  check(storage.template Create<NotOperator>(storage.template Create<IsNullOperator>(age())));
+  check(storage.template Create<AndOperator>(storage.template Create<LessOperator>(missing(), literal(10)),
+                                             storage.template Create<EqualOperator>(age(), literal(10))));
+  check(storage.template Create<OrOperator>(storage.template Create<LessOperator>(missing(), literal(10)),
+                                            storage.template Create<EqualOperator>(age(), literal(10))));
+  check(storage.template Create<NotOperator>(storage.template Create<LessOperator>(missing(), literal(10))));
+  check(storage.template Create<EqualOperator>(this->identifier, this->identifier));
+  check(storage.template Create<EqualOperator>(
+      storage.template Create<ListLiteral>(std::vector<Expression *>{age(), literal(1)}),
+      storage.template Create<ListLiteral>(std::vector<Expression *>{literal(10), literal(1)})));
+
+  // Not a predicate, left to the evaluator
+  EXPECT_FALSE(CompiledPredicate::Compile(age()));
+  EXPECT_FALSE(CompiledPredicate::Compile(storage.template Create<AndOperator>(
+      storage.template Create<IsNullOperator>(age()), storage.template Create<Identifier>("element"))));
+}
+
 TYPED_TEST(ExpressionEvaluatorPropertyLookup, Duration) {
   const memgraph::utils::Duration dur({10, 1, 30, 2, 22, 45});
   this->frame[this->symbol] = TypedValue(dur);
@@ -1978,6 +1978,24 @@ TYPED_TEST(TestPlanner, FilterRegexMatchIndex) {
             ExpectFilter(), ExpectProduce());
 }
 
+TYPED_TEST(TestPlanner, FilterStartsWithIndex) {
+  // Test MATCH (n :label) WHERE n.prop STARTS WITH "prefix" RETURN n
+  FakeDbAccessor dba;
+  auto prop = dba.Property("prop");
+  auto label = dba.Label("label");
+  dba.SetIndexCount(label, 0);
+  dba.SetIndexCount(label, prop, 0);
+  auto *prefix = LITERAL("prefix");
+  auto *starts_with = FN("STARTSWITH", PROPERTY_LOOKUP(dba, "n", prop), prefix);
+  auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n", "label"))), WHERE(starts_with), RETURN("n")));
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+  // The index narrows the scan down to the prefix range, the filter still checks the prefix.
+  CheckPlan(planner.plan(), symbol_table,
+            ExpectScanAllByLabelProperties(label, std::vector{prop}, std::vector{ExpressionRange::StartsWith(prefix)}),
+            ExpectFilter(), ExpectProduce());
+}
+
 TYPED_TEST(TestPlanner, FilterRegexMatchPreferEqualityIndex) {
   // Test MATCH (n :label) WHERE n.prop =~ "regex" AND n.prop = 42 RETURN n
   FakeDbAccessor dba;
@@ -2873,6 +2873,88 @@ TYPED_TEST(QueryPlan, ExpandExistingNode) {
   test_existing(false, 2);
 }
 
+TYPED_TEST(QueryPlan, ExpandExistingNodeClosesCycles) {
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+
+  // make a graph where (h)->(x_i)->(y) for 4 different x_i
+  // and (y)->(h) with 2 parallel edges
+  auto h = dba.InsertVertex();
+  auto y = dba.InsertVertex();
+  auto edge_type = dba.NameToEdgeType("Edge");
+  for (int i = 0; i < 4; ++i) {
+    auto x = dba.InsertVertex();
+    ASSERT_TRUE(dba.InsertEdge(&h, &x, edge_type).HasValue());
+    ASSERT_TRUE(dba.InsertEdge(&x, &y, edge_type).HasValue());
+  }
+  ASSERT_TRUE(dba.InsertEdge(&y, &h, edge_type).HasValue());
+  ASSERT_TRUE(dba.InsertEdge(&y, &h, edge_type).HasValue());
+  dba.AdvanceCommand();
+
+  SymbolTable symbol_table;
+
+  // MATCH (a)-[r1]->(b)-[r2]->(c)-[r3]->(a)
+  auto a = MakeScanAll(this->storage, symbol_table, "a");
+  auto r1_b = MakeExpand(this->storage, symbol_table, a.op_, a.sym_, "r1", EdgeAtom::Direction::OUT, {}, "b", false,
+                         memgraph::storage::View::OLD);
+  auto r2_c = MakeExpand(this->storage, symbol_table, r1_b.op_, r1_b.node_sym_, "r2", EdgeAtom::Direction::OUT, {},
+                         "c", false, memgraph::storage::View::OLD);
+  auto r3_sym = symbol_table.CreateSymbol("r3", true);
+  for (auto direction : {EdgeAtom::Direction::OUT, EdgeAtom::Direction::BOTH}) {
+    auto r3_a = std::make_shared<Expand>(r2_c.op_, r2_c.node_sym_, a.sym_, r3_sym, direction,
+                                         std::vector<memgraph::storage::EdgeTypeId>{}, true,
+                                         memgraph::storage::View::OLD);
+    auto context = MakeContext(this->storage, symbol_table, &dba);
+    // Each of the 4 wedges over (h), (x_i) and (y) is closed by the 2 parallel
+    // edges, starting from each of the 3 nodes.
+    EXPECT_EQ(24, PullAll(*r3_a, &context));
+  }
+}
+
+TYPED_TEST(QueryPlan, ExpandExistingNodeIndexesHub) {
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+
+  // make a graph where (h)->(x_i)->(h) for 256 different x_i, each x_i also
+  // having 4 more outgoing edges, so (h) is a hub bound over many rows
+  auto h = dba.InsertVertex();
+  auto edge_type = dba.NameToEdgeType("Edge");
+  for (int i = 0; i < 256; ++i) {
+    auto x = dba.InsertVertex();
+    ASSERT_TRUE(dba.InsertEdge(&h, &x, edge_type).HasValue());
+    ASSERT_TRUE(dba.InsertEdge(&x, &h, edge_type).HasValue());
+    for (int j = 0; j < 4; ++j) {
+      auto z = dba.InsertVertex();
+      ASSERT_TRUE(dba.InsertEdge(&x, &z, edge_type).HasValue());
+    }
+  }
+  dba.AdvanceCommand();
+
+  SymbolTable symbol_table;
+
+  // MATCH (a)-[r1]->(b)-[r2]->(a)
+  auto a = MakeScanAll(this->storage, symbol_table, "a");
+  auto r1_b = MakeExpand(this->storage, symbol_table, a.op_, a.sym_, "r1", EdgeAtom::Direction::OUT, {}, "b", false,
+                         memgraph::storage::View::OLD);
+  auto r2_sym = symbol_table.CreateSymbol("r2", true);
+  for (auto direction : {EdgeAtom::Direction::OUT, EdgeAtom::Direction::BOTH}) {
+    // The index is only used with the old view, the new one expands as before
+    auto pull = [&](memgraph::storage::View view) {
+      auto r2_a = std::make_shared<Expand>(r1_b.op_, r1_b.node_sym_, a.sym_, r2_sym, direction,
+                                           std::vector<memgraph::storage::EdgeTypeId>{}, true, view);
+      auto context = MakeContext(this->storage, symbol_table, &dba);
+      auto count = PullAll(*r2_a, &context);
+      return std::make_pair(count, context.number_of_hops);
+    };
+    const auto [indexed_count, indexed_hops] = pull(memgraph::storage::View::OLD);
+    const auto [scanned_count, scanned_hops] = pull(memgraph::storage::View::NEW);
+    EXPECT_EQ(indexed_count, direction == EdgeAtom::Direction::OUT ? 512 : 1024);
+    EXPECT_EQ(indexed_count, scanned_count);
+    // Each edge found through the index is a hop, building the index isn't
+    EXPECT_LT(indexed_hops, scanned_hops);
+  }
+}
+
 TYPED_TEST(QueryPlan, ExpandBothCycleEdgeCase) {
   // we're testing that expanding on BOTH
   // does only one expansion for a cycle
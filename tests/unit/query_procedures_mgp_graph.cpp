@@ -10,6 +10,7 @@
 // licenses/APL.txt.
 
 #include <algorithm>
+#include <array>
 #include <iterator>
 #include <list>
 #include <memory>
@@ -22,6 +23,7 @@
 #include "mg_procedure.h"
 #include "query/db_accessor.hpp"
 #include "query/plan/operator.hpp"
+#include "query/procedure/cypher_types.hpp"
 #include "query/procedure/mg_procedure_impl.hpp"
 #include "storage/v2/disk/storage.hpp"
 #include "storage/v2/id_types.hpp"
@@ -690,3 +692,49 @@ TYPED_TEST(MgpGraphTest, EdgeSetPropertyWithImmutableGraph) {
   EXPECT_EQ(EXPECT_MGP_NO_ERROR(int, mgp_edge_underlying_graph_is_mutable, edge.get()), 0);
   EXPECT_EQ(mgp_edge_set_property(edge.get(), "property", value.get()), mgp_error::MGP_ERROR_IMMUTABLE_OBJECT);
 }
+
+TYPED_TEST(MgpGraphTest, ResultBatch) {
+  memgraph::storage::Gid vertex_id{};
+  {
+    auto accessor = this->CreateDbAccessor(memgraph::storage::IsolationLevel::SNAPSHOT_ISOLATION);
+    vertex_id = accessor.InsertVertex().Gid();
+    ASSERT_FALSE(accessor.Commit().HasError());
+  }
+  mgp_graph graph = this->CreateGraph(memgraph::storage::View::OLD);
+  const memgraph::query::procedure::IntType int_type;
+  const memgraph::query::procedure::FloatType float_type;
+  const memgraph::query::procedure::NodeType node_type;
+  mgp_result result{memgraph::utils::NewDeleteResource()};
+  result.signature.emplace("node", ResultsMetadata{&node_type, false, 0});
+  result.signature.emplace("score", ResultsMetadata{&float_type, false, 1});
+  result.signature.emplace("rank", ResultsMetadata{&int_type, false, 2});
+
+  auto *batch = EXPECT_MGP_NO_ERROR(mgp_result_batch *, mgp_result_new_batch, &result, 2);
+  ASSERT_NE(batch, nullptr);
+  EXPECT_EQ(EXPECT_MGP_NO_ERROR(size_t, mgp_result_batch_size, batch), 2);
+  const std::array<int64_t, 2> vertex_ids{vertex_id.AsInt(), vertex_id.AsInt()};
+  EXPECT_SUCCESS(mgp_result_batch_set_vertex_column(batch, "node", &graph, vertex_ids.data()));
+  const std::array<double, 2> scores{0.5, 1.5};
+  EXPECT_SUCCESS(mgp_result_batch_set_double_column(batch, "score", scores.data()));
+  const std::array<int64_t, 2> ranks{2, 1};
+  EXPECT_EQ(mgp_result_batch_set_int_column(batch, "missing", ranks.data()), mgp_error::MGP_ERROR_OUT_OF_RANGE);
+  EXPECT_EQ(mgp_result_batch_set_int_column(batch, "score", ranks.data()), mgp_error::MGP_ERROR_LOGIC_ERROR);
+  MgpValuePtr rank{EXPECT_MGP_NO_ERROR(mgp_value *, mgp_value_make_int, 1, &this->memory)};
+  EXPECT_SUCCESS(mgp_result_batch_insert(batch, 1, "rank", rank.get()));
+  EXPECT_EQ(mgp_result_batch_insert(batch, 2, "rank", rank.get()), mgp_error::MGP_ERROR_OUT_OF_RANGE);
+  const std::array<int64_t, 2> missing_vertex_ids{vertex_id.AsInt() + 1, vertex_id.AsInt() + 2};
+  EXPECT_EQ(mgp_result_batch_set_vertex_column(batch, "node", &graph, missing_vertex_ids.data()),
+            mgp_error::MGP_ERROR_OUT_OF_RANGE);
+
+  // Failed calls leave the columns as they were
+  ASSERT_EQ(result.batches.size(), 1);
+  const auto &columns = result.batches.front().columns;
+  ASSERT_EQ(columns[0].size(), 2);
+  EXPECT_EQ(columns[0][1].ValueVertex().Gid(), vertex_id);
+  ASSERT_EQ(columns[1].size(), 2);
+  EXPECT_EQ(columns[1][0].ValueDouble(), 0.5);
+  EXPECT_EQ(columns[1][1].ValueDouble(), 1.5);
+  ASSERT_EQ(columns[2].size(), 2);
+  EXPECT_TRUE(columns[2][0].IsNull());
+  EXPECT_EQ(columns[2][1].ValueInt(), 1);
+}
@@ -0,0 +1,91 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <gflags/gflags.h>
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include "flags/query.hpp"
+#include "query/slow_query_log.hpp"
+#include "utils/file.hpp"
+
+using memgraph::query::SlowQueryLog;
+
+class SlowQueryLogTest : public ::testing::Test {
+ protected:
+  void TearDown() override {
+    FLAGS_query_log_slow_threshold_ms = 0;
+    FLAGS_query_log_slow_memory_threshold_mb = 0;
+    if (std::filesystem::exists(storage_directory)) std::filesystem::remove_all(storage_directory);
+  }
+
+  std::filesystem::path storage_directory{std::filesystem::temp_directory_path() /
+                                          "MG_tests_unit_query_slow_query_log"};
+};
+
+TEST_F(SlowQueryLogTest, IsSlow) {
+  EXPECT_FALSE(SlowQueryLog::IsSlow(std::chrono::seconds(100), 1L << 40));
+
+  FLAGS_query_log_slow_threshold_ms = 100;
+  EXPECT_FALSE(SlowQueryLog::IsSlow(std::chrono::milliseconds(99), std::nullopt));
+  EXPECT_TRUE(SlowQueryLog::IsSlow(std::chrono::milliseconds(100), std::nullopt));
+
+  FLAGS_query_log_slow_threshold_ms = 0;
+  FLAGS_query_log_slow_memory_threshold_mb = 1;
+  EXPECT_FALSE(SlowQueryLog::IsSlow(std::chrono::seconds(100), std::nullopt));
+  EXPECT_FALSE(SlowQueryLog::IsSlow(std::chrono::seconds(100), 1024 * 1024 - 1));
+  EXPECT_TRUE(SlowQueryLog::IsSlow(std::chrono::seconds(0), 1024 * 1024));
+}
+
+TEST_F(SlowQueryLogTest, NotStartedWithoutThresholds) {
+  SlowQueryLog log{storage_directory};
+  log.Start();
+  EXPECT_FALSE(log.IsStarted());
+  log.Record({});
+}
+
+TEST_F(SlowQueryLogTest, WritesJsonLines) {
+  FLAGS_query_log_slow_threshold_ms = 1;
+  {
+    SlowQueryLog log{storage_directory};
+    log.Start();
+    ASSERT_TRUE(log.IsStarted());
+    for (int i = 0; i < 3; ++i) {
+      SlowQueryLog::Entry entry;
+      entry.db = "memgraph";
+      entry.query = "MATCH (n) RETURN n";
+      entry.rows = i;
+      entry.execution_time = 0.5;
+      entry.plan = nlohmann::json::object({{"name", "Produce"}});
+      log.Record(std::move(entry));
+    }
+  }
+
+  std::ifstream file{storage_directory / "slow_query.log"};
+  std::vector<nlohmann::json> lines;
+  for (std::string line; std::getline(file, line);) lines.push_back(nlohmann::json::parse(line));
+  ASSERT_EQ(lines.size(), 3);
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(lines[i]["db"], "memgraph");
+    EXPECT_EQ(lines[i]["query"], "MATCH (n) RETURN n");
+    EXPECT_EQ(lines[i]["rows"], i);
+    EXPECT_EQ(lines[i]["execution_time"], 0.5);
+    EXPECT_TRUE(lines[i]["memory_peak"].is_null());
+    EXPECT_EQ(lines[i]["plan"]["name"], "Produce");
+    EXPECT_GT(lines[i]["timestamp"], 0);
+  }
+}
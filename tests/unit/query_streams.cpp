@@ -25,11 +25,13 @@
 #include "query/interpreter.hpp"
 #include "query/interpreter_context.hpp"
 #include "query/query_user.hpp"
+#include "query/stream/batching.hpp"
 #include "query/stream/streams.hpp"
 #include "storage/v2/config.hpp"
 #include "storage/v2/disk/storage.hpp"
 #include "storage/v2/inmemory/storage.hpp"
 #include "test_utils.hpp"
+#include "utils/on_scope_exit.hpp"
 
 using Streams = memgraph::query::stream::Streams;
 using StreamInfo = memgraph::query::stream::KafkaStream::StreamInfo;
@@ -402,3 +404,131 @@ TYPED_TEST(StreamsTestFixture, CheckInvalidCredentials) {
           stream_name, stream_info, std::make_unique<FakeUser>(), this->db_, &this->interpreter_context_),
       memgraph::integrations::kafka::SettingCustomConfigFailed, checker);
 }
+
+TEST(StreamsBatching, MakeBatchedQuery) {
+  using memgraph::query::stream::BatchedQuery;
+  using memgraph::query::stream::MakeBatchedQuery;
+  EXPECT_EQ(MakeBatchedQuery("CREATE (:Node {id: $id, `$name`: $0, other_id: $id});"),
+            (BatchedQuery{.query = "UNWIND $__memgraph_stream_batch AS __memgraph_stream_row CALL { WITH "
+                                   "__memgraph_stream_row CREATE (:Node {id: __memgraph_stream_row['id'], `$name`: "
+                                   "__memgraph_stream_row['0'], other_id: __memgraph_stream_row['id']})\n}",
+                          .parameters = {"id", "0"}}));
+  // Parameters can't be in strings and comments
+  EXPECT_EQ(MakeBatchedQuery("MERGE (n {s: '$s\\'$s', t: \"$t\"}) // $c"),
+            (BatchedQuery{.query = "UNWIND $__memgraph_stream_batch AS __memgraph_stream_row CALL { WITH "
+                                   "__memgraph_stream_row MERGE (n {s: '$s\\'$s', t: \"$t\"}) // $c\n}",
+                          .parameters = {}}));
+  EXPECT_EQ(MakeBatchedQuery("MATCH (n) /* $n */ SET n.x = $x"),
+            (BatchedQuery{.query = "UNWIND $__memgraph_stream_batch AS __memgraph_stream_row CALL { WITH "
+                                   "__memgraph_stream_row MATCH (n) /* $n */ SET n.x = __memgraph_stream_row['x']\n}",
+                          .parameters = {"x"}}));
+  EXPECT_EQ(MakeBatchedQuery("CREATE (n {x: $`x`})"), std::nullopt);
+}
+
+namespace {
+using memgraph::query::stream::QueryBatcher;
+using Params = memgraph::storage::ExternalPropertyValue;
+
+Params MakeParams(int64_t x) { return Params{Params::map_t{{"x", Params{x}}}}; }
+
+// Executes the queries the way the stream consumer does, with a fake transaction holding the executed queries and a
+// fake interpreter which fails on queries containing `fail ` and on batched queries containing `fail_batched`.
+struct FakeConsumer {
+  std::vector<std::string> Consume(const std::vector<QueryBatcher::QueryAndParams> &queries) {
+    std::vector<std::string> transaction;
+    auto execute = [&](const std::string &query, const Params::map_t &params) {
+      const auto batched = params.contains(std::string{memgraph::query::stream::kBatchParameterName});
+      if (query.find("fail ") != std::string::npos || (batched && query.find("fail_batched") != std::string::npos)) {
+        throw memgraph::query::QueryRuntimeException("Failed query");
+      }
+      if (!batched) {
+        // Missing parameters make the query fail
+        for (auto pos = query.find('$'); pos != std::string::npos; pos = query.find('$', pos + 1)) {
+          if (!params.contains(query.substr(pos + 1, 1))) {
+            throw memgraph::query::UnprovidedParameterError("Parameter not provided.");
+          }
+        }
+      }
+      transaction.push_back(batched ? fmt::format("{} x{}", query.substr(query.find("WITH")),
+                                                  params.begin()->second.ValueList().size())
+                                    : query);
+    };
+    memgraph::utils::OnScopeExit cleanup{[&] { batcher.Reset(); }};
+    while (true) {
+      transaction.clear();
+      ++transactions;
+      if (!batcher.Execute(queries, execute)) continue;
+      batcher.Commit();
+      return transaction;
+    }
+  }
+
+  QueryBatcher batcher{"stream", 2};
+  int transactions{0};
+};
+}  // namespace
+
+TEST(StreamsBatching, ExecutesConsecutiveQueriesInBatches) {
+  FakeConsumer consumer;
+  EXPECT_EQ(consumer.Consume({{"CREATE ({x: $x})", MakeParams(1)},
+                              {"CREATE ({x: $x})", MakeParams(2)},
+                              {"MATCH (n) DELETE n", Params{}},
+                              {"CREATE ({x: $x})", MakeParams(3)},
+                              {"MATCH (n) RETURN n", Params{}},
+                              {"MATCH (n) RETURN n", Params{}}}),
+            (std::vector<std::string>{"WITH __memgraph_stream_row CREATE ({x: __memgraph_stream_row['x']})\n} x2",
+                                      "MATCH (n) DELETE n", "CREATE ({x: $x})",
+                                      "WITH __memgraph_stream_row MATCH (n) RETURN n\n} x2"}));
+  EXPECT_EQ(consumer.transactions, 1);
+}
+
+TEST(StreamsBatching, ExecutesOneByOneWithMissingParameters) {
+  FakeConsumer consumer;
+  const std::vector<QueryBatcher::QueryAndParams> queries{
+      {"CREATE ({x: $x})", MakeParams(1)}, {"CREATE ({x: $x})", Params{}}, {"CREATE ({x: $x})", MakeParams(3)}};
+  // The batched query would create a node with a null property
+  EXPECT_THROW(consumer.Consume(queries), memgraph::query::UnprovidedParameterError);
+  EXPECT_EQ(consumer.transactions, 1);
+  // Missing parameters don't make the query unbatchable
+  EXPECT_FALSE(consumer.batcher.IsUnbatchable(queries[0].first));
+}
+
+TEST(StreamsBatching, RetriesFailedBatchOneByOne) {
+  FakeConsumer consumer;
+  const std::vector<QueryBatcher::QueryAndParams> queries{{"MATCH (n) DELETE n", Params{}},
+                                                          {"CREATE ({fail_batched: $x})", MakeParams(1)},
+                                                          {"CREATE ({fail_batched: $x})", MakeParams(2)}};
+  EXPECT_EQ(consumer.Consume(queries), (std::vector<std::string>{"MATCH (n) DELETE n", "CREATE ({fail_batched: $x})",
+                                                                 "CREATE ({fail_batched: $x})"}));
+  EXPECT_EQ(consumer.transactions, 2);
+  EXPECT_TRUE(consumer.batcher.IsUnbatchable(queries[1].first));
+
+  // The query isn't batched anymore, so the transaction isn't aborted again
+  EXPECT_EQ(consumer.Consume(queries).size(), 3);
+  EXPECT_EQ(consumer.transactions, 3);
+}
+
+TEST(StreamsBatching, RemembersOnlyFailuresCausedByBatching) {
+  FakeConsumer consumer;
+  const std::vector<QueryBatcher::QueryAndParams> failing{{"CREATE ({fail : $x})", MakeParams(1)},
+                                                          {"CREATE ({fail : $x})", MakeParams(2)}};
+  EXPECT_THROW(consumer.Consume(failing), memgraph::query::QueryRuntimeException);
+  EXPECT_EQ(consumer.transactions, 2);
+  EXPECT_FALSE(consumer.batcher.IsUnbatchable(failing[0].first));
+
+  // The query failed one by one as well, so it's batched again with the next messages
+  consumer.transactions = 0;
+  EXPECT_THROW(consumer.Consume(failing), memgraph::query::QueryRuntimeException);
+  EXPECT_EQ(consumer.transactions, 2);
+}
+
+TEST(StreamsBatching, BoundsUnbatchableQueries) {
+  FakeConsumer consumer;
+  for (const auto *query : {"CREATE ({fail_batched: $x})", "CREATE ({fail_batched: $x, a: 1})",
+                            "CREATE ({fail_batched: $x, b: 1})"}) {
+    consumer.Consume({{query, MakeParams(1)}, {query, MakeParams(2)}});
+  }
+  EXPECT_FALSE(consumer.batcher.IsUnbatchable("CREATE ({fail_batched: $x})"));
+  EXPECT_TRUE(consumer.batcher.IsUnbatchable("CREATE ({fail_batched: $x, a: 1})"));
+  EXPECT_TRUE(consumer.batcher.IsUnbatchable("CREATE ({fail_batched: $x, b: 1})"));
+}
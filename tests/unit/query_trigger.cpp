@@ -1,4 +1,4 @@
-// Copyright 2025 Memgraph Ltd.
+// Copyright 2026 Memgraph Ltd.
 //
 // Use of this software is governed by the Business Source License
 // included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -387,6 +387,80 @@ TYPED_TEST(TriggerContextTest, ReturnCreateOnlyEvent) {
   CheckTypedValueSize(trigger_context, memgraph::query::TriggerIdentifierTag::UPDATED_OBJECTS, 0, dba);
 }
 
+// Contexts of several transactions are merged into one for a batched run of the AFTER COMMIT triggers.
+TYPED_TEST(TriggerContextTest, MergeContexts) {
+  memgraph::query::DbAccessor dba{this->StartTransaction()};
+
+  auto create_vertex_context = [&] {
+    memgraph::query::TriggerContextCollector trigger_context_collector{kAllEventTypes};
+    auto vertex = dba.InsertVertex();
+    trigger_context_collector.RegisterCreatedObject(vertex);
+    return std::move(trigger_context_collector).TransformToTriggerContext();
+  };
+
+  auto trigger_context = create_vertex_context();
+  trigger_context.Merge(create_vertex_context());
+
+  memgraph::query::TriggerContextCollector trigger_context_collector{kAllEventTypes};
+  auto vertex = dba.InsertVertex();
+  dba.AdvanceCommand();
+  trigger_context_collector.RegisterSetVertexLabel(vertex, dba.NameToLabel("LABEL"));
+  trigger_context.Merge(std::move(trigger_context_collector).TransformToTriggerContext());
+  dba.AdvanceCommand();
+
+  CheckTypedValueSize(trigger_context, memgraph::query::TriggerIdentifierTag::CREATED_VERTICES, 2, dba);
+  CheckLabelList(trigger_context, memgraph::query::TriggerIdentifierTag::SET_VERTEX_LABELS, 1, dba);
+  CheckTypedValueSize(trigger_context, memgraph::query::TriggerIdentifierTag::UPDATED_VERTICES, 1, dba);
+  CheckTypedValueSize(trigger_context, memgraph::query::TriggerIdentifierTag::DELETED_VERTICES, 0, dba);
+}
+
+// An object created by one transaction of a batch and deleted by a later one is reported only as deleted, since it
+// no longer exists when the batch is adapted for the triggers.
+TYPED_TEST(TriggerContextTest, MergeCreatedAndLaterDeleted) {
+  memgraph::query::TriggerContext trigger_context;
+  {
+    memgraph::query::DbAccessor dba{this->StartTransaction()};
+    memgraph::query::TriggerContextCollector trigger_context_collector{kAllEventTypes};
+    trigger_context_collector.RegisterCreatedObject(dba.InsertVertex());
+    dba.AdvanceCommand();
+    trigger_context = std::move(trigger_context_collector).TransformToTriggerContext();
+    ASSERT_FALSE(dba.Commit().HasError());
+  }
+
+  {
+    memgraph::query::DbAccessor dba{this->StartTransaction()};
+    memgraph::query::TriggerContextCollector trigger_context_collector{kAllEventTypes};
+    auto vertices = dba.Vertices(memgraph::storage::View::OLD);
+    auto vertex = *vertices.begin();
+    auto maybe_deleted = dba.RemoveVertex(&vertex);
+    ASSERT_TRUE(maybe_deleted.HasValue() && maybe_deleted.GetValue());
+    trigger_context_collector.RegisterDeletedObject(*maybe_deleted.GetValue());
+    dba.AdvanceCommand();
+    trigger_context.Merge(std::move(trigger_context_collector).TransformToTriggerContext());
+    ASSERT_FALSE(dba.Commit().HasError());
+  }
+
+  memgraph::query::DbAccessor dba{this->StartTransaction()};
+  trigger_context.AdaptForAccessor(&dba);
+
+  CheckTypedValueSize(trigger_context, memgraph::query::TriggerIdentifierTag::CREATED_VERTICES, 0, dba);
+  CheckTypedValueSize(trigger_context, memgraph::query::TriggerIdentifierTag::CREATED_OBJECTS, 0, dba);
+  CheckTypedValueSize(trigger_context, memgraph::query::TriggerIdentifierTag::DELETED_VERTICES, 1, dba);
+  CheckTypedValueSize(trigger_context, memgraph::query::TriggerIdentifierTag::DELETED_OBJECTS, 1, dba);
+}
+
+TEST(AfterCommitTriggerBatch, PopAtMostMaxSize) {
+  memgraph::query::AfterCommitTriggerBatch batch;
+  ASSERT_TRUE(batch.Pop(2).empty());
+
+  for (int i = 0; i < 3; ++i) {
+    batch.Push(memgraph::query::TriggerContext{}, nullptr);
+  }
+  ASSERT_EQ(batch.Pop(2).size(), 2);
+  ASSERT_EQ(batch.Pop(2).size(), 1);
+  ASSERT_TRUE(batch.Pop(2).empty());
+}
+
 namespace {
 void EXPECT_PROP_TRUE(const memgraph::query::TypedValue &a) {
   EXPECT_TRUE(a.type() == memgraph::query::TypedValue::Type::Bool && a.ValueBool());
@@ -1,4 +1,4 @@
-// Copyright 2025 Memgraph Ltd.
+// Copyright 2026 Memgraph Ltd.
 //
 // Use of this software is governed by the Business Source License
 // included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -95,6 +95,47 @@ void CheckPlansProduce(size_t expected_plan_count, memgraph::query::CypherQuery
   }
 }
 
+// Collects the scans, expansions and Cartesian products of a plan, from the
+// last operator towards the first one.
+class PlanShapeCollector : public HierarchicalLogicalOperatorVisitor {
+ public:
+  using HierarchicalLogicalOperatorVisitor::PostVisit;
+  using HierarchicalLogicalOperatorVisitor::PreVisit;
+  using HierarchicalLogicalOperatorVisitor::Visit;
+
+  bool Visit(Once &) override { return true; }
+
+  bool PreVisit(ScanAll &op) override {
+    shape.push_back(op.ToString());
+    return true;
+  }
+
+  bool PreVisit(Expand &op) override {
+    shape.push_back(op.ToString());
+    return true;
+  }
+
+  bool PreVisit(Cartesian &) override {
+    shape.emplace_back("Cartesian");
+    return true;
+  }
+
+  std::vector<std::string> shape;
+};
+
+// Checks the shape of the plan starting from the first node of the query.
+void CheckFirstPlanShape(memgraph::query::CypherQuery *query, AstStorage &storage, memgraph::query::DbAccessor *dba,
+                         const std::vector<std::string> &expected_shape) {
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto planning_context = MakePlanningContext(&storage, &symbol_table, query, dba);
+  auto query_parts = CollectQueryParts(symbol_table, storage, query, false);
+  auto plans = MakeLogicalPlanForSingleQuery<VariableStartPlanner>(query_parts, &planning_context);
+  ASSERT_NE(plans.begin(), plans.end());
+  PlanShapeCollector collector;
+  (*plans.begin())->Accept(collector);
+  EXPECT_EQ(collector.shape, expected_shape);
+}
+
 template <typename StorageType>
 class TestVariableStartPlanner : public testing::Test {
  public:
@@ -162,6 +203,130 @@ TYPED_TEST(TestVariableStartPlanner, MatchTripletPatternReturn) {
   }
 }
 
+TYPED_TEST(TestVariableStartPlanner, MatchDisconnectedPatternsReturn) {
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  // Make a graph (v1) -[:r]-> (v2), (v3) -[:r]-> (v4:B)
+  auto v1 = dba.InsertVertex();
+  auto v2 = dba.InsertVertex();
+  auto v3 = dba.InsertVertex();
+  auto v4 = dba.InsertVertex();
+  ASSERT_TRUE(v4.AddLabel(dba.NameToLabel("B")).HasValue());
+  ASSERT_TRUE(dba.InsertEdge(&v1, &v2, dba.NameToEdgeType("r")).HasValue());
+  ASSERT_TRUE(dba.InsertEdge(&v3, &v4, dba.NameToEdgeType("r")).HasValue());
+  dba.AdvanceCommand();
+  // Test `MATCH (n) -[r]-> (m), (l) -[e]-> (k:B) RETURN n, k`. Starting from
+  // the first pattern, the second one is continued from `k`.
+  auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n"), EDGE("r", Direction::OUT), NODE("m")),
+                                         PATTERN(NODE("l"), EDGE("e", Direction::OUT), NODE("k", "B"))),
+                                   RETURN("n", "k")));
+  // We have 6 entities: `n`, `r`, `m`, `l`, `e` and `k` from which we could start.
+  CheckPlansProduce(6, query, this->storage, &dba, [&](const auto &results) {
+    // Edges must differ, so we expect to produce only (v1), (v4).
+    AssertRows(results,
+               {{TypedValue(memgraph::query::VertexAccessor(v1)), TypedValue(memgraph::query::VertexAccessor(v4))}},
+               dba);
+  });
+}
+
+TYPED_TEST(TestVariableStartPlanner, MatchJoinedDisconnectedPatternsReturn) {
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  auto id = dba.NameToProperty("id");
+  // Make a graph (v1 {id: 1}) -[:r]-> (v2 {id: 2}), (v3 {id: 3}) -[:r]-> (v4 {id: 1})
+  auto v1 = dba.InsertVertex();
+  ASSERT_TRUE(v1.SetProperty(id, memgraph::storage::PropertyValue(1)).HasValue());
+  auto v2 = dba.InsertVertex();
+  ASSERT_TRUE(v2.SetProperty(id, memgraph::storage::PropertyValue(2)).HasValue());
+  auto v3 = dba.InsertVertex();
+  ASSERT_TRUE(v3.SetProperty(id, memgraph::storage::PropertyValue(3)).HasValue());
+  auto v4 = dba.InsertVertex();
+  ASSERT_TRUE(v4.SetProperty(id, memgraph::storage::PropertyValue(1)).HasValue());
+  ASSERT_TRUE(dba.InsertEdge(&v1, &v2, dba.NameToEdgeType("r")).HasValue());
+  ASSERT_TRUE(dba.InsertEdge(&v3, &v4, dba.NameToEdgeType("r")).HasValue());
+  dba.AdvanceCommand();
+  // Test `MATCH (n) -[r]-> (m), (l) -[e]-> (k) WHERE k.id = n.id RETURN n, k`.
+  // Starting from the first pattern, the second one is continued from `k`,
+  // which is joined with `n` on the equality.
+  auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n"), EDGE("r", Direction::OUT), NODE("m")),
+                                         PATTERN(NODE("l"), EDGE("e", Direction::OUT), NODE("k"))),
+                                   WHERE(EQ(PROPERTY_LOOKUP(dba, "k", id), PROPERTY_LOOKUP(dba, "n", id))),
+                                   RETURN("n", "k")));
+  // We have 6 entities: `n`, `r`, `m`, `l`, `e` and `k` from which we could start.
+  CheckPlansProduce(6, query, this->storage, &dba, [&](const auto &results) {
+    AssertRows(results,
+               {{TypedValue(memgraph::query::VertexAccessor(v1)), TypedValue(memgraph::query::VertexAccessor(v4))}},
+               dba);
+  });
+}
+
+TYPED_TEST(TestVariableStartPlanner, MatchCyclicPatternReturn) {
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  // Make a graph (v1) -[:r]-> (v2) -[:r]-> (v3) -[:r]-> (v1) with a tail (v3) -[:r]-> (v4)
+  auto v1 = dba.InsertVertex();
+  auto v2 = dba.InsertVertex();
+  auto v3 = dba.InsertVertex();
+  auto v4 = dba.InsertVertex();
+  ASSERT_TRUE(dba.InsertEdge(&v1, &v2, dba.NameToEdgeType("r")).HasValue());
+  ASSERT_TRUE(dba.InsertEdge(&v2, &v3, dba.NameToEdgeType("r")).HasValue());
+  ASSERT_TRUE(dba.InsertEdge(&v3, &v1, dba.NameToEdgeType("r")).HasValue());
+  ASSERT_TRUE(dba.InsertEdge(&v3, &v4, dba.NameToEdgeType("r")).HasValue());
+  dba.AdvanceCommand();
+  // Test `MATCH (a) -[r1]-> (b) -[r2]-> (c) -[r3]-> (a) RETURN a, b, c`. The
+  // expansion closing the cycle is chained as soon as both its nodes are bound.
+  auto *query = QUERY(
+      SINGLE_QUERY(MATCH(PATTERN(NODE("a"), EDGE("r1", Direction::OUT), NODE("b"), EDGE("r2", Direction::OUT),
+                                 NODE("c"), EDGE("r3", Direction::OUT), NODE("a"))),
+                   RETURN("a", "b", "c")));
+  // We have 6 entities: `a`, `r1`, `b`, `r2`, `c` and `r3` from which we could start.
+  CheckPlansProduce(6, query, this->storage, &dba, [&](const auto &results) {
+    auto row = [](const auto &a, const auto &b, const auto &c) {
+      return std::vector<TypedValue>{TypedValue(memgraph::query::VertexAccessor(a)),
+                                     TypedValue(memgraph::query::VertexAccessor(b)),
+                                     TypedValue(memgraph::query::VertexAccessor(c))};
+    };
+    AssertRows(results, {row(v1, v2, v3), row(v2, v3, v1), row(v3, v1, v2)}, dba);
+  });
+}
+
+TYPED_TEST(TestVariableStartPlanner, MatchCyclicPatternPlanShape) {
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  // Test `MATCH (a) -[p]-> (b), (a) -[q]-> (d), (b) -[r]-> (a) RETURN a`.
+  // Starting from `a`, `r` closes the cycle as soon as `p` binds `b`, so it is
+  // expanded before `q` even though `q` was queued first.
+  auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("a"), EDGE("p", Direction::OUT), NODE("b")),
+                                         PATTERN(NODE("a"), EDGE("q", Direction::OUT), NODE("d")),
+                                         PATTERN(NODE("b"), EDGE("r", Direction::OUT), NODE("a"))),
+                                   RETURN("a")));
+  CheckFirstPlanShape(query, this->storage, &dba,
+                      {"Expand (a)-[q]->(d)", "Expand (a)<-[r]-(b)", "Expand (a)-[p]->(b)", "ScanAll (a)"});
+}
+
+TYPED_TEST(TestVariableStartPlanner, MatchJoinedDisconnectedPatternsPlanShape) {
+  {
+    // Node estimates are based on the committed vertex count.
+    auto storage_dba = this->db->Access();
+    for (int i = 0; i < 4; ++i) {
+      storage_dba->CreateVertex();
+    }
+    ASSERT_FALSE(storage_dba->Commit().HasError());
+  }
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  auto id = dba.NameToProperty("id");
+  // Test `MATCH (n) -[r]-> (m), (l:A:B) -[e]-> (k) WHERE k.id = n.id RETURN n, k`.
+  // On its own `l` is estimated to match fewer vertices than `k`, but the
+  // equality join with the bound `n` makes the second part cheaper from `k`.
+  auto *query = QUERY(
+      SINGLE_QUERY(MATCH(PATTERN(NODE("n"), EDGE("r", Direction::OUT), NODE("m")),
+                         PATTERN(NODE_WITH_LABELS("l", {"A", "B"}), EDGE("e", Direction::OUT), NODE("k"))),
+                   WHERE(EQ(PROPERTY_LOOKUP(dba, "k", id), PROPERTY_LOOKUP(dba, "n", id))), RETURN("n", "k")));
+  CheckFirstPlanShape(query, this->storage, &dba,
+                      {"Cartesian", "Expand (n)-[r]->(m)", "ScanAll (n)", "Expand (k)<-[e]-(l)", "ScanAll (k)"});
+}
+
 TYPED_TEST(TestVariableStartPlanner, MatchOptionalMatchReturn) {
   auto storage_dba = this->db->Access();
   memgraph::query::DbAccessor dba(storage_dba.get());
@@ -11,12 +11,17 @@
 
 #include <gtest/gtest.h>
 
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
 #include "coordination/coordinator_communication_config.hpp"
 #include "coordination/coordinator_slk.hpp"
 #include "io/network/endpoint.hpp"
 #include "replication_coordination_glue/mode.hpp"
 #include "slk_common.hpp"
 #include "storage/v2/property_value.hpp"
+#include "storage/v2/replication/serialization.hpp"
 #include "storage/v2/replication/slk.hpp"
 #include "storage/v2/temporal.hpp"
 #include "utils/temporal.hpp"
@@ -167,3 +172,39 @@ TEST(SlkAdvanced, ReplicationClientConfigs) {
 
   ASSERT_EQ(original, decoded);
 }
+
+TEST(SlkAdvanced, DurabilityFileChunks) {
+  auto const directory = std::filesystem::temp_directory_path() / "MG_test_unit_slk_advanced_file_chunks";
+  std::filesystem::remove_all(directory);
+  std::filesystem::create_directories(directory / "received");
+  auto const path = directory / "durability_file";
+
+  // Compressible chunks followed by an incompressible one, and a partial last chunk
+  std::string original(2 * memgraph::utils::kFileBufferSize, 'a');
+  uint32_t state = 42;
+  for (size_t i = 0; i < memgraph::utils::kFileBufferSize + 1000; ++i) {
+    state = state * 1664525U + 1013904223U;
+    original.push_back(static_cast<char>(state >> 24U));
+  }
+  std::ofstream(path, std::ios::binary) << original;
+
+  memgraph::slk::Loopback loopback;
+  auto *builder = loopback.GetBuilder();
+  {
+    memgraph::storage::replication::Encoder encoder(builder);
+    ASSERT_TRUE(encoder.WriteFile(path));
+  }
+
+  auto *reader = loopback.GetReader();
+  ASSERT_LT(loopback.size(), original.size());
+  memgraph::storage::replication::Decoder decoder(reader);
+  auto const received_path = decoder.ReadFile(directory / "received");
+  ASSERT_TRUE(received_path);
+  ASSERT_EQ(*received_path, directory / "received" / "durability_file");
+
+  std::ifstream received(*received_path, std::ios::binary);
+  std::string const decoded{std::istreambuf_iterator<char>(received), std::istreambuf_iterator<char>()};
+  ASSERT_EQ(original, decoded);
+
+  std::filesystem::remove_all(directory);
+}
@@ -37,6 +37,7 @@
 #include "storage/v2/constraints/existence_constraints.hpp"
 #include "storage/v2/constraints/type_constraints_kind.hpp"
 #include "storage/v2/durability/durability.hpp"
+#include "storage/v2/durability/incremental_snapshot.hpp"
 #include "storage/v2/durability/marker.hpp"
 #include "storage/v2/durability/paths.hpp"
 #include "storage/v2/durability/snapshot.hpp"
@@ -1109,6 +1110,11 @@ class DurabilityTest : public ::testing::TestWithParam<bool> {
     return GetFilesList(storage_directory / memgraph::storage::durability::kSnapshotDirectory);
   }
 
+  std::vector<std::filesystem::path> GetIncrementalSnapshotsList() {
+    return GetFilesList(storage_directory / memgraph::storage::durability::kSnapshotDirectory /
+                        memgraph::storage::durability::kIncrementalSnapshotDirectory);
+  }
+
   std::vector<std::filesystem::path> GetBackupSnapshotsList() {
     return GetFilesList(storage_directory / memgraph::storage::durability::kBackupDirectory /
                         memgraph::storage::durability::kSnapshotDirectory);
@@ -1150,6 +1156,8 @@ class DurabilityTest : public ::testing::TestWithParam<bool> {
     for (auto &item : std::filesystem::directory_iterator(path, ec)) {
       // Parallel snapshot creation creates additional temporary files; these need to be ignored for the test
       if (item.path().filename().string().find("_part_") != std::string::npos) continue;
+      // Incremental snapshots are kept in a subdirectory of the snapshot directory
+      if (!item.is_regular_file()) continue;
       ret.push_back(item.path());
     }
     std::sort(ret.begin(), ret.end());
@@ -3766,3 +3774,118 @@ TEST_P(DurabilityTest, EdgeMetadataRecovered) {
     ASSERT_FALSE(acc->Commit().HasError());
   }
 }
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, IncrementalSnapshotRecovery) {
+  memgraph::storage::Config config{
+      .durability = {.storage_directory = storage_directory,
+                     .snapshot_wal_mode = memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT,
+                     .snapshot_interval = memgraph::utils::SchedulerInterval("10000"),
+                     .snapshot_incremental_layers = 2,
+                     .snapshot_on_exit = false},
+      .salient = {.items = {.properties_on_edges = GetParam(), .enable_schema_info = true}},
+  };
+  memgraph::storage::Gid gid_v1;
+  memgraph::storage::Gid gid_v2;
+  memgraph::storage::Gid gid_v4;
+  {
+    memgraph::utils::Synchronized<memgraph::replication::ReplicationState, memgraph::utils::RWSpinLock> repl_state{
+        memgraph::storage::ReplicationStateRootPath(config)};
+    memgraph::dbms::Database db{config, repl_state};
+    auto *mem_storage = static_cast<memgraph::storage::InMemoryStorage *>(db.storage());
+    auto const label = db.storage()->NameToLabel("l");
+    auto const property = db.storage()->NameToProperty("p");
+    auto const edge_type = db.storage()->NameToEdgeType("et");
+
+    // Full snapshot of the base data.
+    {
+      auto acc = db.Access();
+      auto v1 = acc->CreateVertex();
+      auto v2 = acc->CreateVertex();
+      auto v3 = acc->CreateVertex();
+      gid_v1 = v1.Gid();
+      gid_v2 = v2.Gid();
+      ASSERT_FALSE(v1.AddLabel(label).HasError());
+      ASSERT_FALSE(v1.SetProperty(property, memgraph::storage::PropertyValue(1)).HasError());
+      ASSERT_TRUE(acc->CreateEdge(&v1, &v2, edge_type).HasValue());
+      ASSERT_TRUE(acc->CreateEdge(&v2, &v3, edge_type).HasValue());
+      ASSERT_FALSE(acc->Commit().HasError());
+    }
+    ASSERT_FALSE(mem_storage->CreateSnapshot({}).HasError());
+    ASSERT_EQ(GetSnapshotsList().size(), 1);
+
+    // First layer: modify, delete and create vertices.
+    {
+      auto acc = db.Access();
+      auto v1 = acc->FindVertex(gid_v1, memgraph::storage::View::OLD);
+      auto v2 = acc->FindVertex(gid_v2, memgraph::storage::View::OLD);
+      ASSERT_TRUE(v1 && v2);
+      ASSERT_FALSE(v1->SetProperty(property, memgraph::storage::PropertyValue(2)).HasError());
+      auto v3_edges = v2->OutEdges(memgraph::storage::View::OLD);
+      ASSERT_TRUE(v3_edges.HasValue());
+      ASSERT_EQ(v3_edges->edges.size(), 1);
+      auto v3 = v3_edges->edges[0].ToVertex();
+      ASSERT_TRUE(acc->DetachDeleteVertex(&v3).HasValue());
+      auto v4 = acc->CreateVertex();
+      gid_v4 = v4.Gid();
+      ASSERT_TRUE(acc->CreateEdge(&*v2, &v4, edge_type).HasValue());
+      ASSERT_FALSE(acc->Commit().HasError());
+    }
+    ASSERT_FALSE(mem_storage->CreateSnapshot({}).HasError());
+    ASSERT_EQ(GetSnapshotsList().size(), 1);
+    ASSERT_EQ(GetIncrementalSnapshotsList().size(), 1);
+
+    // Second layer: remove a label and an edge.
+    {
+      auto acc = db.Access();
+      auto v1 = acc->FindVertex(gid_v1, memgraph::storage::View::OLD);
+      ASSERT_TRUE(v1);
+      ASSERT_FALSE(v1->RemoveLabel(label).HasError());
+      auto out_edges = v1->OutEdges(memgraph::storage::View::OLD);
+      ASSERT_TRUE(out_edges.HasValue());
+      ASSERT_EQ(out_edges->edges.size(), 1);
+      ASSERT_TRUE(acc->DeleteEdge(&out_edges->edges[0]).HasValue());
+      ASSERT_FALSE(acc->Commit().HasError());
+    }
+    ASSERT_FALSE(mem_storage->CreateSnapshot({}).HasError());
+    ASSERT_EQ(GetSnapshotsList().size(), 1);
+    ASSERT_EQ(GetIncrementalSnapshotsList().size(), 2);
+  }
+
+  // Recover the full snapshot together with both layers.
+  config.durability.recover_on_startup = true;
+  memgraph::utils::Synchronized<memgraph::replication::ReplicationState, memgraph::utils::RWSpinLock> repl_state{
+      memgraph::storage::ReplicationStateRootPath(config)};
+  memgraph::dbms::Database db{config, repl_state};
+  auto const label = db.storage()->NameToLabel("l");
+  auto const property = db.storage()->NameToProperty("p");
+  auto acc = db.Access();
+  ASSERT_EQ(acc->ApproximateVertexCount(), 3);
+  ASSERT_EQ(acc->ApproximateEdgeCount(), 1);
+
+  auto v1 = acc->FindVertex(gid_v1, memgraph::storage::View::OLD);
+  ASSERT_TRUE(v1);
+  ASSERT_FALSE(*v1->HasLabel(label, memgraph::storage::View::OLD));
+  ASSERT_EQ(*v1->GetProperty(property, memgraph::storage::View::OLD), memgraph::storage::PropertyValue(2));
+  ASSERT_EQ(v1->OutEdges(memgraph::storage::View::OLD)->edges.size(), 0);
+
+  auto v2 = acc->FindVertex(gid_v2, memgraph::storage::View::OLD);
+  ASSERT_TRUE(v2);
+  ASSERT_EQ(v2->InEdges(memgraph::storage::View::OLD)->edges.size(), 0);
+  auto v2_out = v2->OutEdges(memgraph::storage::View::OLD);
+  ASSERT_TRUE(v2_out.HasValue());
+  ASSERT_EQ(v2_out->edges.size(), 1);
+  ASSERT_EQ(v2_out->edges[0].ToVertex().Gid(), gid_v4);
+
+  // The next snapshot after a restart is a full one and makes the layers obsolete.
+  auto *mem_storage = static_cast<memgraph::storage::InMemoryStorage *>(db.storage());
+  {
+    auto write_acc = db.Access();
+    write_acc->CreateVertex();
+    ASSERT_FALSE(write_acc->Commit().HasError());
+  }
+  acc.reset();
+  ASSERT_FALSE(mem_storage->CreateSnapshot({}).HasError());
+  ASSERT_EQ(GetSnapshotsList().size(), 2);
+  ASSERT_EQ(GetIncrementalSnapshotsList().size(), 0);
+}
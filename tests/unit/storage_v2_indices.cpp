@@ -614,6 +614,59 @@ TYPED_TEST(IndexTest, LabelIndexClearOldDataFromDisk) {
   }
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TYPED_TEST(IndexTest, LabelIndexCreateConcurrently) {
+  if constexpr (!(std::is_same_v<TypeParam, memgraph::storage::InMemoryStorage>)) {
+    return;
+  }
+  {
+    auto acc = this->storage->Access();
+    for (int i = 0; i < 10; ++i) {
+      auto vertex = this->CreateVertex(acc.get());
+      ASSERT_NO_ERROR(vertex.AddLabel(i % 2 ? this->label1 : this->label2));
+    }
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+
+  // Transactions that are active while the index gets created
+  auto reader = this->storage->Access();
+  auto writer = this->storage->Access();
+  for (auto vertex : writer->Vertices(View::OLD)) {
+    if (vertex.GetProperty(this->prop_id, View::OLD)->ValueInt() == 1) {
+      ASSERT_NO_ERROR(vertex.RemoveLabel(this->label1));
+    }
+  }
+  for (int i = 10; i < 14; ++i) {
+    auto vertex = this->CreateVertex(writer.get());
+    ASSERT_NO_ERROR(vertex.AddLabel(this->label1));
+  }
+
+  {
+    // Doesn't block the writer
+    auto index_acc = this->storage->Access(Storage::Accessor::Type::READ);
+    EXPECT_FALSE(index_acc->CreateIndex(this->label1).HasError());
+    EXPECT_TRUE(index_acc->CreateIndex(this->label1).HasError());
+    ASSERT_NO_ERROR(index_acc->Commit());
+  }
+
+  {
+    auto vertex = this->CreateVertex(writer.get());
+    ASSERT_NO_ERROR(vertex.AddLabel(this->label1));
+  }
+
+  EXPECT_THAT(this->GetIds(reader->Vertices(this->label1, View::OLD), View::OLD), UnorderedElementsAre(1, 3, 5, 7, 9));
+  EXPECT_THAT(this->GetIds(writer->Vertices(this->label1, View::NEW), View::NEW),
+              UnorderedElementsAre(3, 5, 7, 9, 10, 11, 12, 13, 14));
+  ASSERT_NO_ERROR(writer->Commit());
+
+  {
+    auto acc = this->storage->Access();
+    EXPECT_TRUE(acc->LabelIndexExists(this->label1));
+    EXPECT_THAT(this->GetIds(acc->Vertices(this->label1, View::OLD), View::OLD),
+                UnorderedElementsAre(3, 5, 7, 9, 10, 11, 12, 13, 14));
+  }
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TYPED_TEST(IndexTest, LabelPropertyIndexCreateAndDrop) {
   {
@@ -1865,6 +1918,165 @@ TYPED_TEST(IndexTest, LabelPropertyIndexClearOldDataFromDisk) {
   }
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TYPED_TEST(IndexTest, LabelPropertyIndexCreateConcurrently) {
+  if constexpr (!(std::is_same_v<TypeParam, memgraph::storage::InMemoryStorage>)) {
+    return;
+  }
+  {
+    auto acc = this->storage->Access();
+    for (int i = 0; i < 10; ++i) {
+      auto vertex = this->CreateVertex(acc.get());
+      ASSERT_NO_ERROR(vertex.AddLabel(this->label1));
+      ASSERT_NO_ERROR(vertex.SetProperty(this->prop_val, PropertyValue(i)));
+    }
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+
+  // Transactions that are active while the index gets created
+  auto reader = this->storage->Access();
+  auto writer = this->storage->Access();
+  for (auto vertex : writer->Vertices(View::OLD)) {
+    if (vertex.GetProperty(this->prop_id, View::OLD)->ValueInt() == 1) {
+      ASSERT_NO_ERROR(vertex.SetProperty(this->prop_val, PropertyValue(100)));
+    }
+  }
+
+  {
+    // Doesn't block the writer
+    auto index_acc = this->storage->Access(Storage::Accessor::Type::READ);
+    EXPECT_FALSE(index_acc->CreateIndex(this->label1, {this->prop_val}).HasError());
+    ASSERT_NO_ERROR(index_acc->Commit());
+  }
+
+  {
+    auto vertex = this->CreateVertex(writer.get());
+    ASSERT_NO_ERROR(vertex.AddLabel(this->label1));
+    ASSERT_NO_ERROR(vertex.SetProperty(this->prop_val, PropertyValue(100)));
+  }
+
+  EXPECT_THAT(this->GetIds(reader->Vertices(this->label1, std::array{this->prop_val},
+                                            std::array{pvr::Equal(PropertyValue(1))}, View::OLD)),
+              UnorderedElementsAre(1));
+  EXPECT_THAT(this->GetIds(writer->Vertices(this->label1, std::array{this->prop_val},
+                                            std::array{pvr::Equal(PropertyValue(100))}, View::NEW),
+                           View::NEW),
+              UnorderedElementsAre(1, 10));
+  ASSERT_NO_ERROR(writer->Commit());
+
+  {
+    auto acc = this->storage->Access();
+    EXPECT_TRUE(acc->LabelPropertyIndexExists(this->label1, std::array{this->prop_val}));
+    EXPECT_THAT(this->GetIds(acc->Vertices(this->label1, std::array{this->prop_val},
+                                           std::array{pvr::Equal(PropertyValue(1))}, View::OLD)),
+                IsEmpty());
+    EXPECT_THAT(this->GetIds(acc->Vertices(this->label1, std::array{this->prop_val}, View::OLD)),
+                UnorderedElementsAre(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10));
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TYPED_TEST(IndexTest, LabelPropertyIndexCreateOnMultipleThreads) {
+  if constexpr (!(std::is_same_v<TypeParam, memgraph::storage::InMemoryStorage>)) {
+    return;
+  }
+  this->config_.durability.allow_parallel_schema_creation = true;
+  this->config_.durability.items_per_batch = 7;
+  this->config_.durability.recovery_thread_count = 4;
+  this->storage = std::make_unique<TypeParam>(this->config_);
+
+  constexpr auto kVertexCount = 100;
+  {
+    auto acc = this->storage->Access();
+    for (int i = 0; i < kVertexCount; ++i) {
+      auto vertex = this->CreateVertex(acc.get());
+      ASSERT_NO_ERROR(vertex.AddLabel(i % 3 ? this->label1 : this->label2));
+      ASSERT_NO_ERROR(vertex.SetProperty(this->prop_val, PropertyValue(i % 10)));
+    }
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+
+  {
+    auto unique_acc = this->storage->UniqueAccess();
+    EXPECT_FALSE(unique_acc->CreateIndex(this->label1).HasError());
+    EXPECT_FALSE(unique_acc->CreateIndex(this->label1, {this->prop_val}).HasError());
+    ASSERT_NO_ERROR(unique_acc->Commit());
+  }
+
+  auto acc = this->storage->Access();
+  std::vector<int64_t> expected_label;
+  std::vector<int64_t> expected_value;
+  for (int64_t i = 0; i < kVertexCount; ++i) {
+    if (i % 3 == 0) continue;
+    expected_label.push_back(i);
+    if (i % 10 == 4) expected_value.push_back(i);
+  }
+  EXPECT_THAT(this->GetIds(acc->Vertices(this->label1, View::OLD)), testing::UnorderedElementsAreArray(expected_label));
+  EXPECT_THAT(this->GetIds(acc->Vertices(this->label1, std::array{this->prop_val},
+                                         std::array{pvr::Equal(PropertyValue(4))}, View::OLD)),
+              testing::UnorderedElementsAreArray(expected_value));
+  EXPECT_EQ(acc->ApproximateVertexCount(this->label1, std::array{this->prop_val}), expected_label.size());
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TYPED_TEST(IndexTest, LabelPropertyIndexCreateConcurrentlyOnMultipleThreads) {
+  if constexpr (!(std::is_same_v<TypeParam, memgraph::storage::InMemoryStorage>)) {
+    return;
+  }
+  this->config_.durability.allow_parallel_schema_creation = true;
+  this->config_.durability.items_per_batch = 7;
+  this->config_.durability.recovery_thread_count = 4;
+  this->storage = std::make_unique<TypeParam>(this->config_);
+
+  constexpr auto kVertexCount = 100;
+  {
+    auto acc = this->storage->Access();
+    for (int i = 0; i < kVertexCount; ++i) {
+      auto vertex = this->CreateVertex(acc.get());
+      ASSERT_NO_ERROR(vertex.AddLabel(i % 3 ? this->label1 : this->label2));
+      ASSERT_NO_ERROR(vertex.SetProperty(this->prop_val, PropertyValue(i % 10)));
+    }
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+
+  // A transaction writing while the index gets created
+  auto writer = this->storage->Access();
+  for (auto vertex : writer->Vertices(View::OLD)) {
+    if (vertex.GetProperty(this->prop_id, View::OLD)->ValueInt() == 1) {
+      ASSERT_NO_ERROR(vertex.SetProperty(this->prop_val, PropertyValue(4)));
+    }
+  }
+
+  {
+    auto index_acc = this->storage->Access(Storage::Accessor::Type::READ);
+    EXPECT_FALSE(index_acc->CreateIndex(this->label1).HasError());
+    EXPECT_FALSE(index_acc->CreateIndex(this->label1, {this->prop_val}).HasError());
+    ASSERT_NO_ERROR(index_acc->Commit());
+  }
+
+  {
+    auto vertex = this->CreateVertex(writer.get());
+    ASSERT_NO_ERROR(vertex.AddLabel(this->label1));
+    ASSERT_NO_ERROR(vertex.SetProperty(this->prop_val, PropertyValue(4)));
+  }
+  ASSERT_NO_ERROR(writer->Commit());
+
+  auto acc = this->storage->Access();
+  std::vector<int64_t> expected_label;
+  std::vector<int64_t> expected_value;
+  for (int64_t i = 0; i < kVertexCount; ++i) {
+    if (i % 3 == 0) continue;
+    expected_label.push_back(i);
+    if (i % 10 == 4 || i == 1) expected_value.push_back(i);
+  }
+  expected_label.push_back(kVertexCount);
+  expected_value.push_back(kVertexCount);
+  EXPECT_THAT(this->GetIds(acc->Vertices(this->label1, View::OLD)), testing::UnorderedElementsAreArray(expected_label));
+  EXPECT_THAT(this->GetIds(acc->Vertices(this->label1, std::array{this->prop_val},
+                                         std::array{pvr::Equal(PropertyValue(4))}, View::OLD)),
+              testing::UnorderedElementsAreArray(expected_value));
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TYPED_TEST(IndexTest, EdgeTypeIndexCreate) {
   if constexpr ((std::is_same_v<TypeParam, memgraph::storage::InMemoryStorage>)) {
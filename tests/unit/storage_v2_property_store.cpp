@@ -910,6 +910,169 @@ TEST(PropertyStore, ExtractPropertyValuesMissingAsNull) {
        std::array{1, 3, 5});
 }
 
+namespace {
+// Enough properties for the store to get a property directory
+void TestWideStore() {
+  std::map<PropertyId, PropertyValue> data;
+  for (int i = 1; i < 200; i += 2) {
+    if (i % 3 == 0) {
+      data.emplace(PropertyId::FromInt(i), PropertyValue(std::string(i % 7 + 1, 'a')));
+    } else {
+      data.emplace(PropertyId::FromInt(i), PropertyValue(i * 1000));
+    }
+  }
+
+  PropertyStore store;
+  ASSERT_TRUE(store.InitProperties(data));
+  auto check = [&store, &data] {
+    ASSERT_EQ(store.Properties(), data);
+    for (int i = 0; i <= 201; ++i) {
+      auto const prop = PropertyId::FromInt(i);
+      auto const it = data.find(prop);
+      if (it == data.end()) {
+        ASSERT_FALSE(store.HasProperty(prop));
+        ASSERT_TRUE(store.GetProperty(prop).IsNull());
+        ASSERT_EQ(store.PropertySize(prop), 0);
+      } else {
+        ASSERT_TRUE(store.HasProperty(prop));
+        ASSERT_EQ(store.GetProperty(prop), it->second);
+        ASSERT_TRUE(store.IsPropertyEqual(prop, it->second));
+        ASSERT_GT(store.PropertySize(prop), 0);
+      }
+    }
+
+    auto const compared = std::array{PropertyId::FromInt(1), PropertyId::FromInt(2), PropertyId::FromInt(51)};
+    auto const compared_values = std::array{data.at(PropertyId::FromInt(1)), PropertyValue(), PropertyValue(1)};
+    auto const position_lookup = std::array<std::size_t, 3>{0, 1, 2};
+    ASSERT_EQ(store.ArePropertiesEqual(compared, compared_values, position_lookup), (std::vector{true, true, false}));
+
+    auto const present = std::set{PropertyId::FromInt(3), PropertyId::FromInt(99), PropertyId::FromInt(199)};
+    auto const values = store.ExtractPropertyValues(present);
+    ASSERT_TRUE(values);
+    ASSERT_EQ(*values, (std::vector{data.at(PropertyId::FromInt(3)), data.at(PropertyId::FromInt(99)),
+                                    data.at(PropertyId::FromInt(199))}));
+    ASSERT_FALSE(store.ExtractPropertyValues({PropertyId::FromInt(3), PropertyId::FromInt(4)}));
+
+    auto const ordered = std::array{PropertyId::FromInt(0), PropertyId::FromInt(1), PropertyId::FromInt(50),
+                                    PropertyId::FromInt(51), PropertyId::FromInt(250)};
+    auto const with_nulls = store.ExtractPropertyValuesMissingAsNull(ordered);
+    ASSERT_EQ(with_nulls, (std::vector{PropertyValue(), data.at(PropertyId::FromInt(1)), PropertyValue(),
+                                       data.at(PropertyId::FromInt(51)), PropertyValue()}));
+
+    auto const restored = PropertyStore::CreateFromBuffer(store.StringBuffer());
+    ASSERT_EQ(restored.Properties(), data);
+  };
+  check();
+
+  // Same size, different size, removal and insertion
+  data[PropertyId::FromInt(5)] = PropertyValue(5001);
+  ASSERT_FALSE(store.SetProperty(PropertyId::FromInt(5), data[PropertyId::FromInt(5)]));
+  check();
+  data[PropertyId::FromInt(9)] = PropertyValue(std::string(300, 'b'));
+  ASSERT_FALSE(store.SetProperty(PropertyId::FromInt(9), data[PropertyId::FromInt(9)]));
+  check();
+  data.erase(PropertyId::FromInt(101));
+  ASSERT_FALSE(store.SetProperty(PropertyId::FromInt(101), PropertyValue()));
+  check();
+  data[PropertyId::FromInt(100)] = PropertyValue(true);
+  ASSERT_TRUE(store.SetProperty(PropertyId::FromInt(100), PropertyValue(true)));
+  check();
+}
+}  // namespace
+
+TEST(PropertyStore, WideStoreWithDirectory) { TestWideStore(); }
+
+TEST(PropertyStore, WideSharedShapes) {
+  // Shaped stores are read in place, through a directory of their own
+  FLAGS_storage_property_store_shapes_enabled = true;
+  TestWideStore();
+  FLAGS_storage_property_store_shapes_enabled = false;
+}
+
+TEST(PropertyStore, SharedShapes) {
+  FLAGS_storage_property_store_shapes_enabled = true;
+  auto const make_data = [](int n) {
+    return std::map<PropertyId, PropertyValue>{
+        {PropertyId::FromInt(1), PropertyValue(n)},
+        {PropertyId::FromInt(300), PropertyValue(std::string(20, static_cast<char>('a' + n)))},
+        {PropertyId::FromInt(301), PropertyValue(n % 2 == 0)},
+        {PropertyId::FromInt(70000), PropertyValue(n * 0.5)},
+        {PropertyId::FromInt(70001),
+         PropertyValue(std::vector<PropertyValue>{PropertyValue(n), PropertyValue("list")})},
+    };
+  };
+
+  std::vector<std::map<PropertyId, PropertyValue>> data;
+  std::vector<PropertyStore> stores(3);
+  for (int i = 0; i < 3; ++i) {
+    data.push_back(make_data(i));
+    ASSERT_TRUE(stores[i].InitProperties(data[i]));
+  }
+  auto check = [&](int i) {
+    ASSERT_EQ(stores[i].Properties(), data[i]);
+    for (auto const &[property, value] : data[i]) {
+      ASSERT_TRUE(stores[i].HasProperty(property));
+      ASSERT_EQ(stores[i].GetProperty(property), value);
+      ASSERT_TRUE(stores[i].IsPropertyEqual(property, value));
+    }
+    ASSERT_FALSE(stores[i].HasProperty(PropertyId::FromInt(2)));
+    ASSERT_TRUE(stores[i].GetProperty(PropertyId::FromInt(70002)).IsNull());
+    ASSERT_EQ(PropertyStore::CreateFromBuffer(stores[i].StringBuffer()).Properties(), data[i]);
+  };
+  for (int i = 0; i < 3; ++i) check(i);
+
+  // Diverging from the shared shape
+  data[1][PropertyId::FromInt(2)] = PropertyValue("new");
+  ASSERT_TRUE(stores[1].SetProperty(PropertyId::FromInt(2), PropertyValue("new")));
+  data[2].erase(PropertyId::FromInt(300));
+  ASSERT_FALSE(stores[2].SetProperty(PropertyId::FromInt(300), PropertyValue()));
+  data[0][PropertyId::FromInt(1)] = PropertyValue(std::numeric_limits<int64_t>::max());
+  ASSERT_FALSE(stores[0].SetProperty(PropertyId::FromInt(1), data[0][PropertyId::FromInt(1)]));
+  for (int i = 0; i < 3; ++i) check(i);
+
+  // Stores keep working once shapes are disabled again
+  FLAGS_storage_property_store_shapes_enabled = false;
+  data[1].erase(PropertyId::FromInt(2));
+  ASSERT_FALSE(stores[1].SetProperty(PropertyId::FromInt(2), PropertyValue()));
+  for (int i = 0; i < 3; ++i) check(i);
+}
+
+TEST(PropertyStore, CompressionDictionary) {
+  auto const compression_enabled = FLAGS_storage_property_store_compression_enabled;
+  FLAGS_storage_property_store_compression_enabled = true;
+  FLAGS_storage_property_store_compression_dictionary_enabled = true;
+  auto const make_data = [](int n) {
+    return std::map<PropertyId, PropertyValue>{
+        {PropertyId::FromInt(1), PropertyValue("user_" + std::to_string(n))},
+        {PropertyId::FromInt(2), PropertyValue("user_" + std::to_string(n) + "@example.com")},
+        {PropertyId::FromInt(3), PropertyValue(std::string(40, 'x'))},
+        {PropertyId::FromInt(4), PropertyValue(n)},
+    };
+  };
+
+  // Enough stores for the dictionary to get trained
+  std::vector<std::map<PropertyId, PropertyValue>> data;
+  std::vector<PropertyStore> stores(2000);
+  for (int i = 0; i < 2000; ++i) {
+    data.push_back(make_data(i));
+    ASSERT_TRUE(stores[i].InitProperties(data[i]));
+  }
+  for (int i = 0; i < 2000; i += 7) {
+    // Read twice, the second read is served from the decompressed buffer cache
+    ASSERT_EQ(stores[i].Properties(), data[i]);
+    ASSERT_EQ(stores[i].Properties(), data[i]);
+    ASSERT_EQ(stores[i].GetProperty(PropertyId::FromInt(2)), data[i][PropertyId::FromInt(2)]);
+    ASSERT_EQ(PropertyStore::CreateFromBuffer(stores[i].StringBuffer()).Properties(), data[i]);
+
+    data[i][PropertyId::FromInt(3)] = PropertyValue(std::string(30, 'y'));
+    ASSERT_FALSE(stores[i].SetProperty(PropertyId::FromInt(3), data[i][PropertyId::FromInt(3)]));
+    ASSERT_EQ(stores[i].Properties(), data[i]);
+  }
+
+  FLAGS_storage_property_store_compression_dictionary_enabled = false;
+  FLAGS_storage_property_store_compression_enabled = compression_enabled;
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   int result = RUN_ALL_TESTS();
@@ -697,6 +697,153 @@ TEST_F(ReplicationTest, RecoveryProcess) {
   }
 }
 
+TEST_F(ReplicationTest, RecoveryFromWalWithConflictingTransactions) {
+  MinMemgraph main(main_conf);
+  auto *main_storage = main.db.storage();
+  auto const property = main_storage->NameToProperty("property");
+  auto const edge_type = main_storage->NameToEdgeType("edge_type");
+
+  // Independent transactions, which the replica can apply concurrently, interleaved with transactions touching
+  // objects created or modified by the previous ones
+  static constexpr int64_t vertices_create_num = 100;
+  std::vector<Gid> vertex_gids;
+  for (int64_t i = 0; i < vertices_create_num; ++i) {
+    auto acc = main.db.Access();
+    auto v = acc->CreateVertex();
+    ASSERT_TRUE(v.SetProperty(property, PropertyValue(i)).HasValue());
+    vertex_gids.push_back(v.Gid());
+    ASSERT_FALSE(acc->Commit({}, main.db_acc).HasError());
+  }
+  std::vector<Gid> edge_gids;
+  for (int64_t i = 0; i < vertices_create_num; ++i) {
+    auto acc = main.db.Access();
+    auto from = acc->FindVertex(vertex_gids[i], View::OLD);
+    auto to = acc->FindVertex(vertex_gids[(i + 1) % vertices_create_num], View::OLD);
+    ASSERT_TRUE(from && to);
+    auto edge = acc->CreateEdge(&*from, &*to, edge_type);
+    ASSERT_TRUE(edge.HasValue());
+    ASSERT_TRUE(edge->SetProperty(property, PropertyValue(i)).HasValue());
+    edge_gids.push_back(edge->Gid());
+    ASSERT_FALSE(acc->Commit({}, main.db_acc).HasError());
+  }
+  for (int64_t i = 0; i < 10; ++i) {
+    auto acc = main.db.Access();
+    auto v = acc->FindVertex(vertex_gids[0], View::OLD);
+    ASSERT_TRUE(v);
+    ASSERT_TRUE(v->SetProperty(property, PropertyValue(-i)).HasValue());
+    ASSERT_FALSE(acc->Commit({}, main.db_acc).HasError());
+  }
+  {
+    auto acc = main.db.Access();
+    auto v = acc->FindVertex(vertex_gids[1], View::OLD);
+    ASSERT_TRUE(v);
+    auto out_edges = v->OutEdges(View::OLD);
+    ASSERT_TRUE(out_edges.HasValue());
+    ASSERT_EQ(out_edges->edges.size(), 1);
+    ASSERT_TRUE(acc->DeleteEdge(&out_edges->edges[0]).HasValue());
+    ASSERT_FALSE(acc->Commit({}, main.db_acc).HasError());
+  }
+
+  repl_conf.durability.recovery_thread_count = 4;
+  MinMemgraph replica(repl_conf);
+  replica.repl_handler.TrySetReplicationRoleReplica(
+      ReplicationServerConfig{
+          .repl_server = Endpoint(local_host, ports[0]),
+      },
+      std::nullopt);
+  ASSERT_FALSE(main.repl_handler
+                   .TryRegisterReplica(ReplicationClientConfig{
+                       .name = replicas[0],
+                       .mode = ReplicationMode::SYNC,
+                       .repl_server_endpoint = Endpoint(local_host, ports[0]),
+                   })
+                   .HasError());
+
+  while (main_storage->GetReplicaState(replicas[0]) != ReplicaState::READY) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  auto *replica_storage = replica.db.storage();
+  ASSERT_EQ(replica_storage->repl_storage_state_.last_durable_timestamp_.load(),
+            main_storage->repl_storage_state_.last_durable_timestamp_.load());
+
+  auto acc = replica.db.Access();
+  auto const replica_property = replica_storage->NameToProperty("property");
+  for (int64_t i = 0; i < vertices_create_num; ++i) {
+    auto v = acc->FindVertex(vertex_gids[i], View::OLD);
+    ASSERT_TRUE(v);
+    auto const expected = i == 0 ? PropertyValue(-9) : PropertyValue(i);
+    ASSERT_EQ(v->GetProperty(replica_property, View::OLD).GetValue(), expected);
+
+    auto out_edges = v->OutEdges(View::OLD);
+    ASSERT_TRUE(out_edges.HasValue());
+    if (i == 1) {
+      ASSERT_TRUE(out_edges->edges.empty());
+      continue;
+    }
+    ASSERT_EQ(out_edges->edges.size(), 1);
+    auto const &edge = out_edges->edges[0];
+    ASSERT_EQ(edge.Gid(), edge_gids[i]);
+    ASSERT_EQ(edge.ToVertex().Gid(), vertex_gids[(i + 1) % vertices_create_num]);
+    ASSERT_EQ(edge.GetProperty(replica_property, View::OLD).GetValue(), PropertyValue(i));
+  }
+  ASSERT_FALSE(acc->Commit().HasError());
+}
+
+TEST_F(ReplicationTest, RecoveryFromWalWithLargeTransaction) {
+  MinMemgraph main(main_conf);
+  auto *main_storage = main.db.storage();
+  auto const property = main_storage->NameToProperty("property");
+
+  // The middle transaction has more deltas than the replica reads ahead, so it is applied while being read
+  static constexpr int64_t large_txn_vertices = 60'000;
+  std::vector<Gid> vertex_gids;
+  auto const create_vertices = [&](int64_t count) {
+    auto acc = main.db.Access();
+    for (int64_t i = 0; i < count; ++i) {
+      auto v = acc->CreateVertex();
+      ASSERT_TRUE(v.SetProperty(property, PropertyValue(static_cast<int64_t>(vertex_gids.size()))).HasValue());
+      vertex_gids.push_back(v.Gid());
+    }
+    ASSERT_FALSE(acc->Commit({}, main.db_acc).HasError());
+  };
+  create_vertices(10);
+  create_vertices(large_txn_vertices);
+  create_vertices(10);
+
+  repl_conf.durability.recovery_thread_count = 4;
+  MinMemgraph replica(repl_conf);
+  replica.repl_handler.TrySetReplicationRoleReplica(
+      ReplicationServerConfig{
+          .repl_server = Endpoint(local_host, ports[0]),
+      },
+      std::nullopt);
+  ASSERT_FALSE(main.repl_handler
+                   .TryRegisterReplica(ReplicationClientConfig{
+                       .name = replicas[0],
+                       .mode = ReplicationMode::SYNC,
+                       .repl_server_endpoint = Endpoint(local_host, ports[0]),
+                   })
+                   .HasError());
+
+  while (main_storage->GetReplicaState(replicas[0]) != ReplicaState::READY) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  auto *replica_storage = replica.db.storage();
+  ASSERT_EQ(replica_storage->repl_storage_state_.last_durable_timestamp_.load(),
+            main_storage->repl_storage_state_.last_durable_timestamp_.load());
+
+  auto acc = replica.db.Access();
+  auto const replica_property = replica_storage->NameToProperty("property");
+  for (size_t i = 0; i < vertex_gids.size(); ++i) {
+    auto v = acc->FindVertex(vertex_gids[i], View::OLD);
+    ASSERT_TRUE(v);
+    ASSERT_EQ(v->GetProperty(replica_property, View::OLD).GetValue(), PropertyValue(static_cast<int64_t>(i)));
+  }
+  ASSERT_FALSE(acc->Commit().HasError());
+}
+
 TEST_F(ReplicationTest, BasicAsynchronousReplicationTest) {
   MinMemgraph main(main_conf);
   MinMemgraph replica_async(repl_conf);
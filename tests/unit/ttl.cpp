@@ -371,6 +371,66 @@ TYPED_TEST(TTLFixture, Edge) {
   }
 }
 
+TYPED_TEST(TTLFixture, BatchesInTtlOrder) {
+  auto ttl_lbl = this->db_->storage()->NameToLabel("TTL");
+  auto ttl_prop = this->db_->storage()->NameToProperty("ttl");
+  auto et = this->db_->storage()->NameToEdgeType("t");
+  auto older = std::chrono::system_clock::now() - std::chrono::seconds(10);
+  auto older_ts = std::chrono::duration_cast<std::chrono::microseconds>(older.time_since_epoch()).count();
+  // More than a single batch of expired objects, created in the reverse order of their ttl, so the first batch
+  // doesn't get the smallest ttls unless it scans the ttl indices
+  constexpr int64_t kExpired = memgraph::query::ttl::TTL::kBatchSize + 10;
+  {
+    // The indices ENABLE TTL creates
+    auto unique_acc = this->db_->UniqueAccess();
+    ASSERT_FALSE(unique_acc->CreateIndex(ttl_lbl, {ttl_prop}).HasError());
+    if (this->RunEdgeTTL()) ASSERT_FALSE(unique_acc->CreateGlobalEdgeIndex(ttl_prop).HasError());
+    ASSERT_FALSE(unique_acc->Commit().HasError());
+  }
+  {
+    auto acc = this->db_->Access();
+    auto from = acc->CreateVertex();
+    auto to = acc->CreateVertex();
+    for (int64_t i = 0; i < kExpired; ++i) {
+      auto v = acc->CreateVertex();
+      ASSERT_FALSE(v.AddLabel(ttl_lbl).HasError());
+      ASSERT_FALSE(v.SetProperty(ttl_prop, memgraph::storage::PropertyValue(older_ts - i)).HasError());
+      if (this->HasPropOnEdge()) {
+        auto e = acc->CreateEdge(&from, &to, et);
+        ASSERT_TRUE(e.HasValue());
+        ASSERT_FALSE(e->SetProperty(ttl_prop, memgraph::storage::PropertyValue(older_ts - i)).HasError());
+      }
+    }
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+
+  auto count = [&] {
+    auto acc = this->db_->Access();
+    size_t size = 0;
+    size_t edge_size = 0;
+    for (const auto v : acc->Vertices(memgraph::storage::View::NEW)) {
+      if (!v.IsVisible(memgraph::storage::View::NEW)) continue;
+      ++size;
+      auto edges = v.OutEdges(memgraph::storage::View::NEW);
+      if (!edges.HasValue()) continue;
+      for (const auto e : edges.GetValue().edges) edge_size += e.IsVisible(memgraph::storage::View::NEW);
+    }
+    return std::pair{size, edge_size};
+  };
+
+  // A single run, the next one is an hour away
+  this->ttl_->Enable();
+  this->ttl_->Configure(memgraph::query::ttl::TtlInfo{std::chrono::hours(1),
+                                                      std::chrono::system_clock::now() + std::chrono::seconds(1)});
+  EXPECT_NO_THROW(this->ttl_->Setup(this->db_, &this->interpreter_context_, this->RunEdgeTTL()));
+  const size_t expected_edges = this->HasPropOnEdge() && !this->RunEdgeTTL() ? kExpired : 0;
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+  while (count() != std::pair<size_t, size_t>{2, expected_edges} && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+  }
+  EXPECT_EQ(count(), (std::pair<size_t, size_t>{2, expected_edges}));
+}
+
 TYPED_TEST(TTLFixture, Durability) {
   const auto path = GetCleanDataDirectory();
   ASSERT_TRUE(memgraph::utils::EnsureDir(path));
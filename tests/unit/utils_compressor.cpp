@@ -1,4 +1,4 @@
-// Copyright 2024 Memgraph Ltd.
+// Copyright 2025 Memgraph Ltd.
 //
 // Use of this software is governed by the Business Source License
 // included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -12,6 +12,7 @@
 #include <cstdint>
 #include <cstring>
 #include <string>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "utils/compressor.hpp"
@@ -65,3 +66,49 @@ TEST(ZlibCompressorTest, LargeDataTest) {
   EXPECT_EQ(std::string_view(reinterpret_cast<char *>(decompressed->view().data()), decompressed->view().size_bytes()),
             input_data);
 }
+
+TEST(ZlibCompressorTest, DictionaryTest) {
+  auto const *compressor = memgraph::utils::Compressor::GetInstance();
+
+  std::vector<std::string> samples;
+  for (int i = 0; i < 100; ++i) {
+    samples.push_back("name: user_" + std::to_string(i) + ", email: user_" + std::to_string(i) + "@example.com");
+  }
+  std::vector<std::span<uint8_t const>> sample_views;
+  for (auto const &sample : samples) {
+    sample_views.emplace_back(reinterpret_cast<const uint8_t *>(sample.data()), sample.size());
+  }
+  auto const dictionary = memgraph::utils::CompressionDictionary::Train(sample_views);
+  EXPECT_GT(dictionary.view().size_bytes(), 0);
+  EXPECT_LE(dictionary.view().size_bytes(), memgraph::utils::CompressionDictionary::kMaxSize);
+
+  std::string input_data = "name: user_1000, email: user_1000@example.com";
+  auto input = std::span{reinterpret_cast<const uint8_t *>(input_data.data()), input_data.size()};
+  auto compressed = compressor->Compress(input, dictionary);
+  ASSERT_TRUE(compressed);
+  EXPECT_EQ(compressed->original_size(), input_data.size());
+  EXPECT_LT(compressed->view().size_bytes(), compressor->Compress(input)->view().size_bytes());
+
+  auto decompressed = compressor->Decompress(compressed->view(), input_data.size(), dictionary);
+  ASSERT_TRUE(decompressed);
+  EXPECT_EQ(std::string_view(reinterpret_cast<char *>(decompressed->view().data()), decompressed->view().size_bytes()),
+            input_data);
+  // The dictionary is needed to decompress the data
+  EXPECT_FALSE(compressor->Decompress(compressed->view(), input_data.size()));
+}
+
+TEST(ZlibCompressorTest, EmptyDictionaryTest) {
+  auto const *compressor = memgraph::utils::Compressor::GetInstance();
+
+  auto const dictionary = memgraph::utils::CompressionDictionary::Train({});
+  EXPECT_EQ(dictionary.view().size_bytes(), 0);
+
+  std::string input_data(1000, 'A');
+  auto input = std::span{reinterpret_cast<const uint8_t *>(input_data.data()), input_data.size()};
+  auto compressed = compressor->Compress(input, dictionary);
+  ASSERT_TRUE(compressed);
+  auto decompressed = compressor->Decompress(compressed->view(), input_data.size(), dictionary);
+  ASSERT_TRUE(decompressed);
+  EXPECT_EQ(std::string_view(reinterpret_cast<char *>(decompressed->view().data()), decompressed->view().size_bytes()),
+            input_data);
+}
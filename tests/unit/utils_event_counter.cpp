@@ -0,0 +1,52 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "utils/event_counter.hpp"
+
+using memgraph::metrics::Counter;
+using memgraph::metrics::EventCounters;
+
+TEST(EventCounters, ShardsSumAcrossThreads) {
+  constexpr memgraph::metrics::Event kStride = 8;
+  std::vector<Counter> array(EventCounters::kShards * kStride);
+  EventCounters counters{array.data(), kStride};
+
+  constexpr int kThreads = 8;
+  constexpr int kIncrements = 10000;
+  {
+    std::vector<std::jthread> threads;
+    for (int i = 0; i < kThreads; ++i) {
+      threads.emplace_back([&] {
+        for (int j = 0; j < kIncrements; ++j) counters.Increment(1);
+      });
+    }
+  }
+  EXPECT_EQ(counters.GetCount(0), 0);
+  EXPECT_EQ(counters.GetCount(1), kThreads * kIncrements);
+}
+
+TEST(EventCounters, DecrementFromAnotherThread) {
+  constexpr memgraph::metrics::Event kStride = 8;
+  std::vector<Counter> array(EventCounters::kShards * kStride);
+  EventCounters counters{array.data(), kStride};
+
+  std::jthread{[&] { counters.Increment(0, 5); }}.join();
+  std::jthread{[&] { counters.Decrement(0, 3); }}.join();
+  EXPECT_EQ(counters.GetCount(0), 2);
+
+  EXPECT_EQ(counters.Reset(0), 2);
+  EXPECT_EQ(counters.GetCount(0), 0);
+}
@@ -11,7 +11,13 @@
 
 #include <gtest/gtest.h>
 
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
 #include "utils/event_histogram.hpp"
+#include "utils/event_labeled_histogram.hpp"
 
 TEST(Histogram, BasicFunctionality) {
   memgraph::metrics::Histogram histo{};
@@ -43,3 +49,51 @@ TEST(Histogram, BasicFunctionality) {
 
   ASSERT_NEAR(diff, 0, 0.01);
 }
+
+TEST(Histogram, ConcurrentMeasure) {
+  memgraph::metrics::Histogram histo{};
+  constexpr auto kThreads = 8;
+  constexpr auto kMeasurements = 10000;
+
+  std::vector<std::jthread> threads;
+  for (int t = 0; t < kThreads; t++) {
+    threads.emplace_back([&histo, t] {
+      for (int i = 0; i < kMeasurements; i++) {
+        histo.Measure(100 * (t + 1));
+        // Reading while others are measuring must never run past the recorded samples
+        if (i % 1000 == 0) histo.Percentile(100.0);
+      }
+    });
+  }
+  threads.clear();
+
+  ASSERT_EQ(histo.Count(), kThreads * kMeasurements);
+  ASSERT_EQ(histo.Sum(), 100ULL * kMeasurements * kThreads * (kThreads + 1) / 2);
+  ASSERT_NEAR(static_cast<double>(histo.Percentile(0.0)), 100.0, 1.0);
+  ASSERT_NEAR(static_cast<double>(histo.Percentile(100.0)), 100.0 * kThreads, 8.0);
+}
+
+TEST(LabeledHistogram, SeriesPerLabelValues) {
+  memgraph::metrics::LabeledHistogram histograms{{50, 99}};
+  histograms.Measure({"memgraph", "r"}, 10);
+  histograms.Measure({"memgraph", "r"}, 20);
+  histograms.Measure({"memgraph", "w"}, 30);
+
+  std::vector<std::pair<std::vector<std::string>, uint64_t>> series;
+  histograms.ForEach([&](const auto &label_values, const auto &histogram) {
+    series.emplace_back(label_values, histogram.Count());
+  });
+  ASSERT_EQ(series.size(), 2);
+  EXPECT_EQ(series[0], (std::pair{std::vector<std::string>{"memgraph", "r"}, uint64_t{2}}));
+  EXPECT_EQ(series[1], (std::pair{std::vector<std::string>{"memgraph", "w"}, uint64_t{1}}));
+}
+
+TEST(LabeledHistogram, DropsSeriesOverLimit) {
+  memgraph::metrics::LabeledHistogram histograms{{50}};
+  for (size_t i = 0; i < memgraph::metrics::LabeledHistogram::kMaxSeries + 10; ++i) {
+    histograms.Measure({std::to_string(i)}, 1);
+  }
+  size_t series = 0;
+  histograms.ForEach([&](const auto &, const auto &) { ++series; });
+  EXPECT_EQ(series, memgraph::metrics::LabeledHistogram::kMaxSeries);
+}
@@ -0,0 +1,118 @@
+// Copyright 2025 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "storage/v2/edge.hpp"
+#include "storage/v2/inmemory/storage.hpp"
+#include "storage/v2/vertex.hpp"
+#include "utils/event_counter.hpp"
+#include "utils/event_histogram.hpp"
+#include "utils/lock_contention.hpp"
+#include "utils/rw_spin_lock.hpp"
+
+namespace memgraph::metrics {
+extern const Event VertexLockContended;
+extern const Event EdgeLockContended;
+extern const Event EdgeLockWait_ns;
+extern const Event GcLockContended;
+}  // namespace memgraph::metrics
+
+using memgraph::utils::ContentionProfiledLock;
+using memgraph::utils::LockClass;
+using memgraph::utils::RWSpinLock;
+
+namespace {
+// Holds `lock` while another thread blocks on it
+template <typename TLock, typename TAcquire>
+void Contend(TLock &lock, TAcquire acquire) {
+  auto guard = std::unique_lock{lock};
+  std::atomic<bool> waiting{false};
+  std::thread waiter([&] {
+    waiting = true;
+    acquire(lock);
+  });
+  while (!waiting) std::this_thread::yield();
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  guard.unlock();
+  waiter.join();
+}
+
+void SharedAcquire(auto &lock) { auto guard = std::shared_lock{lock}; }
+void UniqueAcquire(auto &lock) { auto guard = std::unique_lock{lock}; }
+
+#ifdef MG_LOCK_CONTENTION_PROFILE
+constexpr uint64_t kExpectedContended = 1;
+#else
+constexpr uint64_t kExpectedContended = 0;
+#endif
+}  // namespace
+
+TEST(LockContention, UncontendedLockIsNotRecorded) {
+  const auto contended = memgraph::metrics::GetCounterValue(memgraph::metrics::EdgeLockContended);
+  ContentionProfiledLock<RWSpinLock, LockClass::EDGE> lock;
+  { auto guard = std::unique_lock{lock}; }
+  { auto guard = std::shared_lock{lock}; }
+  { auto guard = std::shared_lock{lock}; }
+  EXPECT_EQ(memgraph::metrics::GetCounterValue(memgraph::metrics::EdgeLockContended), contended);
+}
+
+TEST(LockContention, ContendedLockIsRecorded) {
+  const auto contended = memgraph::metrics::GetCounterValue(memgraph::metrics::EdgeLockContended);
+  const auto measured = memgraph::metrics::global_histograms[memgraph::metrics::EdgeLockWait_ns].Count();
+  ContentionProfiledLock<RWSpinLock, LockClass::EDGE> lock;
+  Contend(lock, [](auto &waited) { SharedAcquire(waited); });
+
+  EXPECT_EQ(memgraph::metrics::GetCounterValue(memgraph::metrics::EdgeLockContended), contended + 1);
+  EXPECT_EQ(memgraph::metrics::global_histograms[memgraph::metrics::EdgeLockWait_ns].Count(), measured + 1);
+}
+
+TEST(LockContention, TopWriteConflicts) {
+  for (int i = 0; i < 10; ++i) memgraph::utils::RecordWriteConflict(1);
+  for (int i = 0; i < 5; ++i) memgraph::utils::RecordWriteConflict(2);
+  // Rare conflicts don't push out the frequent ones
+  for (uint64_t gid = 100; gid < 140; ++gid) memgraph::utils::RecordWriteConflict(gid);
+
+  const auto top = memgraph::utils::TopWriteConflicts();
+  ASSERT_GE(top.size(), 2);
+  EXPECT_EQ(top[0].first, 1);
+  EXPECT_GE(top[0].second, 10);
+  EXPECT_EQ(top[1].first, 2);
+  EXPECT_GE(top[1].second, 5);
+}
+
+// The storage locks are only profiled when built with MG_LOCK_CONTENTION_PROFILE
+TEST(LockContention, StorageLocks) {
+  using memgraph::metrics::GetCounterValue;
+  const auto vertex_contended = GetCounterValue(memgraph::metrics::VertexLockContended);
+  const auto edge_contended = GetCounterValue(memgraph::metrics::EdgeLockContended);
+  const auto gc_contended = GetCounterValue(memgraph::metrics::GcLockContended);
+
+  memgraph::storage::Vertex vertex{memgraph::storage::Gid::FromUint(0), nullptr};
+  Contend(vertex.lock, [](auto &waited) { SharedAcquire(waited); });
+  memgraph::storage::Edge edge{memgraph::storage::Gid::FromUint(0), nullptr};
+  Contend(edge.lock, [](auto &waited) { UniqueAcquire(waited); });
+  // Guards of the GC lock are handed around as std::unique_lock<gc_lock_t>
+  memgraph::storage::InMemoryStorage::gc_lock_t gc_lock;
+  Contend(gc_lock, [](auto &waited) {
+    std::unique_lock<memgraph::storage::InMemoryStorage::gc_lock_t> guard{waited};
+  });
+
+  EXPECT_EQ(GetCounterValue(memgraph::metrics::VertexLockContended), vertex_contended + kExpectedContended);
+  EXPECT_EQ(GetCounterValue(memgraph::metrics::EdgeLockContended), edge_contended + kExpectedContended);
+  EXPECT_EQ(GetCounterValue(memgraph::metrics::GcLockContended), gc_contended + kExpectedContended);
+}
@@ -9,6 +9,9 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <thread>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "memory/global_memory_control.hpp"
@@ -31,3 +34,42 @@ TEST(MemoryTrackerTest, ExceptionEnabler) {
   // Previously we would deadlock
 #endif
 }
+
+TEST(MemoryTrackerTest, DatabaseLimitIsSharedByQueries) {
+  constexpr int64_t kDatabaseLimit = 1000;
+  constexpr size_t kQueryLimit = 800;
+  constexpr size_t kChunk = 100;
+  memgraph::utils::MemoryTracker database_tracker;
+  database_tracker.SetMaximumHardLimit(kDatabaseLimit);
+  database_tracker.SetHardLimit(kDatabaseLimit);
+
+  {
+    std::vector<memgraph::utils::QueryMemoryTracker> queries(2);
+    std::vector<size_t> allocated(queries.size(), 0);
+    std::vector<std::jthread> threads;
+    for (size_t i = 0; i < queries.size(); ++i) {
+      queries[i].SetQueryLimit(kQueryLimit);
+      queries[i].SetDatabaseTracker(&database_tracker);
+      threads.emplace_back([&query = queries[i], &allocated = allocated[i]] {
+        memgraph::utils::MemoryTracker::OutOfMemoryExceptionEnabler can_fail;
+        while (query.TrackAlloc(kChunk)) allocated += kChunk;
+      });
+    }
+    threads.clear();
+
+    // Both queries are refused once they hold the database's limit together, well below the sum of their own limits
+    EXPECT_LE(allocated[0], kQueryLimit);
+    EXPECT_LE(allocated[1], kQueryLimit);
+    EXPECT_EQ(allocated[0] + allocated[1], kDatabaseLimit);
+    EXPECT_EQ(database_tracker.Amount(), kDatabaseLimit);
+
+    // Freed memory can be used by the other query
+    memgraph::utils::MemoryTracker::OutOfMemoryExceptionEnabler can_fail;
+    queries[0].TrackFree(kChunk);
+    EXPECT_TRUE(queries[1].TrackAlloc(kChunk));
+    EXPECT_FALSE(queries[0].TrackAlloc(kChunk));
+  }
+
+  // Whatever the queries still held is given back once they are done
+  EXPECT_EQ(database_tracker.Amount(), 0);
+}
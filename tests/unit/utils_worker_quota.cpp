@@ -0,0 +1,115 @@
+// Copyright 2026 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <chrono>
+#include <functional>
+#include <future>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "utils/on_scope_exit.hpp"
+#include "utils/priority_thread_pool.hpp"
+#include "utils/worker_quota.hpp"
+
+using namespace std::chrono_literals;
+using memgraph::utils::WorkerQuota;
+
+TEST(WorkerQuota, Unlimited) {
+  WorkerQuota quota{0};
+  for (int i = 0; i < 100; ++i) ASSERT_TRUE(quota.TryAcquire([] { FAIL(); }));
+  EXPECT_EQ(quota.Running(), 100);
+  EXPECT_EQ(quota.Parked(), 0);
+}
+
+TEST(WorkerQuota, ParksOverLimit) {
+  WorkerQuota quota{2};
+  ASSERT_TRUE(quota.TryAcquire([] { FAIL(); }));
+  ASSERT_TRUE(quota.TryAcquire([] { FAIL(); }));
+
+  std::vector<int> resumed;
+  EXPECT_FALSE(quota.TryAcquire([&] { resumed.push_back(1); }));
+  EXPECT_FALSE(quota.TryAcquire([&] { resumed.push_back(2); }));
+  EXPECT_EQ(quota.Running(), 2);
+  EXPECT_EQ(quota.Parked(), 2);
+
+  // Parked tasks are resumed in order, one per released slot
+  quota.Release();
+  EXPECT_EQ(resumed, std::vector<int>{1});
+  EXPECT_EQ(quota.Running(), 1);
+  EXPECT_EQ(quota.Parked(), 1);
+
+  // The resumed task takes the freed slot again
+  ASSERT_TRUE(quota.TryAcquire([] { FAIL(); }));
+  quota.Release();
+  EXPECT_EQ(resumed, (std::vector<int>{1, 2}));
+  EXPECT_EQ(quota.Parked(), 0);
+}
+
+TEST(WorkerQuota, ResumeCanReacquire) {
+  WorkerQuota quota{1};
+  ASSERT_TRUE(quota.TryAcquire([] { FAIL(); }));
+
+  bool acquired = false;
+  EXPECT_FALSE(quota.TryAcquire([&] { acquired = quota.TryAcquire([] { FAIL(); }); }));
+  quota.Release();
+  EXPECT_TRUE(acquired);
+  EXPECT_EQ(quota.Running(), 1);
+}
+
+TEST(WorkerQuota, ParkedTaskDoesNotHoldPoolWorker) {
+  // Two workers; the quota lets only one of them run the limited group's tasks
+  memgraph::utils::PriorityThreadPool pool{2, 1};
+  WorkerQuota quota{1};
+
+  // Schedules `task` the way a session schedules its work: over the quota the
+  // task is parked and scheduled again once a slot is released
+  std::function<void(std::function<void()>)> schedule_limited = [&](std::function<void()> task) {
+    pool.ScheduledAddTask(
+        [&, task](auto) {
+          if (!quota.TryAcquire([&, task] { schedule_limited(task); })) return;
+          const memgraph::utils::OnScopeExit release{[&] { quota.Release(); }};
+          task();
+        },
+        memgraph::utils::Priority::LOW);
+  };
+
+  // The first task takes the only slot and one of the workers
+  std::promise<void> blocked_started;
+  std::promise<void> release_blocked;
+  schedule_limited([&] {
+    blocked_started.set_value();
+    release_blocked.get_future().wait();
+  });
+  ASSERT_EQ(blocked_started.get_future().wait_for(5s), std::future_status::ready);
+
+  // The second task is over the quota and is parked
+  std::promise<void> parked_done;
+  schedule_limited([&] { parked_done.set_value(); });
+  const auto deadline = std::chrono::steady_clock::now() + 5s;
+  while (quota.Parked() == 0 && std::chrono::steady_clock::now() < deadline) std::this_thread::sleep_for(1ms);
+  ASSERT_EQ(quota.Parked(), 1);
+  auto parked_future = parked_done.get_future();
+  EXPECT_EQ(parked_future.wait_for(100ms), std::future_status::timeout);
+
+  // The parked task doesn't hold the other worker, so a task without a quota runs
+  std::promise<void> other_done;
+  pool.ScheduledAddTask([&](auto) { other_done.set_value(); }, memgraph::utils::Priority::LOW);
+  EXPECT_EQ(other_done.get_future().wait_for(5s), std::future_status::ready);
+
+  // Once the slot is released, the parked task is resumed
+  release_blocked.set_value();
+  EXPECT_EQ(parked_future.wait_for(5s), std::future_status::ready);
+  EXPECT_EQ(quota.Parked(), 0);
+
+  pool.ShutDown();
+  pool.AwaitShutdown();
+}